@@ -0,0 +1,222 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        concurrent_static_cache_benchmark.cpp
+ * @brief       concurrent_static_cache benchmark against a mutex-wrapped static_cache.
+ * @author      Killian Valverde
+ * @date        2026/10/15
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t CACHE_SIZE = 1 << 16;
+
+constexpr std::uint32_t N_RESIDENT_KEYS = CACHE_SIZE / 2;
+
+using cache_type = speed::containers::static_cache<std::uint32_t, std::uint64_t, CACHE_SIZE>;
+
+using concurrent_cache_type = speed::containers::concurrent_static_cache<
+        std::uint32_t, std::uint64_t, CACHE_SIZE, 64>;
+
+using concurrent_clock_cache_type = speed::containers::concurrent_static_cache<
+        std::uint32_t,
+        std::uint64_t,
+        CACHE_SIZE,
+        64,
+        std::hash<std::uint32_t>,
+        std::equal_to<std::uint32_t>,
+        speed::containers::clock_eviction_policy
+>;
+
+struct mutex_cache
+{
+    std::mutex mtx_;
+    cache_type cache_;
+};
+
+std::atomic<std::uint32_t> next_fresh_key(N_RESIDENT_KEYS);
+
+mutex_cache& get_mutex_cache()
+{
+    static mutex_cache mtx_cache;
+    static const bool populated = []
+    {
+        for (std::uint32_t i = 0; i < N_RESIDENT_KEYS; ++i)
+        {
+            mtx_cache.cache_.insert(i, i);
+        }
+
+        return true;
+    }();
+
+    (void)populated;
+
+    return mtx_cache;
+}
+
+template<typename CacheT>
+CacheT& get_concurrent_cache()
+{
+    static CacheT conc_cache;
+    static const bool populated = []
+    {
+        for (std::uint32_t i = 0; i < N_RESIDENT_KEYS; ++i)
+        {
+            conc_cache.insert(i, i);
+        }
+
+        return true;
+    }();
+
+    (void)populated;
+
+    return conc_cache;
+}
+
+std::uint32_t next_random(std::uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return static_cast<std::uint32_t>(state);
+}
+
+void containers_mutex_static_cache_find(benchmark::State& state)
+{
+    mutex_cache& mtx_cache = get_mutex_cache();
+    std::uint64_t rnd = 0x9E3779B97F4A7C15ull + state.thread_index();
+    std::uint64_t val = 0;
+
+    for (auto _ : state)
+    {
+        std::uint32_t ky = next_random(rnd) % N_RESIDENT_KEYS;
+        std::lock_guard<std::mutex> lck(mtx_cache.mtx_);
+        auto it = mtx_cache.cache_.find(ky);
+
+        if (!it.end())
+        {
+            val += *it;
+        }
+    }
+
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename CacheT>
+void containers_concurrent_static_cache_find(benchmark::State& state)
+{
+    CacheT& conc_cache = get_concurrent_cache<CacheT>();
+    std::uint64_t rnd = 0x9E3779B97F4A7C15ull + state.thread_index();
+    std::uint64_t val = 0;
+    std::uint64_t cur_val;
+
+    for (auto _ : state)
+    {
+        if (conc_cache.find(next_random(rnd) % N_RESIDENT_KEYS, cur_val))
+        {
+            val += cur_val;
+        }
+    }
+
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void containers_mutex_static_cache_mixed(benchmark::State& state)
+{
+    mutex_cache& mtx_cache = get_mutex_cache();
+    std::uint64_t rnd = 0x9E3779B97F4A7C15ull + state.thread_index();
+    std::uint64_t val = 0;
+
+    for (auto _ : state)
+    {
+        std::uint32_t cur_rnd = next_random(rnd);
+
+        if (cur_rnd % 10 == 0)
+        {
+            std::uint32_t ky = next_fresh_key.fetch_add(1, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lck(mtx_cache.mtx_);
+            mtx_cache.cache_.insert(ky, ky);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lck(mtx_cache.mtx_);
+            auto it = mtx_cache.cache_.find(cur_rnd % N_RESIDENT_KEYS);
+
+            if (!it.end())
+            {
+                val += *it;
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename CacheT>
+void containers_concurrent_static_cache_mixed(benchmark::State& state)
+{
+    CacheT& conc_cache = get_concurrent_cache<CacheT>();
+    std::uint64_t rnd = 0x9E3779B97F4A7C15ull + state.thread_index();
+    std::uint64_t val = 0;
+    std::uint64_t cur_val;
+
+    for (auto _ : state)
+    {
+        std::uint32_t cur_rnd = next_random(rnd);
+
+        if (cur_rnd % 10 == 0)
+        {
+            std::uint32_t ky = next_fresh_key.fetch_add(1, std::memory_order_relaxed);
+            conc_cache.insert(ky, ky);
+        }
+        else if (conc_cache.find(cur_rnd % N_RESIDENT_KEYS, cur_val))
+        {
+            val += cur_val;
+        }
+    }
+
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(containers_mutex_static_cache_find)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(containers_concurrent_static_cache_find, concurrent_cache_type)
+        ->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(containers_concurrent_static_cache_find, concurrent_clock_cache_type)
+        ->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(containers_mutex_static_cache_mixed)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(containers_concurrent_static_cache_mixed, concurrent_cache_type)
+        ->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(containers_concurrent_static_cache_mixed, concurrent_clock_cache_type)
+        ->ThreadRange(1, 16)->UseRealTime();
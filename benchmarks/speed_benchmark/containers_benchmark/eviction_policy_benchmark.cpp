@@ -0,0 +1,218 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        eviction_policy_benchmark.cpp
+ * @brief       eviction policies trace replay benchmark.
+ * @author      Killian Valverde
+ * @date        2026/10/15
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t CACHE_SIZE = 1 << 14;
+
+constexpr std::size_t N_KEYS = 1 << 20;
+
+constexpr std::size_t TRACE_SIZE = 1 << 20;
+
+constexpr double ZIPF_EXPONENT = 0.99;
+
+constexpr std::size_t ZIPF_BURST_SIZE = 50000;
+
+constexpr std::size_t SCAN_BURST_SIZE = 30000;
+
+constexpr std::uint32_t SCAN_FIRST_KEY = 1u << 31;
+
+template<template<typename> class EvictionPolicyT>
+using cache_type = speed::containers::static_cache<
+        std::uint32_t,
+        std::uint32_t,
+        CACHE_SIZE,
+        std::hash<std::uint32_t>,
+        std::equal_to<std::uint32_t>,
+        EvictionPolicyT
+>;
+
+using lru_cache_type = cache_type<speed::containers::lru_eviction_policy>;
+
+using clock_cache_type = cache_type<speed::containers::clock_eviction_policy>;
+
+using w_tinylfu_cache_type = cache_type<speed::containers::w_tinylfu_eviction_policy>;
+
+using arc_cache_type = cache_type<speed::containers::arc_eviction_policy>;
+
+using s3_fifo_cache_type = cache_type<speed::containers::s3_fifo_eviction_policy>;
+
+class zipf_generator
+{
+public:
+    zipf_generator()
+            : cdf_(N_KEYS)
+    {
+        double sum = 0;
+
+        for (std::size_t i = 0; i < N_KEYS; ++i)
+        {
+            sum += 1.0 / std::pow(static_cast<double>(i + 1), ZIPF_EXPONENT);
+            cdf_[i] = sum;
+        }
+
+        for (auto& prob : cdf_)
+        {
+            prob /= sum;
+        }
+    }
+
+    std::uint32_t operator ()(std::uint64_t& state) const
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        const double u = static_cast<double>(state >> 11) * 0x1.0p-53;
+        const auto rnk = static_cast<std::uint32_t>(
+                std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin());
+
+        // The ranks are scattered so the popular keys don't share the same few buckets.
+        return (rnk * 0x9E3779B1u) & (SCAN_FIRST_KEY - 1);
+    }
+
+private:
+    std::vector<double> cdf_;
+};
+
+const std::vector<std::uint32_t>& get_zipf_trace()
+{
+    static const std::vector<std::uint32_t> trc = []
+    {
+        zipf_generator zipf;
+        std::vector<std::uint32_t> kys(TRACE_SIZE);
+        std::uint64_t rnd = 0x9E3779B97F4A7C15ull;
+
+        for (auto& ky : kys)
+        {
+            ky = zipf(rnd);
+        }
+
+        return kys;
+    }();
+
+    return trc;
+}
+
+const std::vector<std::uint32_t>& get_scan_trace()
+{
+    static const std::vector<std::uint32_t> trc = []
+    {
+        zipf_generator zipf;
+        std::vector<std::uint32_t> kys;
+        std::uint64_t rnd = 0x9E3779B97F4A7C15ull;
+
+        kys.reserve(TRACE_SIZE);
+
+        while (kys.size() < TRACE_SIZE)
+        {
+            for (std::size_t i = 0; i < ZIPF_BURST_SIZE && kys.size() < TRACE_SIZE; ++i)
+            {
+                kys.push_back(zipf(rnd));
+            }
+
+            for (std::size_t i = 0; i < SCAN_BURST_SIZE && kys.size() < TRACE_SIZE; ++i)
+            {
+                kys.push_back(SCAN_FIRST_KEY + static_cast<std::uint32_t>(i));
+            }
+        }
+
+        return kys;
+    }();
+
+    return trc;
+}
+
+template<typename CacheT>
+void replay(benchmark::State& state, const std::vector<std::uint32_t>& trc)
+{
+    std::size_t n_hits = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto cache = std::make_unique<CacheT>();
+        state.ResumeTiming();
+
+        for (auto ky : trc)
+        {
+            if (cache->find(ky).end())
+            {
+                cache->insert(ky, ky);
+            }
+            else
+            {
+                ++n_hits;
+            }
+        }
+
+        state.PauseTiming();
+        cache.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * trc.size()));
+    state.counters["hit_ratio"] = static_cast<double>(n_hits) /
+            static_cast<double>(state.iterations() * trc.size());
+    state.counters["time_per_op"] = benchmark::Counter(
+            static_cast<double>(trc.size()),
+            benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+template<typename CacheT>
+void containers_zipf_trace(benchmark::State& state)
+{
+    replay<CacheT>(state, get_zipf_trace());
+}
+
+template<typename CacheT>
+void containers_scan_trace(benchmark::State& state)
+{
+    replay<CacheT>(state, get_scan_trace());
+}
+
+}
+
+BENCHMARK_TEMPLATE(containers_zipf_trace, lru_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_zipf_trace, clock_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_zipf_trace, w_tinylfu_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_zipf_trace, arc_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_zipf_trace, s3_fifo_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_scan_trace, lru_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_scan_trace, clock_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_scan_trace, w_tinylfu_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_scan_trace, arc_cache_type)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(containers_scan_trace, s3_fifo_cache_type)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,119 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        filter_benchmark.cpp
+ * @brief       bloom_filter and cuckoo_filter benchmark.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t N_LOOKUPS = 1 << 20;
+
+using bloom_filter_type = speed::containers::bloom_filter<std::uint64_t>;
+
+using cuckoo_filter_type = speed::containers::cuckoo_filter<std::uint64_t>;
+
+std::vector<std::uint64_t> make_keys(std::size_t n_kys, std::uint64_t seed)
+{
+    std::vector<std::uint64_t> kys(n_kys);
+    
+    for (auto& ky : kys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        ky = seed;
+    }
+    
+    return kys;
+}
+
+template<typename FilterT>
+void insert(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    const double fpr = 1.0 / static_cast<double>(state.range(1));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    FilterT fltr(n_kys, fpr);
+    
+    for (auto _ : state)
+    {
+        fltr.clear();
+        
+        for (auto ky : kys)
+        {
+            fltr.insert(ky);
+        }
+        
+        benchmark::ClobberMemory();
+    }
+    
+    state.SetItemsProcessed(state.iterations() * n_kys);
+    state.counters["bits_per_key"] = static_cast<double>(fltr.get_memory_size() * 8) /
+            static_cast<double>(n_kys);
+}
+
+template<typename FilterT>
+void lookup(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    const double fpr = 1.0 / static_cast<double>(state.range(1));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    auto lookup_kys = make_keys(N_LOOKUPS, 0xC2B2AE3D27D4EB4Full);
+    FilterT fltr(n_kys, fpr);
+    std::uint64_t n_hits = 0;
+    
+    for (auto ky : kys)
+    {
+        fltr.insert(ky);
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto ky : lookup_kys)
+        {
+            n_hits += fltr.contains(ky) ? 1 : 0;
+        }
+    }
+    
+    benchmark::DoNotOptimize(n_hits);
+    state.SetItemsProcessed(state.iterations() * N_LOOKUPS);
+    state.counters["target_fpr"] = fpr;
+    state.counters["measured_fpr"] = static_cast<double>(n_hits) /
+            static_cast<double>(state.iterations() * N_LOOKUPS);
+    state.counters["bits_per_key"] = static_cast<double>(fltr.get_memory_size() * 8) /
+            static_cast<double>(n_kys);
+}
+
+}
+
+BENCHMARK_TEMPLATE(insert, bloom_filter_type)->ArgsProduct({{1 << 16, 1 << 22}, {100, 1000}});
+BENCHMARK_TEMPLATE(insert, cuckoo_filter_type)->ArgsProduct({{1 << 16, 1 << 22}, {100, 1000}});
+BENCHMARK_TEMPLATE(lookup, bloom_filter_type)->ArgsProduct({{1 << 16, 1 << 22}, {100, 1000}});
+BENCHMARK_TEMPLATE(lookup, cuckoo_filter_type)->ArgsProduct({{1 << 16, 1 << 22}, {100, 1000}});
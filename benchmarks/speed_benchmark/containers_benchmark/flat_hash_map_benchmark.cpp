@@ -0,0 +1,193 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        flat_hash_map_benchmark.cpp
+ * @brief       flat_hash_map benchmark against std::unordered_map.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t N_LOOKUPS = 1 << 20;
+
+std::vector<std::uint64_t> make_keys(std::size_t n_kys, std::uint64_t seed)
+{
+    std::vector<std::uint64_t> kys(n_kys);
+    
+    for (auto& ky : kys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        ky = seed;
+    }
+    
+    return kys;
+}
+
+template<typename MapT, typename KeyT>
+MapT make_map(const std::vector<KeyT>& kys)
+{
+    MapT map;
+    
+    for (std::size_t i = 0; i < kys.size(); ++i)
+    {
+        map.emplace(kys[i], i);
+    }
+    
+    return map;
+}
+
+template<typename MapT>
+void insert(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    
+    for (auto _ : state)
+    {
+        MapT map;
+        
+        for (auto ky : kys)
+        {
+            map.emplace(ky, ky);
+        }
+        
+        benchmark::DoNotOptimize(map.size());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * n_kys);
+}
+
+template<typename MapT>
+void find_hit(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    auto lookup_kys = make_keys(N_LOOKUPS, 0xC2B2AE3D27D4EB4Full);
+    auto map = make_map<MapT>(kys);
+    std::uint64_t val = 0;
+    
+    for (auto& ky : lookup_kys)
+    {
+        ky = kys[ky % n_kys];
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto ky : lookup_kys)
+        {
+            val += map.find(ky)->second;
+        }
+    }
+    
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations() * N_LOOKUPS);
+}
+
+template<typename MapT>
+void find_miss(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    auto lookup_kys = make_keys(N_LOOKUPS, 0xC2B2AE3D27D4EB4Full);
+    auto map = make_map<MapT>(kys);
+    std::size_t n_misses = 0;
+    
+    for (auto _ : state)
+    {
+        for (auto ky : lookup_kys)
+        {
+            n_misses += map.find(ky) == map.end();
+        }
+    }
+    
+    benchmark::DoNotOptimize(n_misses);
+    state.SetItemsProcessed(state.iterations() * N_LOOKUPS);
+}
+
+template<typename MapT>
+void find_string_hit(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    auto int_kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    auto lookup_idxs = make_keys(N_LOOKUPS, 0xC2B2AE3D27D4EB4Full);
+    std::vector<std::string> kys;
+    std::vector<std::string> lookup_kys;
+    std::uint64_t val = 0;
+    
+    kys.reserve(n_kys);
+    lookup_kys.reserve(N_LOOKUPS);
+    
+    for (auto ky : int_kys)
+    {
+        kys.push_back("--option-" + std::to_string(ky));
+    }
+    
+    for (auto idx : lookup_idxs)
+    {
+        lookup_kys.push_back(kys[idx % n_kys]);
+    }
+    
+    auto map = make_map<MapT>(kys);
+    
+    for (auto _ : state)
+    {
+        for (const auto& ky : lookup_kys)
+        {
+            val += map.find(ky)->second;
+        }
+    }
+    
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations() * N_LOOKUPS);
+}
+
+using unordered_map_type = std::unordered_map<std::uint64_t, std::uint64_t>;
+
+using flat_hash_map_type = speed::containers::flat_hash_map<std::uint64_t, std::uint64_t>;
+
+using unordered_string_map_type = std::unordered_map<std::string, std::uint64_t>;
+
+using flat_hash_string_map_type = speed::containers::flat_hash_map<std::string, std::uint64_t>;
+
+}
+
+// The 100M entries runs need about 6 GiB of memory for std::unordered_map.
+BENCHMARK_TEMPLATE(insert, unordered_map_type)->RangeMultiplier(10)->Range(1000, 100000000);
+BENCHMARK_TEMPLATE(insert, flat_hash_map_type)->RangeMultiplier(10)->Range(1000, 100000000);
+BENCHMARK_TEMPLATE(find_hit, unordered_map_type)->RangeMultiplier(10)->Range(1000, 100000000);
+BENCHMARK_TEMPLATE(find_hit, flat_hash_map_type)->RangeMultiplier(10)->Range(1000, 100000000);
+BENCHMARK_TEMPLATE(find_miss, unordered_map_type)->RangeMultiplier(10)->Range(1000, 100000000);
+BENCHMARK_TEMPLATE(find_miss, flat_hash_map_type)->RangeMultiplier(10)->Range(1000, 100000000);
+BENCHMARK_TEMPLATE(find_string_hit, unordered_string_map_type)
+        ->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(find_string_hit, flat_hash_string_map_type)
+        ->RangeMultiplier(10)->Range(1000, 1000000);
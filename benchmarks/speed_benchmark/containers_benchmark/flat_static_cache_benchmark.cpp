@@ -0,0 +1,176 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        flat_static_cache_benchmark.cpp
+ * @brief       flat_static_cache benchmark against static_cache.
+ * @author      Killian Valverde
+ * @date        2026/10/15
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t CACHE_SIZE = 1 << 16;
+
+constexpr std::size_t N_LOOKUPS = CACHE_SIZE;
+
+std::vector<std::uint32_t> make_keys(std::size_t n_kys, std::uint64_t seed)
+{
+    std::vector<std::uint32_t> kys(n_kys);
+    
+    for (auto& ky : kys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        ky = static_cast<std::uint32_t>(seed);
+    }
+    
+    return kys;
+}
+
+template<typename CacheT>
+void find_hit(benchmark::State& state)
+{
+    auto cache = std::make_unique<CacheT>();
+    auto kys = make_keys(CACHE_SIZE, 0x9E3779B97F4A7C15ull);
+    auto lookup_kys = make_keys(N_LOOKUPS, 0xC2B2AE3D27D4EB4Full);
+    std::uint64_t val = 0;
+    
+    for (auto ky : kys)
+    {
+        if (cache->find(ky).end())
+        {
+            cache->insert(ky, ky);
+        }
+    }
+    
+    for (auto& ky : lookup_kys)
+    {
+        ky = kys[ky % CACHE_SIZE];
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto ky : lookup_kys)
+        {
+            val += *cache->find(ky);
+        }
+    }
+    
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations() * N_LOOKUPS);
+}
+
+template<typename CacheT>
+void find_miss(benchmark::State& state)
+{
+    auto cache = std::make_unique<CacheT>();
+    auto kys = make_keys(CACHE_SIZE, 0x9E3779B97F4A7C15ull);
+    auto lookup_kys = make_keys(N_LOOKUPS, 0xC2B2AE3D27D4EB4Full);
+    std::size_t n_misses = 0;
+    
+    for (auto ky : kys)
+    {
+        if (cache->find(ky).end())
+        {
+            cache->insert(ky, ky);
+        }
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto ky : lookup_kys)
+        {
+            n_misses += cache->find(ky).end();
+        }
+    }
+    
+    benchmark::DoNotOptimize(n_misses);
+    state.SetItemsProcessed(state.iterations() * N_LOOKUPS);
+}
+
+template<typename CacheT>
+void insert_evict(benchmark::State& state)
+{
+    auto cache = std::make_unique<CacheT>();
+    std::uint32_t ky = 0;
+    
+    for (auto _ : state)
+    {
+        cache->insert(ky, ky);
+        ++ky;
+    }
+    
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename CacheT>
+void iterate(benchmark::State& state)
+{
+    auto cache = std::make_unique<CacheT>();
+    auto kys = make_keys(CACHE_SIZE, 0x9E3779B97F4A7C15ull);
+    std::uint64_t val = 0;
+    std::size_t n_ents = 0;
+    
+    for (auto ky : kys)
+    {
+        if (cache->find(ky).end())
+        {
+            cache->insert(ky, ky);
+            ++n_ents;
+        }
+    }
+    
+    for (auto _ : state)
+    {
+        for (const auto& x : *cache)
+        {
+            val += x;
+        }
+    }
+    
+    benchmark::DoNotOptimize(val);
+    state.SetItemsProcessed(state.iterations() * n_ents);
+}
+
+using static_cache_type = speed::containers::static_cache<
+        std::uint32_t, std::uint64_t, CACHE_SIZE>;
+
+using flat_static_cache_type = speed::containers::flat_static_cache<
+        std::uint32_t, std::uint64_t, CACHE_SIZE>;
+
+}
+
+BENCHMARK_TEMPLATE(find_hit, static_cache_type);
+BENCHMARK_TEMPLATE(find_hit, flat_static_cache_type);
+BENCHMARK_TEMPLATE(find_miss, static_cache_type);
+BENCHMARK_TEMPLATE(find_miss, flat_static_cache_type);
+BENCHMARK_TEMPLATE(insert_evict, static_cache_type);
+BENCHMARK_TEMPLATE(insert_evict, flat_static_cache_type);
+BENCHMARK_TEMPLATE(iterate, static_cache_type);
+BENCHMARK_TEMPLATE(iterate, flat_static_cache_type);
@@ -0,0 +1,222 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        intrusive_list_benchmark.cpp
+ * @brief       intrusive_list benchmark against std::list.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t N_TOUCHES = 1 << 20;
+
+struct node
+{
+    std::uint64_t val_ = 0;
+    
+    speed::containers::intrusive_list_hook<node> hk_;
+};
+
+using intrusive_list_type = speed::containers::intrusive_list<node, &node::hk_>;
+
+using std_list_type = std::list<std::uint64_t>;
+
+std::vector<std::size_t> make_indexes(std::size_t n_idxs, std::size_t n_elems)
+{
+    std::vector<std::size_t> idxs(n_idxs);
+    std::uint64_t seed = 0x9E3779B97F4A7C15ull;
+    
+    for (auto& idx : idxs)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        idx = seed % n_elems;
+    }
+    
+    return idxs;
+}
+
+void push_and_pop_intrusive_list(benchmark::State& state)
+{
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    std::vector<node> nds(n_elems);
+    std::uint64_t sum = 0;
+    
+    for (auto _ : state)
+    {
+        intrusive_list_type lst;
+        
+        for (auto& nd : nds)
+        {
+            lst.push_back(nd);
+        }
+        
+        while (!lst.empty())
+        {
+            sum += lst.front().val_;
+            lst.pop_front();
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * n_elems);
+}
+
+void push_and_pop_std_list(benchmark::State& state)
+{
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    std::uint64_t sum = 0;
+    
+    for (auto _ : state)
+    {
+        std_list_type lst;
+        
+        for (std::size_t i = 0; i < n_elems; ++i)
+        {
+            lst.push_back(i);
+        }
+        
+        while (!lst.empty())
+        {
+            sum += lst.front();
+            lst.pop_front();
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * n_elems);
+}
+
+void touch_intrusive_list(benchmark::State& state)
+{
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    const auto idxs = make_indexes(N_TOUCHES, n_elems);
+    std::vector<node> nds(n_elems);
+    intrusive_list_type lst;
+    
+    for (auto& nd : nds)
+    {
+        lst.push_back(nd);
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto idx : idxs)
+        {
+            lst.move_to_back(nds[idx]);
+        }
+    }
+    
+    benchmark::DoNotOptimize(lst.front().val_);
+    state.SetItemsProcessed(state.iterations() * N_TOUCHES);
+}
+
+void touch_std_list(benchmark::State& state)
+{
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    const auto idxs = make_indexes(N_TOUCHES, n_elems);
+    std::vector<std_list_type::iterator> its;
+    std_list_type lst;
+    
+    its.reserve(n_elems);
+    
+    for (std::size_t i = 0; i < n_elems; ++i)
+    {
+        its.push_back(lst.insert(lst.end(), i));
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto idx : idxs)
+        {
+            lst.splice(lst.end(), lst, its[idx]);
+        }
+    }
+    
+    benchmark::DoNotOptimize(lst.front());
+    state.SetItemsProcessed(state.iterations() * N_TOUCHES);
+}
+
+void iterate_intrusive_list(benchmark::State& state)
+{
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    std::vector<node> nds(n_elems);
+    intrusive_list_type lst;
+    std::uint64_t sum = 0;
+    
+    for (std::size_t i = 0; i < n_elems; ++i)
+    {
+        nds[i].val_ = i;
+        lst.push_back(nds[i]);
+    }
+    
+    for (auto _ : state)
+    {
+        for (const auto& nd : lst)
+        {
+            sum += nd.val_;
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * n_elems);
+}
+
+void iterate_std_list(benchmark::State& state)
+{
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    std_list_type lst;
+    std::uint64_t sum = 0;
+    
+    for (std::size_t i = 0; i < n_elems; ++i)
+    {
+        lst.push_back(i);
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto val : lst)
+        {
+            sum += val;
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * n_elems);
+}
+
+}
+
+BENCHMARK(push_and_pop_intrusive_list)->RangeMultiplier(32)->Range(1024, 1 << 20);
+BENCHMARK(push_and_pop_std_list)->RangeMultiplier(32)->Range(1024, 1 << 20);
+BENCHMARK(touch_intrusive_list)->RangeMultiplier(32)->Range(1024, 1 << 20);
+BENCHMARK(touch_std_list)->RangeMultiplier(32)->Range(1024, 1 << 20);
+BENCHMARK(iterate_intrusive_list)->RangeMultiplier(32)->Range(1024, 1 << 20);
+BENCHMARK(iterate_std_list)->RangeMultiplier(32)->Range(1024, 1 << 20);
@@ -0,0 +1,188 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        ordered_map_benchmark.cpp
+ * @brief       flat_map and btree_map benchmark against std::map.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t N_QUERIES = 1 << 16;
+
+using std_map_type = std::map<std::uint64_t, std::uint64_t>;
+
+using flat_map_type = speed::containers::flat_map<std::uint64_t, std::uint64_t>;
+
+using btree_map_type = speed::containers::btree_map<std::uint64_t, std::uint64_t>;
+
+std::vector<std::uint64_t> make_keys(std::size_t n_kys, std::uint64_t seed)
+{
+    std::vector<std::uint64_t> kys(n_kys);
+    
+    for (auto& ky : kys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        ky = seed;
+    }
+    
+    return kys;
+}
+
+template<typename MapT>
+MapT make_map(std::vector<std::uint64_t> kys)
+{
+    MapT map;
+    
+    std::sort(kys.begin(), kys.end());
+    
+    for (auto ky : kys)
+    {
+        map.emplace(ky, ky);
+    }
+    
+    return map;
+}
+
+template<typename MapT>
+void range_query(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    const auto scan_len = static_cast<std::size_t>(state.range(1));
+    auto map = make_map<MapT>(make_keys(n_kys, 0x9E3779B97F4A7C15ull));
+    auto query_kys = make_keys(N_QUERIES, 0xC2B2AE3D27D4EB4Full);
+    std::uint64_t sum = 0;
+    
+    for (auto _ : state)
+    {
+        for (auto ky : query_kys)
+        {
+            auto it = map.lower_bound(ky);
+            
+            for (std::size_t i = 0; i < scan_len && it != map.end(); ++i, ++it)
+            {
+                sum += it->second;
+            }
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * N_QUERIES);
+}
+
+template<typename MapT>
+void find_hit(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    auto map = make_map<MapT>(kys);
+    auto lookup_kys = make_keys(N_QUERIES, 0xC2B2AE3D27D4EB4Full);
+    std::uint64_t sum = 0;
+    
+    for (auto& ky : lookup_kys)
+    {
+        ky = kys[ky % n_kys];
+    }
+    
+    for (auto _ : state)
+    {
+        for (auto ky : lookup_kys)
+        {
+            sum += map.find(ky)->second;
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * N_QUERIES);
+}
+
+template<typename MapT>
+void random_insert(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    
+    for (auto _ : state)
+    {
+        MapT map;
+        
+        for (auto ky : kys)
+        {
+            map.emplace(ky, ky);
+        }
+        
+        benchmark::DoNotOptimize(map.size());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * n_kys);
+}
+
+void insert_range_flat_map(benchmark::State& state)
+{
+    const auto n_kys = static_cast<std::size_t>(state.range(0));
+    auto kys = make_keys(n_kys, 0x9E3779B97F4A7C15ull);
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> vals;
+    
+    vals.reserve(n_kys);
+    
+    for (auto ky : kys)
+    {
+        vals.emplace_back(ky, ky);
+    }
+    
+    for (auto _ : state)
+    {
+        flat_map_type map;
+        
+        map.insert_range(vals);
+        benchmark::DoNotOptimize(map.size());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * n_kys);
+}
+
+}
+
+BENCHMARK_TEMPLATE(range_query, std_map_type)
+        ->ArgsProduct({{1 << 10, 1 << 16, 1 << 20}, {16, 128}});
+BENCHMARK_TEMPLATE(range_query, flat_map_type)
+        ->ArgsProduct({{1 << 10, 1 << 16, 1 << 20}, {16, 128}});
+BENCHMARK_TEMPLATE(range_query, btree_map_type)
+        ->ArgsProduct({{1 << 10, 1 << 16, 1 << 20}, {16, 128}});
+BENCHMARK_TEMPLATE(find_hit, std_map_type)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(find_hit, flat_map_type)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(find_hit, btree_map_type)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(random_insert, std_map_type)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(random_insert, flat_map_type)->RangeMultiplier(64)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(random_insert, btree_map_type)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
+BENCHMARK(insert_range_flat_map)->RangeMultiplier(64)->Range(1 << 10, 1 << 20);
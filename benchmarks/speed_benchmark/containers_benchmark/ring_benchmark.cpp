@@ -0,0 +1,312 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        ring_benchmark.cpp
+ * @brief       spsc_ring and mpmc_ring benchmark against a mutex protected std::deque.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t N_MESSAGES = 1 << 20;
+
+constexpr std::size_t N_ROUND_TRIPS = 1 << 14;
+
+constexpr std::size_t RING_CAPACITY = 1024;
+
+constexpr std::size_t BULK_SIZE = 32;
+
+class locked_deque
+{
+public:
+    explicit locked_deque(std::size_t cap)
+            : cap_(cap)
+    {
+    }
+    
+    bool try_push(std::uint64_t val)
+    {
+        std::lock_guard lck(mtx_);
+        
+        if (deq_.size() == cap_)
+        {
+            return false;
+        }
+        
+        deq_.push_back(val);
+        
+        return true;
+    }
+    
+    bool try_pop(std::uint64_t& val)
+    {
+        std::lock_guard lck(mtx_);
+        
+        if (deq_.empty())
+        {
+            return false;
+        }
+        
+        val = deq_.front();
+        deq_.pop_front();
+        
+        return true;
+    }
+    
+private:
+    std::deque<std::uint64_t> deq_;
+    
+    std::mutex mtx_;
+    
+    std::size_t cap_;
+};
+
+template<typename QueueT>
+void push(QueueT& que, std::uint64_t val)
+{
+    while (!que.try_push(val))
+    {
+        std::this_thread::yield();
+    }
+}
+
+template<typename QueueT>
+std::uint64_t pop(QueueT& que)
+{
+    std::uint64_t val;
+    
+    while (!que.try_pop(val))
+    {
+        std::this_thread::yield();
+    }
+    
+    return val;
+}
+
+template<typename QueueT>
+void throughput(benchmark::State& state)
+{
+    const auto n_prods = static_cast<std::size_t>(state.range(0));
+    const auto n_conss = static_cast<std::size_t>(state.range(1));
+    const std::size_t n_msgs_per_prod = N_MESSAGES / n_prods;
+    const std::size_t n_msgs = n_msgs_per_prod * n_prods;
+    
+    for (auto _ : state)
+    {
+        QueueT que(RING_CAPACITY);
+        std::atomic<std::size_t> n_popped = 0;
+        std::atomic<std::uint64_t> sum = 0;
+        std::vector<std::thread> thrds;
+        
+        for (std::size_t i = 0; i < n_prods; ++i)
+        {
+            thrds.emplace_back([&]
+            {
+                for (std::size_t j = 0; j < n_msgs_per_prod; ++j)
+                {
+                    push(que, j);
+                }
+            });
+        }
+        
+        for (std::size_t i = 0; i < n_conss; ++i)
+        {
+            thrds.emplace_back([&]
+            {
+                std::uint64_t loc_sum = 0;
+                std::uint64_t val;
+                
+                while (n_popped.load(std::memory_order_relaxed) < n_msgs)
+                {
+                    if (que.try_pop(val))
+                    {
+                        loc_sum += val;
+                        n_popped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                
+                sum += loc_sum;
+            });
+        }
+        
+        for (auto& thrd : thrds)
+        {
+            thrd.join();
+        }
+        
+        benchmark::DoNotOptimize(sum.load());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * n_msgs);
+}
+
+template<typename QueueT>
+void bulk_throughput(benchmark::State& state)
+{
+    const auto n_prods = static_cast<std::size_t>(state.range(0));
+    const auto n_conss = static_cast<std::size_t>(state.range(1));
+    const std::size_t n_msgs_per_prod = N_MESSAGES / n_prods / BULK_SIZE * BULK_SIZE;
+    const std::size_t n_msgs = n_msgs_per_prod * n_prods;
+    
+    for (auto _ : state)
+    {
+        QueueT que(RING_CAPACITY);
+        std::atomic<std::size_t> n_popped = 0;
+        std::atomic<std::uint64_t> sum = 0;
+        std::vector<std::thread> thrds;
+        
+        for (std::size_t i = 0; i < n_prods; ++i)
+        {
+            thrds.emplace_back([&]
+            {
+                std::array<std::uint64_t, BULK_SIZE> vals;
+                std::size_t n_pushed;
+                
+                for (std::size_t j = 0; j < n_msgs_per_prod; j += BULK_SIZE)
+                {
+                    vals.fill(j);
+                    n_pushed = 0;
+                    
+                    while ((n_pushed += que.try_push_bulk(std::span(vals).subspan(n_pushed))) <
+                           BULK_SIZE)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        
+        for (std::size_t i = 0; i < n_conss; ++i)
+        {
+            thrds.emplace_back([&]
+            {
+                std::array<std::uint64_t, BULK_SIZE> vals;
+                std::uint64_t loc_sum = 0;
+                std::size_t n_vals;
+                
+                while (n_popped.load(std::memory_order_relaxed) < n_msgs)
+                {
+                    n_vals = que.try_pop_bulk(std::span(vals));
+                    
+                    if (n_vals == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    
+                    for (std::size_t j = 0; j < n_vals; ++j)
+                    {
+                        loc_sum += vals[j];
+                    }
+                    
+                    n_popped.fetch_add(n_vals, std::memory_order_relaxed);
+                }
+                
+                sum += loc_sum;
+            });
+        }
+        
+        for (auto& thrd : thrds)
+        {
+            thrd.join();
+        }
+        
+        benchmark::DoNotOptimize(sum.load());
+    }
+    
+    state.SetItemsProcessed(state.iterations() * n_msgs);
+}
+
+template<typename QueueT>
+void round_trip_latency(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        QueueT pings(RING_CAPACITY);
+        QueueT pongs(RING_CAPACITY);
+        std::uint64_t sum = 0;
+        
+        std::thread echo([&]
+        {
+            for (std::size_t i = 0; i < N_ROUND_TRIPS; ++i)
+            {
+                push(pongs, pop(pings));
+            }
+        });
+        
+        for (std::size_t i = 0; i < N_ROUND_TRIPS; ++i)
+        {
+            push(pings, i);
+            sum += pop(pongs);
+        }
+        
+        echo.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    
+    state.counters["round_trip"] = benchmark::Counter(
+            static_cast<double>(state.iterations() * N_ROUND_TRIPS),
+            benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+using spsc_ring_type = speed::containers::spsc_ring<std::uint64_t>;
+
+using mpmc_ring_type = speed::containers::mpmc_ring<std::uint64_t>;
+
+void producers_and_consumers(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"producers", "consumers"})
+            ->Args({1, 1})->Args({2, 2})->Args({4, 4})->Args({1, 4})->Args({4, 1})
+            ->UseRealTime();
+}
+
+}
+
+// Every thread yields when the queue is full or empty, so the results stay meaningful when there
+// are fewer cores than threads, but the lock-free queues only show their advantage when every
+// thread has a core of its own.
+BENCHMARK_TEMPLATE(throughput, locked_deque)->Apply(producers_and_consumers);
+BENCHMARK_TEMPLATE(throughput, mpmc_ring_type)->Apply(producers_and_consumers);
+BENCHMARK_TEMPLATE(throughput, spsc_ring_type)
+        ->ArgNames({"producers", "consumers"})->Args({1, 1})->UseRealTime();
+BENCHMARK_TEMPLATE(bulk_throughput, mpmc_ring_type)->Apply(producers_and_consumers);
+BENCHMARK_TEMPLATE(bulk_throughput, spsc_ring_type)
+        ->ArgNames({"producers", "consumers"})->Args({1, 1})->UseRealTime();
+BENCHMARK_TEMPLATE(round_trip_latency, locked_deque)->UseRealTime();
+BENCHMARK_TEMPLATE(round_trip_latency, mpmc_ring_type)->UseRealTime();
+BENCHMARK_TEMPLATE(round_trip_latency, spsc_ring_type)->UseRealTime();
@@ -0,0 +1,258 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        static_cache_benchmark.cpp
+ * @brief       static_cache benchmark.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+constexpr std::size_t CACHE_SIZE = 1 << 12;
+
+constexpr std::size_t LARGE_CACHE_SIZE = 1 << 20;
+
+constexpr std::size_t LOOKUP_BATCH_SIZE = 64;
+
+struct transparent_string_hash
+{
+    using is_transparent = void;
+    
+    std::size_t operator ()(std::string_view ky) const noexcept
+    {
+        return std::hash<std::string_view>()(ky);
+    }
+};
+
+std::vector<std::string> make_string_keys(std::size_t n_kys, std::uint64_t seed)
+{
+    std::vector<std::string> kys(n_kys);
+    
+    for (auto& ky : kys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        ky = "session/" + std::to_string(seed) + "/profile";
+    }
+    
+    return kys;
+}
+
+template<typename CacheT>
+void find_string_view(benchmark::State& state, std::uint64_t lookup_seed)
+{
+    auto cache = std::make_unique<CacheT>();
+    auto kys = make_string_keys(CACHE_SIZE, 0x9E3779B97F4A7C15ull);
+    auto lookup_kys = make_string_keys(CACHE_SIZE, lookup_seed);
+    std::size_t n_hits = 0;
+    
+    for (const auto& ky : kys)
+    {
+        cache->insert(ky, 1);
+    }
+    
+    for (auto _ : state)
+    {
+        for (const auto& ky : lookup_kys)
+        {
+            const std::string_view ky_vw = ky;
+            
+            if constexpr (CacheT::TRANSPARENT_LOOKUP)
+            {
+                n_hits += !cache->find(ky_vw).end();
+            }
+            else
+            {
+                n_hits += !cache->find(std::string(ky_vw)).end();
+            }
+        }
+    }
+    
+    benchmark::DoNotOptimize(n_hits);
+    state.SetItemsProcessed(state.iterations() * CACHE_SIZE);
+}
+
+template<typename CacheT>
+void find_string_view_hit(benchmark::State& state)
+{
+    find_string_view<CacheT>(state, 0x9E3779B97F4A7C15ull);
+}
+
+template<typename CacheT>
+void find_string_view_miss(benchmark::State& state)
+{
+    find_string_view<CacheT>(state, 0xC2B2AE3D27D4EB4Full);
+}
+
+std::vector<std::uint64_t> make_integer_keys(std::size_t n_kys, std::uint64_t seed)
+{
+    std::vector<std::uint64_t> kys(n_kys);
+    
+    for (auto& ky : kys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        ky = seed;
+    }
+    
+    return kys;
+}
+
+using large_cache_type = speed::containers::static_cache<
+        std::uint64_t, std::uint64_t, LARGE_CACHE_SIZE>;
+
+template<bool BATCH>
+void find_large(benchmark::State& state)
+{
+    auto cache = std::make_unique<large_cache_type>();
+    auto kys = make_integer_keys(LARGE_CACHE_SIZE, 0x9E3779B97F4A7C15ull);
+    auto idxs = make_integer_keys(LARGE_CACHE_SIZE, 0xC2B2AE3D27D4EB4Full);
+    std::vector<std::uint64_t> lookup_kys(LARGE_CACHE_SIZE);
+    std::array<large_cache_type::iterator, LOOKUP_BATCH_SIZE> its;
+    std::size_t offs = 0;
+    std::uint64_t sum = 0;
+    
+    for (const auto& ky : kys)
+    {
+        cache->insert(ky, ky);
+    }
+    
+    for (std::size_t i = 0; i < LARGE_CACHE_SIZE; ++i)
+    {
+        lookup_kys[i] = kys[idxs[i] & (LARGE_CACHE_SIZE - 1)];
+    }
+    
+    for (auto _ : state)
+    {
+        const std::span<const std::uint64_t> batch_kys(&lookup_kys[offs], LOOKUP_BATCH_SIZE);
+        
+        if constexpr (BATCH)
+        {
+            cache->find_batch(batch_kys, its);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < LOOKUP_BATCH_SIZE; ++i)
+            {
+                its[i] = cache->find(batch_kys[i]);
+            }
+        }
+        
+        for (auto& it : its)
+        {
+            sum += *it;
+        }
+        
+        offs = (offs + LOOKUP_BATCH_SIZE) & (LARGE_CACHE_SIZE - 1);
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * LOOKUP_BATCH_SIZE);
+}
+
+void iterate_large(benchmark::State& state)
+{
+    auto cache = std::make_unique<large_cache_type>();
+    auto kys = make_integer_keys(LARGE_CACHE_SIZE, 0x9E3779B97F4A7C15ull);
+    std::uint64_t sum = 0;
+    
+    for (const auto& ky : kys)
+    {
+        cache->insert(ky, ky);
+    }
+    
+    for (auto _ : state)
+    {
+        for (const auto& val : *cache)
+        {
+            sum += val;
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * LARGE_CACHE_SIZE);
+}
+
+template<typename StatisticsT>
+void find_integer_hit(benchmark::State& state)
+{
+    using cache_type = speed::containers::static_cache<
+            std::uint64_t,
+            std::uint64_t,
+            CACHE_SIZE,
+            std::hash<std::uint64_t>,
+            std::equal_to<std::uint64_t>,
+            speed::containers::lru_eviction_policy,
+            StatisticsT
+    >;
+    
+    auto cache = std::make_unique<cache_type>();
+    auto kys = make_integer_keys(CACHE_SIZE, 0x9E3779B97F4A7C15ull);
+    std::uint64_t sum = 0;
+    
+    for (const auto& ky : kys)
+    {
+        cache->insert(ky, ky);
+    }
+    
+    for (auto _ : state)
+    {
+        for (const auto& ky : kys)
+        {
+            sum += *cache->find(ky);
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * CACHE_SIZE);
+}
+
+using opaque_string_cache_type = speed::containers::static_cache<
+        std::string, std::uint32_t, CACHE_SIZE>;
+
+using transparent_string_cache_type = speed::containers::static_cache<
+        std::string, std::uint32_t, CACHE_SIZE, transparent_string_hash, std::equal_to<>>;
+
+}
+
+BENCHMARK_TEMPLATE(find_string_view_hit, opaque_string_cache_type);
+BENCHMARK_TEMPLATE(find_string_view_hit, transparent_string_cache_type);
+BENCHMARK_TEMPLATE(find_string_view_miss, opaque_string_cache_type);
+BENCHMARK_TEMPLATE(find_string_view_miss, transparent_string_cache_type);
+BENCHMARK_TEMPLATE(find_large, false);
+BENCHMARK_TEMPLATE(find_large, true);
+BENCHMARK(iterate_large);
+BENCHMARK_TEMPLATE(find_integer_hit, speed::containers::no_statistics_policy);
+BENCHMARK_TEMPLATE(find_integer_hit, speed::containers::sharded_statistics_policy);
@@ -0,0 +1,227 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        allocator_benchmark.cpp
+ * @brief       monotonic_allocator and pool_allocator benchmark against std::allocator.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/memory/memory.hpp"
+
+namespace {
+
+template<typename AllocatorT>
+using map_type = std::map<std::uint64_t, std::uint64_t, std::less<>,
+                          typename std::allocator_traits<AllocatorT>::template rebind_alloc<
+                                  std::pair<const std::uint64_t, std::uint64_t>>>;
+
+template<typename AllocatorT>
+using string_type = std::basic_string<
+        char, std::char_traits<char>,
+        typename std::allocator_traits<AllocatorT>::template rebind_alloc<char>>;
+
+std::vector<std::uint64_t> make_keys(std::size_t n_keys)
+{
+    std::vector<std::uint64_t> kys(n_keys);
+    std::uint64_t seed = 0x9E3779B97F4A7C15ull;
+    
+    for (auto& ky : kys)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        ky = seed * 0xC2B2AE3D27D4EB4Full;
+    }
+    
+    return kys;
+}
+
+template<typename AllocatorT>
+void fill_map(const std::vector<std::uint64_t>& kys)
+{
+    map_type<AllocatorT> mp;
+    
+    for (const auto& ky : kys)
+    {
+        mp.emplace(ky, ky);
+    }
+    
+    benchmark::DoNotOptimize(mp.size());
+}
+
+template<typename AllocatorT>
+void fill_strings(const std::vector<std::uint64_t>& kys)
+{
+    std::vector<string_type<AllocatorT>, typename std::allocator_traits<
+            AllocatorT>::template rebind_alloc<string_type<AllocatorT>>> strs;
+    
+    for (const auto& ky : kys)
+    {
+        strs.emplace_back(24 + ky % 40, static_cast<char>('a' + ky % 26));
+    }
+    
+    benchmark::DoNotOptimize(strs.data());
+}
+
+void map_std_allocator(benchmark::State& state)
+{
+    const auto kys = make_keys(static_cast<std::size_t>(state.range(0)));
+    
+    for (auto _ : state)
+    {
+        fill_map<std::allocator<std::uint64_t>>(kys);
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kys.size()));
+    state.counters["upstream_allocs"] = static_cast<double>(kys.size());
+}
+
+void map_monotonic_allocator(benchmark::State& state)
+{
+    const auto kys = make_keys(static_cast<std::size_t>(state.range(0)));
+    speed::memory::monotonic_arena arna(1 << 16);
+    speed::memory::resource_scope<speed::memory::monotonic_arena> scp(arna);
+    std::size_t n_blks = 0;
+    
+    for (auto _ : state)
+    {
+        fill_map<speed::memory::monotonic_allocator<std::uint64_t>>(kys);
+        n_blks = arna.get_block_count();
+        arna.release();
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kys.size()));
+    state.counters["upstream_allocs"] = static_cast<double>(n_blks);
+}
+
+void map_pool_allocator(benchmark::State& state)
+{
+    const auto kys = make_keys(static_cast<std::size_t>(state.range(0)));
+    speed::memory::fixed_block_pool pool(64, 1024);
+    speed::memory::resource_scope<speed::memory::fixed_block_pool> scp(pool);
+    
+    for (auto _ : state)
+    {
+        fill_map<speed::memory::pool_allocator<std::uint64_t>>(kys);
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kys.size()));
+    state.counters["upstream_allocs"] = static_cast<double>(pool.get_chunk_count());
+}
+
+void strings_std_allocator(benchmark::State& state)
+{
+    const auto kys = make_keys(static_cast<std::size_t>(state.range(0)));
+    
+    for (auto _ : state)
+    {
+        fill_strings<std::allocator<char>>(kys);
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kys.size()));
+}
+
+void strings_monotonic_allocator(benchmark::State& state)
+{
+    const auto kys = make_keys(static_cast<std::size_t>(state.range(0)));
+    speed::memory::monotonic_arena arna(1 << 16);
+    speed::memory::resource_scope<speed::memory::monotonic_arena> scp(arna);
+    std::size_t n_blks = 0;
+    
+    for (auto _ : state)
+    {
+        fill_strings<speed::memory::monotonic_allocator<char>>(kys);
+        n_blks = arna.get_block_count();
+        arna.release();
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kys.size()));
+    state.counters["upstream_allocs"] = static_cast<double>(n_blks);
+}
+
+void allocate_latency_std_allocator(benchmark::State& state)
+{
+    std::allocator<std::uint64_t> alloc;
+    
+    for (auto _ : state)
+    {
+        std::uint64_t* ptr = alloc.allocate(4);
+        benchmark::DoNotOptimize(ptr);
+        alloc.deallocate(ptr, 4);
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+void allocate_latency_pool_allocator(benchmark::State& state)
+{
+    speed::memory::fixed_block_pool pool(32);
+    speed::memory::pool_allocator<std::uint64_t> alloc(pool);
+    
+    for (auto _ : state)
+    {
+        std::uint64_t* ptr = alloc.allocate(4);
+        benchmark::DoNotOptimize(ptr);
+        alloc.deallocate(ptr, 4);
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+void allocate_latency_monotonic_allocator(benchmark::State& state)
+{
+    speed::memory::monotonic_arena arna(1 << 16);
+    speed::memory::monotonic_allocator<std::uint64_t> alloc(arna);
+    std::size_t n_allocs = 0;
+    
+    for (auto _ : state)
+    {
+        std::uint64_t* ptr = alloc.allocate(4);
+        benchmark::DoNotOptimize(ptr);
+        
+        if (++n_allocs == 1024)
+        {
+            n_allocs = 0;
+            arna.release();
+        }
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+}
+
+BENCHMARK(map_std_allocator)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(map_monotonic_allocator)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(map_pool_allocator)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(strings_std_allocator)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(strings_monotonic_allocator)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(allocate_latency_std_allocator);
+BENCHMARK(allocate_latency_pool_allocator);
+BENCHMARK(allocate_latency_monotonic_allocator);
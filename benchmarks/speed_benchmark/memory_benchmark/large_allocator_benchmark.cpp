@@ -0,0 +1,103 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        large_allocator_benchmark.cpp
+ * @brief       large_allocator random access benchmark against std::allocator.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/memory/memory.hpp"
+
+namespace {
+
+constexpr std::size_t N_ACCESSES = 1 << 16;
+
+void random_access(benchmark::State& state, const std::uint64_t* tbl, std::size_t n_elems)
+{
+    std::uint64_t seed = 0x9E3779B97F4A7C15ull;
+    std::uint64_t sum = 0;
+    
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < N_ACCESSES; ++i)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            sum += tbl[(seed * 0xC2B2AE3D27D4EB4Full) % n_elems];
+        }
+    }
+    
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N_ACCESSES));
+}
+
+void random_access_std_allocator(benchmark::State& state)
+{
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    std::vector<std::uint64_t> tbl(n_elems, 1);
+    
+    random_access(state, tbl.data(), n_elems);
+}
+
+void random_access_large_allocator(benchmark::State& state)
+{
+    using speed::memory::mf_t;
+    
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    const speed::memory::large_allocator<std::uint64_t> alloc(
+            mf_t::TRANSPARENT_HUGE_PAGES | mf_t::POPULATE);
+    std::vector<std::uint64_t, speed::memory::large_allocator<std::uint64_t>> tbl(
+            n_elems, 1, alloc);
+    
+    random_access(state, tbl.data(), n_elems);
+}
+
+void random_access_mapped_region(benchmark::State& state)
+{
+    using speed::memory::mf_t;
+    
+    const auto n_elems = static_cast<std::size_t>(state.range(0));
+    const auto flgs = static_cast<speed::memory::mapping_flags>(state.range(1));
+    speed::memory::mapped_region reg(n_elems * sizeof(std::uint64_t), flgs | mf_t::POPULATE);
+    auto* tbl = static_cast<std::uint64_t*>(reg.get_data());
+    
+    std::uninitialized_fill_n(tbl, n_elems, 1);
+    random_access(state, tbl, n_elems);
+    
+    state.counters["page_size"] = static_cast<double>(reg.get_page_size());
+    state.counters["transparent_huge_pages"] = reg.has_transparent_huge_pages() ? 1 : 0;
+}
+
+}
+
+BENCHMARK(random_access_std_allocator)->Arg(1 << 20)->Arg(1 << 24);
+BENCHMARK(random_access_large_allocator)->Arg(1 << 20)->Arg(1 << 24);
+BENCHMARK(random_access_mapped_region)
+        ->Args({1 << 24, static_cast<std::int64_t>(speed::memory::mf_t::NIL)})
+        ->Args({1 << 24, static_cast<std::int64_t>(speed::memory::mf_t::TRANSPARENT_HUGE_PAGES)})
+        ->Args({1 << 24, static_cast<std::int64_t>(speed::memory::mf_t::EXPLICIT_HUGE_PAGES)});
@@ -0,0 +1,135 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        thread_caching_heap_benchmark.cpp
+ * @brief       thread_caching_heap multi-threaded benchmark against the global operator new.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "speed/containers/containers.hpp"
+#include "speed/memory/memory.hpp"
+
+namespace {
+
+constexpr std::size_t N_LIVE_BLOCKS = 256;
+
+constexpr std::size_t CROSS_THREAD_BLOCK_SIZE = 64;
+
+speed::containers::mpmc_ring<void*> cross_thread_ring(1 << 14);
+
+std::vector<std::size_t> make_sizes(std::size_t n_szs)
+{
+    std::vector<std::size_t> szs(n_szs);
+    std::uint64_t seed = 0x9E3779B97F4A7C15ull;
+    
+    for (auto& sz : szs)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        sz = 16 + (seed * 0xC2B2AE3D27D4EB4Full) % 241;
+    }
+    
+    return szs;
+}
+
+struct operator_new_heap
+{
+    static void* allocate(std::size_t sz)
+    {
+        return ::operator new(sz);
+    }
+    
+    static void deallocate(void* ptr, std::size_t sz) noexcept
+    {
+        ::operator delete(ptr, sz);
+    }
+};
+
+template<typename HeapT>
+void allocate_and_free(benchmark::State& state)
+{
+    const auto szs = make_sizes(N_LIVE_BLOCKS);
+    std::vector<void*> ptrs(N_LIVE_BLOCKS);
+    
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < N_LIVE_BLOCKS; ++i)
+        {
+            ptrs[i] = HeapT::allocate(szs[i]);
+        }
+        
+        benchmark::DoNotOptimize(ptrs.data());
+        
+        for (std::size_t i = 0; i < N_LIVE_BLOCKS; ++i)
+        {
+            HeapT::deallocate(ptrs[i], szs[i]);
+        }
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N_LIVE_BLOCKS));
+}
+
+template<typename HeapT>
+void allocate_and_free_cross_thread(benchmark::State& state)
+{
+    std::vector<void*> ptrs(N_LIVE_BLOCKS);
+    
+    // Each thread frees as many blocks as it allocates, but takes them from a ring shared by all
+    // the threads, so most of them were allocated by another thread.
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < N_LIVE_BLOCKS; ++i)
+        {
+            while (!cross_thread_ring.try_push(HeapT::allocate(CROSS_THREAD_BLOCK_SIZE)))
+            {
+            }
+        }
+        
+        for (auto& ptr : ptrs)
+        {
+            while (!cross_thread_ring.try_pop(ptr))
+            {
+            }
+            
+            HeapT::deallocate(ptr, CROSS_THREAD_BLOCK_SIZE);
+        }
+    }
+    
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N_LIVE_BLOCKS));
+}
+
+}
+
+BENCHMARK_TEMPLATE(allocate_and_free, operator_new_heap)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(allocate_and_free, speed::memory::thread_caching_heap)
+        ->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(allocate_and_free_cross_thread, operator_new_heap)
+        ->ThreadRange(2, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(allocate_and_free_cross_thread, speed::memory::thread_caching_heap)
+        ->ThreadRange(2, 8)->UseRealTime();
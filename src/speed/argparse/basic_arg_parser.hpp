@@ -31,8 +31,6 @@
 #include <memory>
 #include <string>
 #include <string_view>
-#include <unordered_map>
-#include <unordered_set>
 #include <span>
 #include <vector>
 
@@ -82,7 +80,7 @@ public:
     
     /** Shared pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
 
     /** String type used in the class. */
     using string_type = std::basic_string<char, std::char_traits<char>, allocator_type<char>>;
@@ -100,16 +98,16 @@ public:
 
     /** Unordered map type used in the class. */
     template<typename KeyT_, typename ValueT_>
-    using unordered_map_type = std::unordered_map<
-            KeyT_, ValueT_, std::hash<KeyT_>,
-            std::equal_to<KeyT_>,
+    using unordered_map_type = containers::flat_hash_map<
+            KeyT_, ValueT_, containers::flat_hash<KeyT_>,
+            std::equal_to<>,
             allocator_type<std::pair<const KeyT_, ValueT_>>>;
 
     /** Unordered set type used in the class. */
     template<typename KeyT_>
-    using unordered_set_type = std::unordered_set<
-            KeyT_, std::hash<KeyT_>,
-            std::equal_to<KeyT_>,
+    using unordered_set_type = containers::flat_hash_set<
+            KeyT_, containers::flat_hash<KeyT_>,
+            std::equal_to<>,
             allocator_type<KeyT_>>;
     
     /** Span type used in the class. */
@@ -64,6 +64,10 @@ public:
     template<typename T>
     using vector_type = std::vector<T, allocator_type<T>>;
 
+    /** Vector type that holds up to N elements without allocating. */
+    template<typename T, std::size_t N>
+    using small_vector_type = containers::small_vector<T, N, allocator_type<T>>;
+
     /** Class that represents a bit field */
     template<typename T>
     using flags_type = containers::flags<T>;
@@ -151,7 +155,7 @@ public:
      * @param       bse_args : The objects to check whether they are contained.
      * @return      If function was successful true is returned, otherwise false is returned.
      */
-    [[nodiscard]] bool contains_any_of(vector_type<base_arg_type*> bse_args) const noexcept
+    [[nodiscard]] bool contains_any_of(const vector_type<base_arg_type*>& bse_args) const noexcept
     {
         return std::ranges::any_of(bse_args, [&](base_arg_type* bse_arg) {
             return std::ranges::find(bse_args_, bse_arg) != bse_args_.end();
@@ -450,7 +454,7 @@ private:
 
 private:
     /** The arguments in which apply the dependencies. */
-    vector_type<base_arg_type*> bse_args_;
+    small_vector_type<base_arg_type*, 4> bse_args_;
 
     /** Holds a reference to the composite object. */
     arg_parser_type* arg_parsr_;
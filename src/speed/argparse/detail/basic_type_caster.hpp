@@ -41,6 +41,7 @@
 #include <utility>
 #include <vector>
 
+#include "../../memory/memory.hpp"
 #include "../../type_casting/type_casting.hpp"
 #include "type_traits.hpp"
 
@@ -264,7 +265,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
     
     /** Array type used in the class. */
     using array_type = std::array<target_type, SIZE>;
@@ -401,7 +402,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
     
     /** Vector type used in the class. */
     using vector_type = std::vector<target_type, allocator_type<target_type>>;
@@ -530,7 +531,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
     
     /** Deque type used in the class. */
     using deque_type = std::deque<target_type, AllocatorT>;
@@ -663,7 +664,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
     
     /** Deque type used in the class. */
     using queue_type = std::queue<target_type, container_type>;
@@ -855,7 +856,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
 
     /** Stack type used in the class. */
     using stack_type = std::stack<target_type, container_type>;
@@ -991,7 +992,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
 
     /** Forward list type used in the class. */
     using forward_list_type = std::forward_list<target_type, AllocatorT>;
@@ -1125,7 +1126,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
 
     /** Forward list type used in the class. */
     using list_type = std::list<target_type, AllocatorT>;
@@ -1394,7 +1395,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
     
     /** Tuple type used in the class. */
     using pair_type = std::tuple<TargetT1, TargetT2>;
@@ -1476,7 +1477,7 @@ public:
     
     /** Unique pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
     
     /** Tuple type used in the class. */
     using tuple_type = std::tuple<TargetTs...>;
@@ -34,6 +34,7 @@
 #include <vector>
 
 #include "forward_declarations.hpp"
+#include "../../containers/small_vector.hpp"
 #include "../../type_casting/type_casting.hpp"
 #include "../basic_arg_parser.hpp"
 #include "../exception.hpp"
@@ -58,7 +59,7 @@ public:
     
     /** Shared pointer type used in the class. */
     template<typename T>
-    using unique_ptr_type = std::unique_ptr<T>;
+    using unique_ptr_type = std::unique_ptr<T, memory::allocator_delete<T, allocator_type<T>>>;
 
     /** String type used in the class. */
     using string_type = std::basic_string<char, std::char_traits<char>, allocator_type<char>>;
@@ -74,6 +75,10 @@ public:
     template<typename T>
     using vector_type = std::vector<T, allocator_type<T>>;
 
+    /** Vector type that holds up to N elements without allocating. */
+    template<typename T, std::size_t N>
+    using small_vector_type = containers::small_vector<T, N, allocator_type<T>>;
+
     /** Forward list type used in the class. */
     template<typename T>
     using list_type = std::list<T, allocator_type<T>>;
@@ -707,13 +712,13 @@ protected:
 
 private:
     /** Collection that has the values gotten through the program call for an argument. */
-    vector_type<arg_value_type> vals_;
+    small_vector_type<arg_value_type, 4> vals_;
     
     /** Virtual total number of values. */
-    vector_type<std::size_t> nr_vals_;
+    small_vector_type<std::size_t, 2> nr_vals_;
     
     /** Type casters used to validate the values syntax. */
-    vector_type<unique_ptr_type<type_caster_base_type>> castrs_;
+    small_vector_type<unique_ptr_type<type_caster_base_type>, 1> castrs_;
     
     /** Functions to execute in order to know if the values are valid. */
     list_type<assertion_type> assertns_;
@@ -0,0 +1,304 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       arc_eviction_policy.hpp
+ * @brief      arc_eviction_policy class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_ARC_EVICTION_POLICY_HPP
+#define SPEED_CONTAINERS_ARC_EVICTION_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "detail/eviction_list.hpp"
+#include "detail/ghost_list.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents an adaptive replacement cache (ARC) eviction policy. The
+ *              keys seen once are kept in the recency list T1 and the keys seen at least twice
+ *              in the frequency list T2. The hashes of the keys evicted from them are remembered
+ *              in the ghost lists B1 and B2, and inserting a key found in a ghost list moves the
+ *              target size of T1 towards the list that would have kept it. The victim has to be
+ *              chosen before the key being inserted is known, so unlike the original algorithm
+ *              the adaptation only takes effect from the next eviction.
+ */
+template<typename NodeT>
+class arc_eviction_policy
+{
+public:
+    /** The node type. */
+    using node_type = NodeT;
+
+    /** Whether on_hit can be called by several readers at once. */
+    static constexpr bool CONCURRENT_HITS = false;
+
+    /**
+     * @brief       Contains the lists in which a node can be.
+     */
+    enum class segment : std::uint8_t
+    {
+        /** The node doesn't hold any key. */
+        FREE,
+
+        /** The node is in the recency list. */
+        T1,
+
+        /** The node is in the frequency list. */
+        T2
+    };
+
+    /**
+     * @brief       Struct that represents the state kept in every node.
+     */
+    struct hook_type
+    {
+        /** Pointer to the next node in the list. */
+        node_type* av_nxt_;
+
+        /** Pointer to the previous node in the list. */
+        node_type* av_prev_;
+
+        /** The hash of the node key. */
+        std::size_t hsh_;
+
+        /** The list of the node. */
+        segment sgmt_;
+    };
+
+    /**
+     * @brief       Make the specified nodes free and available.
+     * @param       nds : The first node.
+     * @param       n_nds : The number of nodes.
+     */
+    void initialize(node_type* nds, std::size_t n_nds)
+    {
+        free_.clear();
+        t1_.clear();
+        t2_.clear();
+        b1_.initialize(n_nds);
+        b2_.initialize(n_nds);
+        cap_ = n_nds;
+        p_ = 0;
+
+        for (std::size_t i = 0; i < n_nds; i++)
+        {
+            nds[i].plcy_hk_.sgmt_ = segment::FREE;
+            free_.push_back(&nds[i]);
+        }
+    }
+
+    /**
+     * @brief       Get the node to recycle, the least recently used node of T1 if T1 exceeds its
+     *              target size and the least recently used node of T2 otherwise.
+     * @return      The node to recycle, or nullptr if there is no available node.
+     */
+    node_type* get_victim() const noexcept
+    {
+        if (!free_.empty())
+        {
+            return free_.front();
+        }
+
+        if (!t1_.empty() && (t1_.size() > p_ || t2_.empty()))
+        {
+            return t1_.front();
+        }
+
+        return t2_.front();
+    }
+
+    /**
+     * @brief       Notify that the victim holds a new key. The hash of the evicted key goes to
+     *              the ghost list of its list. A key found in B1 or B2 adapts the target size of
+     *              T1 and enters T2, any other key enters T1.
+     * @param       nd : The victim.
+     * @param       hsh : The hash of the new key.
+     */
+    void on_insert(node_type* nd, std::size_t hsh) noexcept
+    {
+        switch (nd->plcy_hk_.sgmt_)
+        {
+            case segment::T1:
+                t1_.erase(nd);
+                b1_.push_back(nd->plcy_hk_.hsh_);
+                break;
+
+            case segment::T2:
+                t2_.erase(nd);
+                b2_.push_back(nd->plcy_hk_.hsh_);
+                break;
+
+            default:
+                free_.erase(nd);
+                break;
+        }
+
+        nd->plcy_hk_.hsh_ = hsh;
+
+        if (b1_.erase(hsh))
+        {
+            const std::size_t dlt = b1_.size() < b2_.size() ? b2_.size() / (b1_.size() + 1) : 1;
+
+            p_ = p_ + dlt < cap_ ? p_ + dlt : cap_;
+            nd->plcy_hk_.sgmt_ = segment::T2;
+            t2_.push_back(nd);
+        }
+        else if (b2_.erase(hsh))
+        {
+            const std::size_t dlt = b2_.size() < b1_.size() ? b1_.size() / (b2_.size() + 1) : 1;
+
+            p_ = p_ > dlt ? p_ - dlt : 0;
+            nd->plcy_hk_.sgmt_ = segment::T2;
+            t2_.push_back(nd);
+        }
+        else
+        {
+            nd->plcy_hk_.sgmt_ = segment::T1;
+            t1_.push_back(nd);
+        }
+
+        while (t1_.size() + b1_.size() > cap_ && b1_.size() > 0)
+        {
+            b1_.pop_front();
+        }
+
+        while (t1_.size() + t2_.size() + b1_.size() + b2_.size() > 2 * cap_ && b2_.size() > 0)
+        {
+            b2_.pop_front();
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been found, it moves to the end of T2.
+     * @param       nd : The node found.
+     */
+    void on_hit(node_type* nd) noexcept
+    {
+        if (nd->plcy_hk_.sgmt_ == segment::T1)
+        {
+            t1_.erase(nd);
+            nd->plcy_hk_.sgmt_ = segment::T2;
+            t2_.push_back(nd);
+        }
+        else
+        {
+            t2_.move_to_back(nd);
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been locked.
+     * @param       nd : The node locked.
+     */
+    void on_lock(node_type* nd) noexcept
+    {
+        get_segment_list(nd->plcy_hk_.sgmt_).erase(nd);
+    }
+
+    /**
+     * @brief       Notify that a locked node has been unlocked.
+     * @param       nd : The node unlocked.
+     */
+    void on_unlock(node_type* nd) noexcept
+    {
+        get_segment_list(nd->plcy_hk_.sgmt_).push_back(nd);
+    }
+
+    /**
+     * @brief       Notify that an available node no longer holds a key. It becomes free, so it is
+     *              the next one to be recycled.
+     * @param       nd : The node erased.
+     */
+    void on_erase(node_type* nd) noexcept
+    {
+        get_segment_list(nd->plcy_hk_.sgmt_).erase(nd);
+        nd->plcy_hk_.sgmt_ = segment::FREE;
+        free_.push_back(nd);
+    }
+
+    /**
+     * @brief       Call a function on every available node without modifying the policy. The free
+     *              nodes come first, followed by T1 and T2, each one from its least recently used
+     *              node.
+     * @param       fnc : The function to call.
+     */
+    template<typename FunctionT_>
+    void for_each_in_eviction_order(FunctionT_&& fnc) const
+    {
+        free_.for_each(fnc);
+        t1_.for_each(fnc);
+        t2_.for_each(fnc);
+    }
+
+protected:
+    /** The list type. */
+    using list_type = detail::eviction_list<node_type>;
+
+    /**
+     * @brief       Get the list of a segment.
+     * @param       sgmt : The segment.
+     * @return      The list of the segment.
+     */
+    list_type& get_segment_list(segment sgmt) noexcept
+    {
+        switch (sgmt)
+        {
+            case segment::T1:
+                return t1_;
+
+            case segment::T2:
+                return t2_;
+
+            default:
+                return free_;
+        }
+    }
+
+private:
+    /** The nodes that don't hold any key. */
+    list_type free_;
+
+    /** The recency list. */
+    list_type t1_;
+
+    /** The frequency list. */
+    list_type t2_;
+
+    /** The hashes of the keys evicted from T1. */
+    detail::ghost_list b1_;
+
+    /** The hashes of the keys evicted from T2. */
+    detail::ghost_list b2_;
+
+    /** The number of nodes. */
+    std::size_t cap_ = 0;
+
+    /** The target size of T1. */
+    std::size_t p_ = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,424 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       bloom_filter.hpp
+ * @brief      bloom_filter class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_BLOOM_FILTER_HPP
+#define SPEED_CONTAINERS_BLOOM_FILTER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "exception.hpp"
+#include "filter_hash.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SPEED_CONTAINERS_AVX2 1
+#endif
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a blocked Bloom filter. Each key sets one bit in each of the
+ *              eight words of a single 256 bit block, so an insertion or a lookup touches one
+ *              cache line, and the eight bits are computed and tested at once with AVX2 when it
+ *              is available. A lookup never gives a false negative, and gives a false positive
+ *              with a rate that depends on the number of blocks per inserted key. The keys can't
+ *              be erased.
+ */
+template<
+        typename KeyT,
+        typename HashT = filter_hash<KeyT>,
+        typename AllocatorT = std::allocator<KeyT>
+>
+class bloom_filter
+{
+public:
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The hash type. */
+    using hasher = HashT;
+
+    /** The allocator type. */
+    using allocator_type = AllocatorT;
+
+    /** The number of words of a block. */
+    static constexpr std::size_t WORDS_PER_BLOCK = 8;
+
+    /** The number of bits of a word. */
+    static constexpr std::size_t WORD_BITS = 32;
+
+    /** The maximum number of blocks, as the block index is taken from 32 bits of the hash. */
+    static constexpr std::size_t MAX_BLOCK_COUNT = static_cast<std::size_t>(std::min<std::uint64_t>(
+            std::uint64_t(1) << 32, std::numeric_limits<std::size_t>::max()));
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       n_blks : The number of blocks.
+     * @param       hsh : The hash function.
+     * @param       alloc : The allocator.
+     * @throw       out_of_range_exception : If the number of blocks is zero or greater than
+     *              MAX_BLOCK_COUNT.
+     */
+    explicit bloom_filter(
+            std::size_t n_blks,
+            const hasher& hsh = hasher(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : blks_(check_block_count(n_blks), block(), block_allocator_type(alloc))
+            , hsh_(hsh)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters. The filter gets the smallest number of blocks
+     *              whose false positive rate with the given number of keys is not greater than
+     *              the target.
+     * @param       n_elems : The number of keys that will be inserted.
+     * @param       fpr : The target false positive rate.
+     * @param       hsh : The hash function.
+     * @param       alloc : The allocator.
+     * @throw       out_of_range_exception : If the target can't be reached.
+     */
+    bloom_filter(
+            std::size_t n_elems,
+            double fpr,
+            const hasher& hsh = hasher(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : bloom_filter(get_block_count(n_elems, fpr), hsh, alloc)
+    {
+    }
+
+    /**
+     * @brief       Insert a key.
+     * @param       ky : The key.
+     */
+    template<typename KeyT_ = key_type>
+    void insert(const KeyT_& ky)
+    {
+        insert_hash(hsh_(ky));
+    }
+
+    /**
+     * @brief       Insert a key from its hash.
+     * @param       hsh : The hash of the key.
+     */
+    void insert_hash(std::uint64_t hsh) noexcept
+    {
+        block& blk = get_block(hsh);
+
+#ifdef SPEED_CONTAINERS_AVX2
+        auto* ptr = reinterpret_cast<__m256i*>(blk.wrds_);
+
+        _mm256_store_si256(ptr, _mm256_or_si256(_mm256_load_si256(ptr), make_mask(hsh)));
+#else
+        const block msk = make_mask(hsh);
+
+        for (std::size_t i = 0; i < WORDS_PER_BLOCK; ++i)
+        {
+            blk.wrds_[i] |= msk.wrds_[i];
+        }
+#endif
+    }
+
+    /**
+     * @brief       Allows knowing whether a key may have been inserted.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename KeyT_ = key_type>
+    [[nodiscard]] bool contains(const KeyT_& ky) const
+    {
+        return contains_hash(hsh_(ky));
+    }
+
+    /**
+     * @brief       Allows knowing whether a key may have been inserted from its hash.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool contains_hash(std::uint64_t hsh) const noexcept
+    {
+        const block& blk = get_block(hsh);
+
+#ifdef SPEED_CONTAINERS_AVX2
+        return _mm256_testc_si256(
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(blk.wrds_)),
+                make_mask(hsh)) != 0;
+#else
+        const block msk = make_mask(hsh);
+        std::uint32_t miss = 0;
+
+        for (std::size_t i = 0; i < WORDS_PER_BLOCK; ++i)
+        {
+            miss |= msk.wrds_[i] & ~blk.wrds_[i];
+        }
+
+        return miss == 0;
+#endif
+    }
+
+    /**
+     * @brief       Erase all the keys.
+     */
+    void clear() noexcept
+    {
+        std::fill(blks_.begin(), blks_.end(), block());
+    }
+
+    /**
+     * @brief       Get the number of blocks.
+     * @return      The number of blocks.
+     */
+    [[nodiscard]] std::size_t get_block_count() const noexcept
+    {
+        return blks_.size();
+    }
+
+    /**
+     * @brief       Get the number of bytes used by the blocks.
+     * @return      The number of bytes used by the blocks.
+     */
+    [[nodiscard]] std::size_t get_memory_size() const noexcept
+    {
+        return blks_.size() * sizeof(block);
+    }
+
+    /**
+     * @brief       Get the expected false positive rate after inserting a number of keys.
+     * @param       n_elems : The number of keys.
+     * @return      The expected false positive rate.
+     */
+    [[nodiscard]] double estimate_false_positive_rate(std::size_t n_elems) const noexcept
+    {
+        return estimate_false_positive_rate(blks_.size(), n_elems);
+    }
+
+    /**
+     * @brief       Get the expected false positive rate of a filter after inserting a number of
+     *              keys. The number of keys of a block follows a Poisson distribution, and a key
+     *              that isn't in a block with i keys is a false positive if the eight bits it
+     *              tests are set, which happens with probability (1 - (1 - 1 / 32)^i)^8.
+     * @param       n_blks : The number of blocks of the filter.
+     * @param       n_elems : The number of keys.
+     * @return      The expected false positive rate.
+     */
+    [[nodiscard]] static double estimate_false_positive_rate(
+            std::size_t n_blks,
+            std::size_t n_elems
+    ) noexcept
+    {
+        if (n_blks == 0)
+        {
+            return 1.0;
+        }
+
+        const double lmbd = static_cast<double>(n_elems) / static_cast<double>(n_blks);
+        const double sprd = 10.0 * std::sqrt(lmbd) + 10.0;
+        const auto frst = static_cast<std::size_t>(std::max(0.0, lmbd - sprd));
+        const auto lst = static_cast<std::size_t>(lmbd + sprd);
+        double fpr = 0.0;
+
+        for (std::size_t i = frst; i <= lst; ++i)
+        {
+            const auto n = static_cast<double>(i);
+            const double pmf = std::exp(n * std::log(lmbd) - lmbd - std::lgamma(n + 1.0));
+            const double bit_set = 1.0 - std::pow(1.0 - 1.0 / WORD_BITS, n);
+
+            fpr += pmf * std::pow(bit_set, static_cast<double>(WORDS_PER_BLOCK));
+        }
+
+        return std::min(fpr, 1.0);
+    }
+
+    /**
+     * @brief       Get the smallest number of blocks whose false positive rate after inserting a
+     *              number of keys is not greater than a target.
+     * @param       n_elems : The number of keys.
+     * @param       fpr : The target false positive rate.
+     * @return      The number of blocks.
+     * @throw       out_of_range_exception : If the target can't be reached.
+     */
+    [[nodiscard]] static std::size_t get_block_count(std::size_t n_elems, double fpr)
+    {
+        if (n_elems == 0)
+        {
+            return 1;
+        }
+
+        std::size_t hi = 1;
+
+        while (estimate_false_positive_rate(hi, n_elems) > fpr)
+        {
+            if (hi == MAX_BLOCK_COUNT)
+            {
+                throw out_of_range_exception();
+            }
+
+            hi *= 2;
+        }
+
+        std::size_t lo = hi / 2;
+
+        while (hi - lo > 1)
+        {
+            const std::size_t mid = lo + (hi - lo) / 2;
+
+            if (estimate_false_positive_rate(mid, n_elems) > fpr)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        return hi;
+    }
+
+    /**
+     * @brief       Get the hash function.
+     * @return      The hash function.
+     */
+    [[nodiscard]] hasher hash_function() const
+    {
+        return hsh_;
+    }
+
+private:
+    /**
+     * @brief       Struct that represents a block, which fits in a cache line.
+     */
+    struct alignas(WORDS_PER_BLOCK * sizeof(std::uint32_t)) block
+    {
+        /** The words. */
+        std::uint32_t wrds_[WORDS_PER_BLOCK] = {};
+    };
+
+    /** The block allocator type. */
+    using block_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<block>;
+
+    /** The odd constants that spread the low half of the hash over the eight words. */
+    static constexpr std::uint32_t SALTS[WORDS_PER_BLOCK] = {
+            0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU,
+            0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U
+    };
+
+    /**
+     * @brief       Check a number of blocks.
+     * @param       n_blks : The number of blocks.
+     * @return      The number of blocks.
+     * @throw       out_of_range_exception : If the number of blocks is zero or greater than
+     *              MAX_BLOCK_COUNT.
+     */
+    static std::size_t check_block_count(std::size_t n_blks)
+    {
+        if (n_blks == 0 || n_blks > MAX_BLOCK_COUNT)
+        {
+            throw out_of_range_exception();
+        }
+
+        return n_blks;
+    }
+
+    /**
+     * @brief       Get the block of a hash, chosen from its high half by a multiplication
+     *              instead of a modulo.
+     * @param       hsh : The hash.
+     * @return      The block.
+     */
+    [[nodiscard]] block& get_block(std::uint64_t hsh) noexcept
+    {
+        return blks_[((hsh >> 32) * blks_.size()) >> 32];
+    }
+
+    /**
+     * @brief       Get the block of a hash, chosen from its high half by a multiplication
+     *              instead of a modulo.
+     * @param       hsh : The hash.
+     * @return      The block.
+     */
+    [[nodiscard]] const block& get_block(std::uint64_t hsh) const noexcept
+    {
+        return blks_[((hsh >> 32) * blks_.size()) >> 32];
+    }
+
+#ifdef SPEED_CONTAINERS_AVX2
+    /**
+     * @brief       Get the bits of a hash, one per word, each chosen by the top five bits of the
+     *              product of the low half of the hash and the salt of the word.
+     * @param       hsh : The hash.
+     * @return      The bits of the hash.
+     */
+    [[nodiscard]] static __m256i make_mask(std::uint64_t hsh) noexcept
+    {
+        const __m256i salts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SALTS));
+        const __m256i prods = _mm256_mullo_epi32(
+                _mm256_set1_epi32(static_cast<std::int32_t>(static_cast<std::uint32_t>(hsh))),
+                salts);
+
+        return _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(prods, 27));
+    }
+#else
+    /**
+     * @brief       Get the bits of a hash, one per word, each chosen by the top five bits of the
+     *              product of the low half of the hash and the salt of the word.
+     * @param       hsh : The hash.
+     * @return      The bits of the hash.
+     */
+    [[nodiscard]] static block make_mask(std::uint64_t hsh) noexcept
+    {
+        const auto lo = static_cast<std::uint32_t>(hsh);
+        block msk;
+
+        for (std::size_t i = 0; i < WORDS_PER_BLOCK; ++i)
+        {
+            msk.wrds_[i] = std::uint32_t(1) << ((lo * SALTS[i]) >> 27);
+        }
+
+        return msk;
+    }
+#endif
+
+private:
+    /** The blocks. */
+    std::vector<block, block_allocator_type> blks_;
+
+    /** The hash function. */
+    [[no_unique_address]] hasher hsh_;
+};
+
+}
+
+#endif
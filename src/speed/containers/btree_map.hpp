@@ -0,0 +1,1590 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       btree_map.hpp
+ * @brief      btree_map class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_BTREE_MAP_HPP
+#define SPEED_CONTAINERS_BTREE_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "exception.hpp"
+#include "iterator_base.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents an ordered map implemented as an in-memory B+-tree. The
+ *              elements are held in leaves chained in a doubly linked list, and the inner nodes
+ *              only hold separator keys, so a lookup touches one node per level and an ordered
+ *              scan walks contiguous arrays. The nodes are aligned to cache lines and sized to
+ *              fill a given number of bytes, which makes each level cost a few adjacent cache lines
+ *              instead of the miss per level of a binary tree. Unlike a sorted vector, inserting
+ *              or erasing only moves the elements of one leaf. Inserting or erasing invalidates
+ *              the iterators. The keys of the elements must not be modified through the iterators.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        typename CompareT = std::less<KeyT>,
+        typename AllocatorT = std::allocator<std::pair<KeyT, ValueT>>,
+        std::size_t NodeSizeT = 256
+>
+class btree_map
+{
+public:
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The mapped type. */
+    using mapped_type = ValueT;
+
+    /** The value type. */
+    using value_type = std::pair<key_type, mapped_type>;
+
+    /** The key comparison type. */
+    using key_compare = CompareT;
+
+    /** The allocator type. */
+    using allocator_type = AllocatorT;
+
+    /** The size type. */
+    using size_type = std::size_t;
+
+    static_assert(std::is_nothrow_move_constructible_v<value_type>,
+                  "The elements are moved between nodes, so they must be nothrow movable.");
+
+private:
+    /** The size of a cache line. */
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+public:
+    /** The maximum number of elements in a leaf. */
+    static constexpr std::size_t LEAF_CAPACITY = std::max<std::size_t>(
+            5, (NodeSizeT - sizeof(std::uint32_t) - 2 * sizeof(void*)) / sizeof(value_type)) - 1;
+
+    /** The maximum number of keys in an inner node. */
+    static constexpr std::size_t INNER_CAPACITY = std::max<std::size_t>(
+            4, (NodeSizeT - sizeof(std::uint32_t) - sizeof(void*)) /
+                    (sizeof(key_type) + sizeof(void*))) - 1;
+
+private:
+    /**
+     * @brief       Struct that represents the part shared by the leaves and the inner nodes.
+     */
+    struct node_base
+    {
+        /** The number of elements of a leaf or of keys of an inner node. */
+        std::uint32_t n_ = 0;
+    };
+
+    /**
+     * @brief       Struct that represents a leaf. It has room for one element more than its
+     *              capacity, so an element can be inserted before the leaf is split.
+     */
+    struct alignas(CACHE_LINE_SIZE) leaf_node : public node_base
+    {
+        /** The previous leaf. */
+        leaf_node* prev_ = nullptr;
+
+        /** The next leaf. */
+        leaf_node* nxt_ = nullptr;
+
+        /** The storage of the elements. */
+        alignas(value_type) std::byte vals_[(LEAF_CAPACITY + 1) * sizeof(value_type)];
+
+        /**
+         * @brief       Get the elements.
+         * @return      The elements.
+         */
+        value_type* get_values() noexcept
+        {
+            return std::launder(reinterpret_cast<value_type*>(vals_));
+        }
+    };
+
+    /**
+     * @brief       Struct that represents an inner node. The child i holds the elements whose
+     *              keys are not less than the key i - 1 and less than the key i. It has room for
+     *              one key more than its capacity, so a key can be inserted before the node is
+     *              split.
+     */
+    struct alignas(CACHE_LINE_SIZE) inner_node : public node_base
+    {
+        /** The children. */
+        node_base* chldn_[INNER_CAPACITY + 2];
+
+        /** The storage of the keys. */
+        alignas(key_type) std::byte kys_[(INNER_CAPACITY + 1) * sizeof(key_type)];
+
+        /**
+         * @brief       Get the keys.
+         * @return      The keys.
+         */
+        key_type* get_keys() noexcept
+        {
+            return std::launder(reinterpret_cast<key_type*>(kys_));
+        }
+    };
+
+public:
+    /**
+     * @brief       Class that represents const iterators.
+     */
+    class const_iterator : public const_iterator_base<value_type, const_iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_iterator_base<value_type, const_iterator>;
+
+        /** The node iteration type. */
+        using node_type = value_type;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        const_iterator() noexcept = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       tr : The tree in which iterate.
+         * @param       lf : The current leaf, nullptr for the end.
+         * @param       pos : The position of the current element in the leaf.
+         */
+        const_iterator(const btree_map* tr, leaf_node* lf, std::size_t pos) noexcept
+                : tr_(tr)
+                , lf_(lf)
+                , pos_(pos)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            if (lf_ != nullptr && ++pos_ == lf_->n_)
+            {
+                lf_ = lf_->nxt_;
+                pos_ = 0;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node. Moving backward from the end gives the last
+         *              element.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            if (lf_ == nullptr)
+            {
+                lf_ = tr_->tail_;
+                pos_ = lf_ == nullptr ? 0 : lf_->n_ - 1;
+            }
+            else if (pos_ == 0)
+            {
+                lf_ = lf_->prev_;
+                pos_ = lf_ == nullptr ? 0 : lf_->n_ - 1;
+            }
+            else
+            {
+                --pos_;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return lf_ == rhs.lf_ && pos_ == rhs.pos_;
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return lf_ == nullptr;
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        const value_type& operator *() const noexcept
+        {
+            return lf_->get_values()[pos_];
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        const value_type* operator ->() const noexcept
+        {
+            return lf_->get_values() + pos_;
+        }
+
+        friend class btree_map;
+
+    protected:
+        /** The tree in which iterate. */
+        const btree_map* tr_ = nullptr;
+
+        /** The current leaf. */
+        leaf_node* lf_ = nullptr;
+
+        /** The position of the current element in the leaf. */
+        std::size_t pos_ = 0;
+    };
+
+    /**
+     * @brief       Class that represents mutable iterators.
+     */
+    class iterator : public const_mutable_iterator_base<value_type, const_iterator, iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = iterator;
+
+        /** The const iterator base. */
+        using const_self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_mutable_iterator_base<value_type, const_iterator, iterator>;
+
+        /** The node iteration type. */
+        using node_type = value_type;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        iterator() = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       tr : The tree in which iterate.
+         * @param       lf : The current leaf, nullptr for the end.
+         * @param       pos : The position of the current element in the leaf.
+         */
+        iterator(const btree_map* tr, leaf_node* lf, std::size_t pos) noexcept
+                : base_type(tr, lf, pos)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            const_self_type::operator ++();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            const_self_type::operator --();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return const_self_type::operator ==(rhs);
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return const_self_type::end();
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        value_type& operator *() const noexcept
+        {
+            return const_self_type::lf_->get_values()[const_self_type::pos_];
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        value_type* operator ->() const noexcept
+        {
+            return const_self_type::lf_->get_values() + const_self_type::pos_;
+        }
+
+        friend class btree_map;
+    };
+
+    /**
+     * @brief       Default constructor.
+     */
+    btree_map() = default;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       comp : The key comparison function.
+     * @param       alloc : The allocator.
+     */
+    explicit btree_map(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : comp_(comp)
+            , alloc_(alloc)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       alloc : The allocator.
+     */
+    explicit btree_map(const allocator_type& alloc)
+            : alloc_(alloc)
+    {
+    }
+
+    /** @cond */
+    btree_map(const btree_map& rhs) = delete;
+
+    btree_map& operator =(const btree_map& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Move constructor.
+     * @param       rhs : The object to move.
+     */
+    btree_map(btree_map&& rhs) noexcept
+            : root_(std::exchange(rhs.root_, nullptr))
+            , head_(std::exchange(rhs.head_, nullptr))
+            , tail_(std::exchange(rhs.tail_, nullptr))
+            , h_(std::exchange(rhs.h_, 0))
+            , sz_(std::exchange(rhs.sz_, 0))
+            , comp_(std::move(rhs.comp_))
+            , alloc_(std::move(rhs.alloc_))
+    {
+    }
+
+    /**
+     * @brief       Move assignment operator.
+     * @param       rhs : The object to move.
+     * @return      The object who call the method.
+     */
+    btree_map& operator =(btree_map&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            clear();
+            root_ = std::exchange(rhs.root_, nullptr);
+            head_ = std::exchange(rhs.head_, nullptr);
+            tail_ = std::exchange(rhs.tail_, nullptr);
+            h_ = std::exchange(rhs.h_, 0);
+            sz_ = std::exchange(rhs.sz_, 0);
+            comp_ = std::move(rhs.comp_);
+            alloc_ = std::move(rhs.alloc_);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief       Destructor.
+     */
+    ~btree_map()
+    {
+        clear();
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    iterator begin() noexcept
+    {
+        return iterator(this, sz_ == 0 ? nullptr : head_, 0);
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, sz_ == 0 ? nullptr : head_, 0);
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    iterator end() noexcept
+    {
+        return iterator(this, nullptr, 0);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, nullptr, 0);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    /**
+     * @brief       Allows knowing whether the map is empty.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return sz_ == 0;
+    }
+
+    /**
+     * @brief       Get the number of elements.
+     * @return      The number of elements.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return sz_;
+    }
+
+    /**
+     * @brief       Get the number of inner levels above the leaves.
+     * @return      The number of inner levels above the leaves.
+     */
+    [[nodiscard]] size_type get_height() const noexcept
+    {
+        return h_;
+    }
+
+    /**
+     * @brief       Erase all the elements and release all the nodes.
+     */
+    void clear() noexcept
+    {
+        if (root_ != nullptr)
+        {
+            destroy_subtree(root_, h_);
+        }
+
+        root_ = nullptr;
+        head_ = nullptr;
+        tail_ = nullptr;
+        h_ = 0;
+        sz_ = 0;
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is not less than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    iterator lower_bound(const KeyT_& ky)
+    {
+        if (root_ == nullptr)
+        {
+            return end();
+        }
+
+        leaf_node* lf = descend(ky);
+
+        return make_iterator(lf, leaf_lower_bound(lf, ky));
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is not less than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    const_iterator lower_bound(const KeyT_& ky) const
+    {
+        return const_cast<btree_map*>(this)->lower_bound(ky);
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is greater than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    iterator upper_bound(const KeyT_& ky)
+    {
+        if (root_ == nullptr)
+        {
+            return end();
+        }
+
+        leaf_node* lf = descend(ky);
+        value_type* vals = lf->get_values();
+        auto* it = std::upper_bound(vals, vals + lf->n_, ky,
+                                    [this](const auto& ky, const value_type& val)
+                                    {
+                                        return comp_(ky, val.first);
+                                    });
+
+        return make_iterator(lf, static_cast<std::size_t>(it - vals));
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is greater than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    const_iterator upper_bound(const KeyT_& ky) const
+    {
+        return const_cast<btree_map*>(this)->upper_bound(ky);
+    }
+
+    /**
+     * @brief       Find the element with a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element if it was found, otherwise the end iterator.
+     */
+    template<typename KeyT_ = key_type>
+    iterator find(const KeyT_& ky)
+    {
+        if (root_ == nullptr)
+        {
+            return end();
+        }
+
+        leaf_node* lf = descend(ky);
+        std::size_t pos = leaf_lower_bound(lf, ky);
+
+        if (pos < lf->n_ && !comp_(ky, lf->get_values()[pos].first))
+        {
+            return iterator(this, lf, pos);
+        }
+
+        return end();
+    }
+
+    /**
+     * @brief       Find the element with a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element if it was found, otherwise the end iterator.
+     */
+    template<typename KeyT_ = key_type>
+    const_iterator find(const KeyT_& ky) const
+    {
+        return const_cast<btree_map*>(this)->find(ky);
+    }
+
+    /**
+     * @brief       Allows knowing whether an element with a key is in the map.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename KeyT_ = key_type>
+    [[nodiscard]] bool contains(const KeyT_& ky) const
+    {
+        return !find(ky).end();
+    }
+
+    /**
+     * @brief       Count the elements with a key.
+     * @param       ky : The key.
+     * @return      The number of elements with the key, zero or one.
+     */
+    template<typename KeyT_ = key_type>
+    [[nodiscard]] size_type count(const KeyT_& ky) const
+    {
+        return contains(ky) ? 1 : 0;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     * @throw       out_of_range_exception : If the key isn't in the map.
+     */
+    template<typename KeyT_ = key_type>
+    mapped_type& at(const KeyT_& ky)
+    {
+        auto it = find(ky);
+
+        if (it.end())
+        {
+            throw out_of_range_exception();
+        }
+
+        return it->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     * @throw       out_of_range_exception : If the key isn't in the map.
+     */
+    template<typename KeyT_ = key_type>
+    const mapped_type& at(const KeyT_& ky) const
+    {
+        return const_cast<btree_map*>(this)->at(ky);
+    }
+
+    /**
+     * @brief       Get the mapped value of a key, inserting a default one if it is missing.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     */
+    mapped_type& operator [](const key_type& ky)
+    {
+        return try_emplace(ky).first->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key, inserting a default one if it is missing.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     */
+    mapped_type& operator [](key_type&& ky)
+    {
+        return try_emplace(std::move(ky)).first->second;
+    }
+
+    /**
+     * @brief       Insert an element if its key isn't in the map.
+     * @param       val : The element.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    std::pair<iterator, bool> insert(const value_type& val)
+    {
+        return try_emplace(val.first, val.second);
+    }
+
+    /**
+     * @brief       Insert an element if its key isn't in the map.
+     * @param       val : The element.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    std::pair<iterator, bool> insert(value_type&& val)
+    {
+        return try_emplace(std::move(val.first), std::move(val.second));
+    }
+
+    /**
+     * @brief       Construct an element if its key isn't in the map. The element is constructed
+     *              before looking for its key.
+     * @param       args : The arguments to construct the element.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    template<typename... Ts_>
+    std::pair<iterator, bool> emplace(Ts_&&... args)
+    {
+        value_type val(std::forward<Ts_>(args)...);
+
+        return insert(std::move(val));
+    }
+
+    /**
+     * @brief       Construct an element with a key if the key isn't in the map. Nothing is
+     *              constructed if the key is found. The nodes that a split needs are allocated
+     *              before the tree is modified, so if an exception is thrown the map is left
+     *              unchanged.
+     * @param       ky : The key.
+     * @param       args : The arguments to construct the mapped value.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    template<typename KeyT_, typename... Ts_>
+    std::pair<iterator, bool> try_emplace(KeyT_&& ky, Ts_&&... args)
+    {
+        if (root_ == nullptr)
+        {
+            head_ = allocate_leaf();
+            tail_ = head_;
+            root_ = head_;
+        }
+
+        path_entry pth[MAX_HEIGHT];
+        leaf_node* lf = descend(ky, pth);
+        value_type* vals = lf->get_values();
+        std::size_t pos = leaf_lower_bound(lf, ky);
+
+        if (pos < lf->n_ && !comp_(ky, vals[pos].first))
+        {
+            return {iterator(this, lf, pos), false};
+        }
+
+        spare_nodes spr;
+
+        if (lf->n_ == LEAF_CAPACITY)
+        {
+            reserve_spare_nodes(pth, spr);
+        }
+
+        relocate(vals + pos, vals + pos + 1, lf->n_ - pos);
+
+        try
+        {
+            std::construct_at(vals + pos, std::piecewise_construct,
+                              std::forward_as_tuple(std::forward<KeyT_>(ky)),
+                              std::forward_as_tuple(std::forward<Ts_>(args)...));
+        }
+        catch (...)
+        {
+            relocate(vals + pos + 1, vals + pos, lf->n_ - pos);
+            release_spare_nodes(spr);
+            throw;
+        }
+
+        ++lf->n_;
+        ++sz_;
+
+        if (lf->n_ <= LEAF_CAPACITY)
+        {
+            return {iterator(this, lf, pos), true};
+        }
+
+        leaf_node* nw_lf = split_leaf(lf, pos, pth, spr);
+
+        if (pos >= lf->n_)
+        {
+            return {iterator(this, nw_lf, pos - lf->n_), true};
+        }
+
+        return {iterator(this, lf, pos), true};
+    }
+
+    /**
+     * @brief       Insert an element, or assign its mapped value if the key is in the map.
+     * @param       ky : The key.
+     * @param       val : The mapped value.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    template<typename KeyT_, typename ValueT_>
+    std::pair<iterator, bool> insert_or_assign(KeyT_&& ky, ValueT_&& val)
+    {
+        auto res = try_emplace(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+
+        if (!res.second)
+        {
+            res.first->second = std::forward<ValueT_>(val);
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief       Erase an element.
+     * @param       pos : The element.
+     * @return      An iterator to the element that followed the erased one.
+     */
+    iterator erase(const_iterator pos)
+    {
+        path_entry pth[MAX_HEIGHT];
+        leaf_node* lf = descend(pos->first, pth);
+
+        return erase_at(lf, pos.pos_, pth);
+    }
+
+    /**
+     * @brief       Erase the element with a key.
+     * @param       ky : The key.
+     * @return      The number of erased elements.
+     */
+    size_type erase(const key_type& ky)
+    {
+        if (root_ == nullptr)
+        {
+            return 0;
+        }
+
+        path_entry pth[MAX_HEIGHT];
+        leaf_node* lf = descend(ky, pth);
+        std::size_t pos = leaf_lower_bound(lf, ky);
+
+        if (pos == lf->n_ || comp_(ky, lf->get_values()[pos].first))
+        {
+            return 0;
+        }
+
+        erase_at(lf, pos, pth);
+
+        return 1;
+    }
+
+    /**
+     * @brief       Get the key comparison function.
+     * @return      The key comparison function.
+     */
+    [[nodiscard]] key_compare key_comp() const
+    {
+        return comp_;
+    }
+
+    /**
+     * @brief       Get the allocator.
+     * @return      The allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
+private:
+    /** The leaf allocator type. */
+    using leaf_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<leaf_node>;
+
+    /** The leaf allocator traits. */
+    using leaf_allocator_traits = std::allocator_traits<leaf_allocator_type>;
+
+    /** The inner node allocator type. */
+    using inner_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<inner_node>;
+
+    /** The inner node allocator traits. */
+    using inner_allocator_traits = std::allocator_traits<inner_allocator_type>;
+
+    /** The minimum number of elements in a leaf other than the root. */
+    static constexpr std::size_t LEAF_MIN = LEAF_CAPACITY / 2;
+
+    /** The minimum number of keys in an inner node other than the root. */
+    static constexpr std::size_t INNER_MIN = INNER_CAPACITY / 2;
+
+    /** The maximum number of inner levels, reached with inner nodes of two children. */
+    static constexpr std::size_t MAX_HEIGHT = 64;
+
+    /**
+     * @brief       Struct that represents an inner node visited while descending.
+     */
+    struct path_entry
+    {
+        /** The inner node. */
+        inner_node* nd_;
+
+        /** The index of the child that was descended. */
+        std::size_t idx_;
+    };
+
+    /**
+     * @brief       Struct that holds the nodes allocated before splitting.
+     */
+    struct spare_nodes
+    {
+        /** The leaf. */
+        leaf_node* lf_ = nullptr;
+
+        /** The inner nodes. */
+        inner_node* inrs_[MAX_HEIGHT + 1];
+
+        /** The number of inner nodes. */
+        std::size_t n_inrs_ = 0;
+    };
+
+    /**
+     * @brief       Move elements constructing them at the destination and destroying them at the
+     *              source. The ranges can overlap.
+     * @param       src : The elements to move.
+     * @param       dst : The destination.
+     * @param       n : The number of elements.
+     */
+    template<typename T_>
+    static void relocate(T_* src, T_* dst, std::size_t n) noexcept
+    {
+        if (dst < src)
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                std::construct_at(dst + i, std::move(src[i]));
+                std::destroy_at(src + i);
+            }
+        }
+        else
+        {
+            for (std::size_t i = n; i-- > 0;)
+            {
+                std::construct_at(dst + i, std::move(src[i]));
+                std::destroy_at(src + i);
+            }
+        }
+    }
+
+    /**
+     * @brief       Replace a key by another one.
+     * @param       dst : The key to replace.
+     * @param       src : The key that replaces it.
+     */
+    static void replace_key(key_type* dst, key_type&& src) noexcept
+    {
+        std::destroy_at(dst);
+        std::construct_at(dst, std::move(src));
+    }
+
+    /**
+     * @brief       Get an iterator to a position of a leaf, moving to the next leaf if the
+     *              position is past its last element.
+     * @param       lf : The leaf.
+     * @param       pos : The position.
+     * @return      The iterator.
+     */
+    iterator make_iterator(leaf_node* lf, std::size_t pos) noexcept
+    {
+        if (pos == lf->n_)
+        {
+            return iterator(this, lf->nxt_, 0);
+        }
+
+        return iterator(this, lf, pos);
+    }
+
+    /**
+     * @brief       Get the position of the first element of a leaf whose key is not less than a
+     *              key.
+     * @param       lf : The leaf.
+     * @param       ky : The key.
+     * @return      The position.
+     */
+    template<typename KeyT_>
+    std::size_t leaf_lower_bound(leaf_node* lf, const KeyT_& ky) const
+    {
+        value_type* vals = lf->get_values();
+        auto* it = std::lower_bound(vals, vals + lf->n_, ky,
+                                    [this](const value_type& val, const auto& ky)
+                                    {
+                                        return comp_(val.first, ky);
+                                    });
+
+        return static_cast<std::size_t>(it - vals);
+    }
+
+    /**
+     * @brief       Descend from the root to the leaf that would hold a key.
+     * @param       ky : The key.
+     * @param       pth : If not nullptr, receives the inner nodes visited, from the root.
+     * @return      The leaf.
+     */
+    template<typename KeyT_>
+    leaf_node* descend(const KeyT_& ky, path_entry* pth = nullptr) const
+    {
+        node_base* nd = root_;
+
+        for (std::size_t lvl = 0; lvl < h_; lvl++)
+        {
+            auto* inr = static_cast<inner_node*>(nd);
+            key_type* kys = inr->get_keys();
+            auto idx = static_cast<std::size_t>(
+                    std::upper_bound(kys, kys + inr->n_, ky, comp_) - kys);
+
+            if (pth != nullptr)
+            {
+                pth[lvl] = {inr, idx};
+            }
+
+            nd = inr->chldn_[idx];
+        }
+
+        return static_cast<leaf_node*>(nd);
+    }
+
+    /**
+     * @brief       Allocate an empty leaf.
+     * @return      The leaf.
+     */
+    leaf_node* allocate_leaf()
+    {
+        leaf_allocator_type lf_alloc(alloc_);
+
+        return ::new (static_cast<void*>(leaf_allocator_traits::allocate(lf_alloc, 1)))
+                leaf_node;
+    }
+
+    /**
+     * @brief       Deallocate a leaf whose elements have been destroyed or moved.
+     * @param       lf : The leaf.
+     */
+    void deallocate_leaf(leaf_node* lf) noexcept
+    {
+        leaf_allocator_type lf_alloc(alloc_);
+
+        std::destroy_at(lf);
+        leaf_allocator_traits::deallocate(lf_alloc, lf, 1);
+    }
+
+    /**
+     * @brief       Allocate an empty inner node.
+     * @return      The inner node.
+     */
+    inner_node* allocate_inner()
+    {
+        inner_allocator_type inr_alloc(alloc_);
+
+        return ::new (static_cast<void*>(inner_allocator_traits::allocate(inr_alloc, 1)))
+                inner_node;
+    }
+
+    /**
+     * @brief       Deallocate an inner node whose keys have been destroyed or moved.
+     * @param       inr : The inner node.
+     */
+    void deallocate_inner(inner_node* inr) noexcept
+    {
+        inner_allocator_type inr_alloc(alloc_);
+
+        std::destroy_at(inr);
+        inner_allocator_traits::deallocate(inr_alloc, inr, 1);
+    }
+
+    /**
+     * @brief       Destroy the elements and the keys of a subtree and deallocate its nodes.
+     * @param       nd : The root of the subtree.
+     * @param       lvl : The number of inner levels of the subtree.
+     */
+    void destroy_subtree(node_base* nd, std::size_t lvl) noexcept
+    {
+        if (lvl == 0)
+        {
+            auto* lf = static_cast<leaf_node*>(nd);
+
+            std::destroy_n(lf->get_values(), lf->n_);
+            deallocate_leaf(lf);
+
+            return;
+        }
+
+        auto* inr = static_cast<inner_node*>(nd);
+
+        for (std::size_t i = 0; i <= inr->n_; i++)
+        {
+            destroy_subtree(inr->chldn_[i], lvl - 1);
+        }
+
+        std::destroy_n(inr->get_keys(), inr->n_);
+        deallocate_inner(inr);
+    }
+
+    /**
+     * @brief       Allocate the nodes that inserting in a full leaf needs: the new leaf, a new
+     *              inner node for each full inner node of the path and a new root if the root
+     *              gets split.
+     * @param       pth : The inner nodes visited while descending.
+     * @param       spr : Receives the nodes.
+     */
+    void reserve_spare_nodes(path_entry* pth, spare_nodes& spr)
+    {
+        std::size_t lvl = h_;
+
+        while (lvl > 0 && pth[lvl - 1].nd_->n_ == INNER_CAPACITY)
+        {
+            --lvl;
+        }
+
+        const std::size_t n_inrs = h_ - lvl + (lvl == 0 ? 1 : 0);
+
+        try
+        {
+            spr.lf_ = allocate_leaf();
+
+            while (spr.n_inrs_ < n_inrs)
+            {
+                spr.inrs_[spr.n_inrs_] = allocate_inner();
+                ++spr.n_inrs_;
+            }
+        }
+        catch (...)
+        {
+            release_spare_nodes(spr);
+            throw;
+        }
+    }
+
+    /**
+     * @brief       Deallocate the nodes allocated before splitting.
+     * @param       spr : The nodes.
+     */
+    void release_spare_nodes(spare_nodes& spr) noexcept
+    {
+        if (spr.lf_ != nullptr)
+        {
+            deallocate_leaf(spr.lf_);
+            spr.lf_ = nullptr;
+        }
+
+        while (spr.n_inrs_ > 0)
+        {
+            --spr.n_inrs_;
+            deallocate_inner(spr.inrs_[spr.n_inrs_]);
+        }
+    }
+
+    /**
+     * @brief       Split a leaf that holds one element more than its capacity, and split the inner
+     *              nodes above it that overflow in turn. The separator is the first key of the new
+     *              leaf, which is the only key copied. If copying it throws, the element inserted
+     *              at a position is removed again.
+     * @param       lf : The leaf.
+     * @param       pos : The position of the element just inserted.
+     * @param       pth : The inner nodes visited while descending.
+     * @param       spr : The nodes allocated before splitting.
+     * @return      The new leaf, which follows the split one.
+     */
+    leaf_node* split_leaf(leaf_node* lf, std::size_t pos, path_entry* pth, spare_nodes& spr)
+    {
+        constexpr std::size_t splt = (LEAF_CAPACITY + 1) / 2;
+        value_type* vals = lf->get_values();
+        inner_node* prnt;
+        std::size_t idx;
+
+        if (h_ == 0)
+        {
+            prnt = spr.inrs_[--spr.n_inrs_];
+            idx = 0;
+        }
+        else
+        {
+            prnt = pth[h_ - 1].nd_;
+            idx = pth[h_ - 1].idx_;
+        }
+
+        key_type* kys = prnt->get_keys();
+        relocate(kys + idx, kys + idx + 1, prnt->n_ - idx);
+
+        try
+        {
+            std::construct_at(kys + idx, vals[splt].first);
+        }
+        catch (...)
+        {
+            relocate(kys + idx + 1, kys + idx, prnt->n_ - idx);
+
+            if (h_ == 0)
+            {
+                spr.inrs_[spr.n_inrs_++] = prnt;
+            }
+
+            --lf->n_;
+            --sz_;
+            std::destroy_at(vals + pos);
+            relocate(vals + pos + 1, vals + pos, lf->n_ - pos);
+            release_spare_nodes(spr);
+            throw;
+        }
+
+        leaf_node* nw_lf = std::exchange(spr.lf_, nullptr);
+
+        relocate(vals + splt, nw_lf->get_values(), lf->n_ - splt);
+        nw_lf->n_ = lf->n_ - splt;
+        lf->n_ = splt;
+
+        nw_lf->prev_ = lf;
+        nw_lf->nxt_ = lf->nxt_;
+        (lf->nxt_ == nullptr ? tail_ : lf->nxt_->prev_) = nw_lf;
+        lf->nxt_ = nw_lf;
+
+        if (h_ == 0)
+        {
+            prnt->n_ = 1;
+            prnt->chldn_[0] = lf;
+            prnt->chldn_[1] = nw_lf;
+            root_ = prnt;
+            h_ = 1;
+
+            return nw_lf;
+        }
+
+        std::copy_backward(prnt->chldn_ + idx + 1, prnt->chldn_ + prnt->n_ + 1,
+                           prnt->chldn_ + prnt->n_ + 2);
+        prnt->chldn_[idx + 1] = nw_lf;
+        ++prnt->n_;
+
+        for (std::size_t lvl = h_; lvl-- > 0 && pth[lvl].nd_->n_ > INNER_CAPACITY;)
+        {
+            split_inner(pth, lvl, spr);
+        }
+
+        return nw_lf;
+    }
+
+    /**
+     * @brief       Split an inner node that holds one key more than its capacity. Its middle key
+     *              moves up to the parent, or to a new root.
+     * @param       pth : The inner nodes visited while descending.
+     * @param       lvl : The level of the inner node in the path.
+     * @param       spr : The nodes allocated before splitting.
+     */
+    void split_inner(path_entry* pth, std::size_t lvl, spare_nodes& spr) noexcept
+    {
+        constexpr std::size_t mid = (INNER_CAPACITY + 1) / 2;
+        inner_node* inr = pth[lvl].nd_;
+        inner_node* nw_inr = spr.inrs_[--spr.n_inrs_];
+        key_type* kys = inr->get_keys();
+
+        relocate(kys + mid + 1, nw_inr->get_keys(), inr->n_ - mid - 1);
+        std::copy(inr->chldn_ + mid + 1, inr->chldn_ + inr->n_ + 1, nw_inr->chldn_);
+        nw_inr->n_ = inr->n_ - mid - 1;
+        inr->n_ = mid;
+
+        if (lvl == 0)
+        {
+            inner_node* nw_root = spr.inrs_[--spr.n_inrs_];
+
+            relocate(kys + mid, nw_root->get_keys(), 1);
+            nw_root->n_ = 1;
+            nw_root->chldn_[0] = inr;
+            nw_root->chldn_[1] = nw_inr;
+            root_ = nw_root;
+            ++h_;
+
+            return;
+        }
+
+        inner_node* prnt = pth[lvl - 1].nd_;
+        const std::size_t idx = pth[lvl - 1].idx_;
+        key_type* prnt_kys = prnt->get_keys();
+
+        relocate(prnt_kys + idx, prnt_kys + idx + 1, prnt->n_ - idx);
+        relocate(kys + mid, prnt_kys + idx, 1);
+        std::copy_backward(prnt->chldn_ + idx + 1, prnt->chldn_ + prnt->n_ + 1,
+                           prnt->chldn_ + prnt->n_ + 2);
+        prnt->chldn_[idx + 1] = nw_inr;
+        ++prnt->n_;
+    }
+
+    /**
+     * @brief       Erase the element at a position of a leaf and rebalance the tree. A leaf left
+     *              with too few elements borrows one from a sibling, which needs a new separator
+     *              key; that key is copied before anything is modified, so if the copy throws the
+     *              map is left unchanged. Otherwise the leaf is merged with a sibling, and the
+     *              inner nodes above are rebalanced the same way, only moving keys.
+     * @param       lf : The leaf.
+     * @param       pos : The position of the element.
+     * @param       pth : The inner nodes visited while descending.
+     * @return      An iterator to the element that followed the erased one.
+     */
+    iterator erase_at(leaf_node* lf, std::size_t pos, path_entry* pth)
+    {
+        inner_node* prnt = nullptr;
+        std::size_t idx = 0;
+        leaf_node* lft = nullptr;
+        leaf_node* rght = nullptr;
+        std::optional<key_type> nw_sep;
+
+        if (h_ > 0 && lf->n_ - 1 < LEAF_MIN)
+        {
+            prnt = pth[h_ - 1].nd_;
+            idx = pth[h_ - 1].idx_;
+            lft = idx > 0 ? static_cast<leaf_node*>(prnt->chldn_[idx - 1]) : nullptr;
+            rght = idx < prnt->n_ ? static_cast<leaf_node*>(prnt->chldn_[idx + 1]) : nullptr;
+
+            if (lft != nullptr && lft->n_ > LEAF_MIN)
+            {
+                nw_sep.emplace(lft->get_values()[lft->n_ - 1].first);
+                rght = nullptr;
+            }
+            else if (rght != nullptr && rght->n_ > LEAF_MIN)
+            {
+                nw_sep.emplace(rght->get_values()[1].first);
+                lft = nullptr;
+            }
+        }
+
+        value_type* vals = lf->get_values();
+
+        std::destroy_at(vals + pos);
+        relocate(vals + pos + 1, vals + pos, lf->n_ - pos - 1);
+        --lf->n_;
+        --sz_;
+
+        if (prnt == nullptr)
+        {
+            if (sz_ == 0)
+            {
+                deallocate_leaf(lf);
+                root_ = nullptr;
+                head_ = nullptr;
+                tail_ = nullptr;
+
+                return end();
+            }
+
+            return make_iterator(lf, pos);
+        }
+
+        if (nw_sep.has_value())
+        {
+            if (lft != nullptr)
+            {
+                relocate(vals, vals + 1, lf->n_);
+                relocate(lft->get_values() + lft->n_ - 1, vals, 1);
+                --lft->n_;
+                ++lf->n_;
+                replace_key(prnt->get_keys() + idx - 1, std::move(*nw_sep));
+
+                return make_iterator(lf, pos + 1);
+            }
+
+            value_type* rght_vals = rght->get_values();
+
+            relocate(rght_vals, vals + lf->n_, 1);
+            relocate(rght_vals + 1, rght_vals, rght->n_ - 1);
+            ++lf->n_;
+            --rght->n_;
+            replace_key(prnt->get_keys() + idx, std::move(*nw_sep));
+
+            return make_iterator(lf, pos);
+        }
+
+        if (lft != nullptr)
+        {
+            pos += lft->n_;
+            merge_leaves(lft, lf);
+            erase_inner_slot(prnt, idx - 1);
+            lf = lft;
+        }
+        else
+        {
+            merge_leaves(lf, rght);
+            erase_inner_slot(prnt, idx);
+        }
+
+        rebalance_inner(pth, h_ - 1);
+
+        return make_iterator(lf, pos);
+    }
+
+    /**
+     * @brief       Move the elements of a leaf to the end of its previous leaf and deallocate it.
+     * @param       lft : The previous leaf.
+     * @param       rght : The leaf.
+     */
+    void merge_leaves(leaf_node* lft, leaf_node* rght) noexcept
+    {
+        relocate(rght->get_values(), lft->get_values() + lft->n_, rght->n_);
+        lft->n_ += rght->n_;
+        lft->nxt_ = rght->nxt_;
+        (rght->nxt_ == nullptr ? tail_ : rght->nxt_->prev_) = lft;
+        rght->n_ = 0;
+        deallocate_leaf(rght);
+    }
+
+    /**
+     * @brief       Erase a key of an inner node and the child that follows it.
+     * @param       inr : The inner node.
+     * @param       idx : The index of the key.
+     */
+    static void erase_inner_slot(inner_node* inr, std::size_t idx) noexcept
+    {
+        key_type* kys = inr->get_keys();
+
+        std::destroy_at(kys + idx);
+        relocate(kys + idx + 1, kys + idx, inr->n_ - idx - 1);
+        std::copy(inr->chldn_ + idx + 2, inr->chldn_ + inr->n_ + 1, inr->chldn_ + idx + 1);
+        --inr->n_;
+    }
+
+    /**
+     * @brief       Rebalance the inner nodes of a path from a level up to the root. A node left
+     *              with too few keys rotates one through its parent from a sibling that can spare
+     *              it, or else is merged with a sibling, which removes a key from the parent. A
+     *              root left without keys is replaced by its only child.
+     * @param       pth : The inner nodes visited while descending.
+     * @param       lvl : The level of the first inner node to rebalance.
+     */
+    void rebalance_inner(path_entry* pth, std::size_t lvl) noexcept
+    {
+        for (;; --lvl)
+        {
+            inner_node* inr = pth[lvl].nd_;
+
+            if (lvl == 0)
+            {
+                if (inr->n_ == 0)
+                {
+                    root_ = inr->chldn_[0];
+                    --h_;
+                    deallocate_inner(inr);
+                }
+
+                return;
+            }
+
+            if (inr->n_ >= INNER_MIN)
+            {
+                return;
+            }
+
+            inner_node* prnt = pth[lvl - 1].nd_;
+            const std::size_t idx = pth[lvl - 1].idx_;
+            key_type* prnt_kys = prnt->get_keys();
+            key_type* kys = inr->get_keys();
+            auto* lft = idx > 0 ? static_cast<inner_node*>(prnt->chldn_[idx - 1]) : nullptr;
+            auto* rght = idx < prnt->n_ ? static_cast<inner_node*>(prnt->chldn_[idx + 1]) :
+                                          nullptr;
+
+            if (lft != nullptr && lft->n_ > INNER_MIN)
+            {
+                relocate(kys, kys + 1, inr->n_);
+                std::copy_backward(inr->chldn_, inr->chldn_ + inr->n_ + 1,
+                                   inr->chldn_ + inr->n_ + 2);
+                relocate(prnt_kys + idx - 1, kys, 1);
+                inr->chldn_[0] = lft->chldn_[lft->n_];
+                relocate(lft->get_keys() + lft->n_ - 1, prnt_kys + idx - 1, 1);
+                --lft->n_;
+                ++inr->n_;
+
+                return;
+            }
+
+            if (rght != nullptr && rght->n_ > INNER_MIN)
+            {
+                key_type* rght_kys = rght->get_keys();
+
+                relocate(prnt_kys + idx, kys + inr->n_, 1);
+                inr->chldn_[inr->n_ + 1] = rght->chldn_[0];
+                relocate(rght_kys, prnt_kys + idx, 1);
+                relocate(rght_kys + 1, rght_kys, rght->n_ - 1);
+                std::copy(rght->chldn_ + 1, rght->chldn_ + rght->n_ + 1, rght->chldn_);
+                --rght->n_;
+                ++inr->n_;
+
+                return;
+            }
+
+            if (lft != nullptr)
+            {
+                merge_inners(prnt, idx - 1);
+            }
+            else
+            {
+                merge_inners(prnt, idx);
+            }
+        }
+    }
+
+    /**
+     * @brief       Merge two adjacent children of an inner node, pulling down the key that
+     *              separates them.
+     * @param       prnt : The inner node.
+     * @param       idx : The index of the key that separates the children.
+     */
+    void merge_inners(inner_node* prnt, std::size_t idx) noexcept
+    {
+        auto* lft = static_cast<inner_node*>(prnt->chldn_[idx]);
+        auto* rght = static_cast<inner_node*>(prnt->chldn_[idx + 1]);
+        key_type* prnt_kys = prnt->get_keys();
+        key_type* lft_kys = lft->get_keys();
+
+        relocate(prnt_kys + idx, lft_kys + lft->n_, 1);
+        relocate(rght->get_keys(), lft_kys + lft->n_ + 1, rght->n_);
+        std::copy(rght->chldn_, rght->chldn_ + rght->n_ + 1, lft->chldn_ + lft->n_ + 1);
+        lft->n_ += rght->n_ + 1;
+        deallocate_inner(rght);
+
+        relocate(prnt_kys + idx + 1, prnt_kys + idx, prnt->n_ - idx - 1);
+        std::copy(prnt->chldn_ + idx + 2, prnt->chldn_ + prnt->n_ + 1, prnt->chldn_ + idx + 1);
+        --prnt->n_;
+    }
+
+private:
+    /** The root, nullptr when the map has no nodes. */
+    node_base* root_ = nullptr;
+
+    /** The first leaf. */
+    leaf_node* head_ = nullptr;
+
+    /** The last leaf. */
+    leaf_node* tail_ = nullptr;
+
+    /** The number of inner levels above the leaves. */
+    std::size_t h_ = 0;
+
+    /** The number of elements. */
+    std::size_t sz_ = 0;
+
+    /** The key comparison function. */
+    [[no_unique_address]] key_compare comp_;
+
+    /** The allocator. */
+    [[no_unique_address]] allocator_type alloc_;
+};
+
+}
+
+#endif
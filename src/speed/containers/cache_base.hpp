@@ -0,0 +1,1534 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       cache_base.hpp
+ * @brief      cache_base class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_CACHE_BASE_HPP
+#define SPEED_CONTAINERS_CACHE_BASE_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "../cryptography/city_hash.hpp"
+#include "../lowlevel/operations.hpp"
+#include "../memory/operations.hpp"
+#include "eviction_policy.hpp"
+#include "exception.hpp"
+#include "flags.hpp"
+#include "iterator_base.hpp"
+#include "statistics_policy.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Contains all buffer cache buffers flags.
+ */
+enum class static_cache_buffer_flags : std::uint8_t
+{
+    /** Null flag. */
+    NIL = 0x0,
+    
+    /** The buffer is inserted in the hash buffer. */
+    INSERTED_IN_HASH_BUFFER = 0x1,
+    
+    /** The buffer is inserted in teh available list, that is it isn't locked. */
+    INSERTED_IN_AVAILABLE_LIST = 0x2,
+    
+    /** All flags. */
+    ALL = 0x3
+};
+
+/** Contains all buffer cache buffers flags. */
+using scbf_t = static_cache_buffer_flags;
+
+/**
+ * @brief       Class that represents the base of the generic caches, it holds all the logic while
+ *              the derived class owns the buffers and the hash buffer. The hash of every key is
+ *              computed once and stored in its buffer, so the buffer can be moved across the hash
+ *              buffer and compared against other keys without hashing it again. The buffer
+ *              recycled on insertion is chosen by the eviction policy among the buffers that
+ *              aren't locked. When both HashT and PredT define is_transparent, the lookups
+ *              accept any type they can handle, so no key has to be built to look one up. The
+ *              derived class has to provide the get_hash_buffer() and get_hash_buffer_size()
+ *              functions, the size being a power of two, it has to call initialize() once its
+ *              buffers are constructed and destroy_elements() before they are destroyed. The keys
+ *              and the values are constructed in place when they are inserted and destroyed when
+ *              they are evicted, so they don't have to be default constructible. The statistics
+ *              policy is notified of the lookups, the insertions, the evictions and the locks, and
+ *              takes no room when it is empty.
+ */
+template<
+        typename DerivedT,
+        typename KeyT,
+        typename ValueT,
+        typename HashT,
+        typename PredT,
+        template<typename> class EvictionPolicyT,
+        typename StatisticsT
+>
+class cache_base
+{
+public:
+    /** The key type. */
+    using key_type = KeyT;
+    
+    /** The value type. */
+    using value_type = ValueT;
+    
+    /** The hash type. */
+    using hash_type = HashT;
+    
+    /** The predicate type. */
+    using pred_type = PredT;
+    
+    /** The statistics policy type. */
+    using statistics_type = StatisticsT;
+    
+    /** Class that represents flags container */
+    template<typename T>
+    using flags_type = flags<T>;
+    
+    /** Whether the keys can be looked up through any type the hash and the predicate accept. */
+    static constexpr bool TRANSPARENT_LOOKUP = requires
+    {
+        typename HashT::is_transparent;
+        typename PredT::is_transparent;
+    };
+    
+    /** The number of keys a batch operation hashes and prefetches before resolving them. */
+    static constexpr std::size_t BATCH_SIZE = 16;
+    
+    /** Whether the elements can be saved in a snapshot file and loaded from it. */
+    static constexpr bool SNAPSHOTS =
+            std::is_trivially_copyable_v<key_type> && std::is_trivially_copyable_v<value_type>;
+    
+    /** The type through which a key passed as KeyT_ is looked up. */
+    template<typename KeyT_>
+    using lookup_key_t = std::conditional_t<
+            TRANSPARENT_LOOKUP, std::remove_cvref_t<KeyT_>, key_type>;
+    
+    struct buffer;
+    
+    /** The eviction policy type. */
+    using policy_type = EvictionPolicyT<buffer>;
+    
+    /**
+     * @brief       Struct that represents the buffer that contains the data.
+     */
+    struct buffer
+    {
+        /** Pointer to the next element in the buffer. */
+        buffer* b_nxt_;
+        
+        /** Pointer to the previous element in the buffer. */
+        buffer* b_prev_;
+        
+        /** The eviction policy state of the buffer. */
+        typename policy_type::hook_type plcy_hk_;
+        
+        /** The hash of the buffer key. */
+        std::size_t hsh_;
+        
+        /** The storage of the buffer key, it holds a key while the buffer is in the hash buffer. */
+        alignas(key_type) std::byte ky_stg_[sizeof(key_type)];
+        
+        /** The storage of the buffer value, it holds a value along with the key. */
+        alignas(value_type) std::byte val_stg_[sizeof(value_type)];
+        
+        /** The buffer flags. */
+        flags_type<scbf_t> flgs_;
+        
+        /**
+         * @brief       Get the buffer key.
+         * @return      The buffer key.
+         */
+        key_type& get_key() noexcept
+        {
+            return *std::launder(reinterpret_cast<key_type*>(ky_stg_));
+        }
+        
+        /**
+         * @brief       Get the buffer key.
+         * @return      The buffer key.
+         */
+        const key_type& get_key() const noexcept
+        {
+            return *std::launder(reinterpret_cast<const key_type*>(ky_stg_));
+        }
+        
+        /**
+         * @brief       Get the buffer value.
+         * @return      The buffer value.
+         */
+        value_type& get_value() noexcept
+        {
+            return *std::launder(reinterpret_cast<value_type*>(val_stg_));
+        }
+        
+        /**
+         * @brief       Get the buffer value.
+         * @return      The buffer value.
+         */
+        const value_type& get_value() const noexcept
+        {
+            return *std::launder(reinterpret_cast<const value_type*>(val_stg_));
+        }
+    };
+    
+    static_assert(eviction_policy<policy_type, buffer>, "invalid eviction policy");
+    
+    static_assert(statistics_policy<statistics_type>, "invalid statistics policy");
+    
+    /**
+     * @brief       Struct that represents the value stored in the hash table.
+     */
+    struct hash_buffer
+    {
+        /** The first element of the buffer list. */
+        buffer* b_list_ = nullptr;
+    };
+    
+    /**
+     * @brief       Class that represents const iterators.
+     */
+    class const_iterator : public const_iterator_base<value_type, const_iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = const_iterator;
+    
+        /** The base class. */
+        using base_type = const_iterator_base<value_type, const_iterator>;
+    
+        /** The node iteration type. */
+        using node_type = buffer;
+    
+        using base_type::operator ++;
+        using base_type::operator --;
+    
+        /**
+         * @brief       Default constructor.
+         */
+        const_iterator() noexcept = default;
+    
+        /**
+         * @brief       Constructor with parameters.
+         * @param       hb : The hash buffer.
+         * @param       hb_size : The hash buffer size.
+         * @param       current_hb_idx : The current hash buffer.
+         * @param       current_hb_buf : The current buffer in the hash buffer.
+         */
+        const_iterator(
+                hash_buffer* hb,
+                std::size_t hb_size,
+                std::size_t current_hb_idx,
+                buffer* current_hb_buf
+        ) noexcept
+                : hb_(hb)
+                , hb_size_(hb_size)
+                , current_hb_idx_(current_hb_idx)
+                , current_hb_buf_(current_hb_buf)
+        {
+        }
+    
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++()
+        {
+            if (current_hb_buf_ != nullptr)
+            {
+                current_hb_buf_ = current_hb_buf_->b_nxt_;
+    
+                if (current_hb_buf_ == hb_[current_hb_idx_].b_list_)
+                {
+                    do
+                    {
+                        ++current_hb_idx_;
+            
+                        if (current_hb_idx_ < hb_size_)
+                        {
+                            current_hb_buf_ = hb_[current_hb_idx_].b_list_;
+                        }
+                        else
+                        {
+                            current_hb_buf_ = nullptr;
+                        }
+            
+                    } while (current_hb_idx_ < hb_size_ && current_hb_buf_ == nullptr);
+                }
+            }
+        
+            return *this;
+        }
+    
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --()
+        {
+            if (current_hb_buf_ != nullptr)
+            {
+                if (current_hb_buf_ == hb_[current_hb_idx_].b_list_)
+                {
+                    do
+                    {
+                        if (current_hb_idx_ > 0)
+                        {
+                            --current_hb_idx_;
+                            current_hb_buf_ = hb_[current_hb_idx_].b_list_;
+                        }
+                        else
+                        {
+                            current_hb_buf_ = nullptr;
+                        }
+            
+                    } while (current_hb_idx_ > 0 && current_hb_buf_ == nullptr);
+                }
+    
+                if (current_hb_buf_ != nullptr)
+                {
+                    current_hb_buf_ = current_hb_buf_->b_prev_;
+                }
+            }
+    
+            return *this;
+        }
+    
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return current_hb_buf_ == rhs.current_hb_buf_;
+        }
+    
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return current_hb_buf_ == nullptr;
+        }
+    
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        const value_type& operator *() const
+        {
+            return current_hb_buf_->get_value();
+        }
+    
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        const value_type* operator ->() const
+        {
+            return &current_hb_buf_->get_value();
+        }
+    
+        friend class cache_base;
+
+    protected:
+        /** The hash buffer. */
+        hash_buffer* hb_ = nullptr;
+        
+        /** The hash buffer size. */
+        std::size_t hb_size_ = 0;
+        
+        /** The current hash buffer index. */
+        std::size_t current_hb_idx_ = 0;
+    
+        /** The current hash buffer buffer. */
+        buffer* current_hb_buf_ = nullptr;
+    };
+    
+    /**
+     * @brief       Class that represents iterators.
+     */
+    class iterator : public const_mutable_iterator_base<value_type, const_iterator, iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = iterator;
+    
+        /** The const iterator base. */
+        using const_self_type = const_iterator;
+    
+        /** The base class. */
+        using base_type = const_mutable_iterator_base<value_type, const_iterator, iterator>;
+    
+        /** The node iteration type. */
+        using node_type = buffer;
+    
+        using base_type::operator ++;
+        using base_type::operator --;
+   
+        /**
+         * @brief       Default constructor.
+         */
+        iterator() = default;
+    
+        /**
+         * @brief       Constructor with parameters.
+         * @param       hb : The hash buffer.
+         * @param       hb_size : The hash buffer size.
+         * @param       current_hb_idx : The current hash buffer.
+         * @param       current_hb_buf : The current buffer in the hash buffer.
+         */
+        iterator(
+                hash_buffer* hb,
+                std::size_t hb_size,
+                std::size_t current_hb_idx,
+                buffer* current_hb_buf
+        ) noexcept
+                : base_type(hb, hb_size, current_hb_idx, current_hb_buf)
+        {
+        }
+    
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++()
+        {
+            const_self_type::operator ++();
+            
+            return *this;
+        }
+    
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --()
+        {
+            const_self_type::operator --();
+            
+            return *this;
+        }
+    
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return const_self_type::operator ==(rhs);
+        }
+    
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return const_self_type::end();
+        }
+    
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        value_type& operator *()
+        {
+            return const_self_type::current_hb_buf_->get_value();
+        }
+    
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        value_type* operator ->()
+        {
+            return &const_self_type::current_hb_buf_->get_value();
+        }
+    
+        friend class cache_base;
+    };
+    
+    /** @cond */
+    cache_base(const cache_base& rhs) = delete;
+    
+    cache_base(cache_base&& rhs) = delete;
+    
+    cache_base& operator =(const cache_base& rhs) = delete;
+    
+    cache_base& operator =(cache_base&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Get the first element iterator of the container.
+     * @return      The first element iterator of the container.
+     */
+    iterator begin() noexcept
+    {
+        hash_buffer* const hbuf = derived().get_hash_buffer();
+        const std::size_t hbuf_sz = derived().get_hash_buffer_size();
+        buffer* current_buf = hbuf[0].b_list_;
+        std::size_t current_hb_idx = 0;
+        
+        while (current_buf == nullptr && ++current_hb_idx < hbuf_sz)
+        {
+            current_buf = hbuf[current_hb_idx].b_list_;
+        }
+        
+        return iterator(hbuf, hbuf_sz, current_hb_idx, current_buf);
+    }
+    
+    /**
+     * @brief       Get the first element const iterator of the container.
+     * @return      The first element const iterator of the container.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return const_cast<cache_base*>(this)->begin();
+    }
+    
+    /**
+     * @brief       Get an iterator to the past-the-end element in the container.
+     * @return      An iterator to the past-the-end element in the container.
+     */
+    iterator end() noexcept
+    {
+        const std::size_t hbuf_sz = derived().get_hash_buffer_size();
+        
+        return iterator(derived().get_hash_buffer(), hbuf_sz, hbuf_sz, nullptr);
+    }
+    
+    /**
+     * @brief       Get a const iterator to the past-the-end element in the container.
+     * @return      A const iterator to the past-the-end element in the container
+     */
+    const_iterator cend() const noexcept
+    {
+        const std::size_t hbuf_sz = derived().get_hash_buffer_size();
+        
+        return const_iterator(derived().get_hash_buffer(), hbuf_sz, hbuf_sz, nullptr);
+    }
+    
+    /**
+     * @brief       Erase from the available list the element.
+     * @param       it : The element to erase from the available list.
+     */
+    void lock(const_iterator& it) noexcept
+    {
+        if (it.current_hb_buf_->flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+        {
+            lock_buffer(it.current_hb_buf_);
+            stats_.on_lock();
+        }
+    }
+    
+    /**
+     * @brief       Erase from the available list the element with the specified key.
+     * @param       ky : The element key.
+     */
+    void lock(const key_type& ky) noexcept
+    {
+        iterator it = find(ky);
+        
+        if (!it.end())
+        {
+            lock(it);
+        }
+    }
+    
+    /**
+     * @brief       Erase from the available list the element with a key equivalent to the
+     *              specified one.
+     * @param       ky : A value equivalent to the element key.
+     */
+    template<typename KeyT_>
+    requires TRANSPARENT_LOOKUP && (!std::is_base_of_v<const_iterator, KeyT_>)
+    void lock(const KeyT_& ky) noexcept
+    {
+        iterator it = find(ky);
+        
+        if (!it.end())
+        {
+            lock(it);
+        }
+    }
+    
+    /**
+     * @brief       Insert in the available list the specified element.
+     * @param       it : The element to insert in the available list.
+     */
+    void unlock(const_iterator& it) noexcept
+    {
+        if (!it.current_hb_buf_->flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+        {
+            plcy_.on_unlock(it.current_hb_buf_);
+            it.current_hb_buf_->flgs_.set(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+            stats_.on_unlock();
+        }
+    }
+    
+    /**
+     * @brief       Insert in the available list the element with the specified key.
+     * @param       ky : The element key.
+     */
+    void unlock(const key_type& ky) noexcept
+    {
+        iterator it = find(ky);
+        
+        if (!it.end())
+        {
+            unlock(it);
+        }
+    }
+    
+    /**
+     * @brief       Insert in the available list the element with a key equivalent to the
+     *              specified one.
+     * @param       ky : A value equivalent to the element key.
+     */
+    template<typename KeyT_>
+    requires TRANSPARENT_LOOKUP && (!std::is_base_of_v<const_iterator, KeyT_>)
+    void unlock(const KeyT_& ky) noexcept
+    {
+        iterator it = find(ky);
+        
+        if (!it.end())
+        {
+            unlock(it);
+        }
+    }
+    
+    /**
+     * @brief       Find the key associated value.
+     * @param       ky : The key.
+     * @return      If function was successful an iterator to the key associated value is returned,
+     *              an end iterator is returned.
+     */
+    iterator find(const key_type& ky) noexcept
+    {
+        return find_key(ky, get_hash(ky));
+    }
+    
+    /**
+     * @brief       Find the value associated with a key equivalent to the specified one.
+     * @param       ky : A value equivalent to the key.
+     * @return      If function was successful an iterator to the key associated value is returned,
+     *              an end iterator is returned.
+     */
+    template<typename KeyT_>
+    requires TRANSPARENT_LOOKUP && (!std::is_base_of_v<const_iterator, KeyT_>)
+    iterator find(const KeyT_& ky) noexcept
+    {
+        return find_key(ky, get_hash(ky));
+    }
+    
+    /**
+     * @brief       Find the key associated value and remove it from the available list.
+     * @param       ky : The key.
+     * @return      If function was successful an iterator to the key associated value is returned,
+     *              an end iterator is returned.
+     */
+    iterator find_and_lock(const key_type& ky) noexcept
+    {
+        iterator it = find(ky);
+        
+        if (!it.end())
+        {
+            lock(it);
+        }
+    
+        return it;
+    }
+    
+    /**
+     * @brief       Find the value associated with a key equivalent to the specified one and remove
+     *              it from the available list.
+     * @param       ky : A value equivalent to the key.
+     * @return      If function was successful an iterator to the key associated value is returned,
+     *              an end iterator is returned.
+     */
+    template<typename KeyT_>
+    requires TRANSPARENT_LOOKUP && (!std::is_base_of_v<const_iterator, KeyT_>)
+    iterator find_and_lock(const KeyT_& ky) noexcept
+    {
+        iterator it = find(ky);
+        
+        if (!it.end())
+        {
+            lock(it);
+        }
+    
+        return it;
+    }
+    
+    /**
+     * @brief       Find the values associated with several keys. The keys are processed in groups
+     *              whose hashes are all computed and whose lists and first buffers are prefetched
+     *              before any of them is resolved, so the memory accesses of a group overlap
+     *              instead of forming a chain per key.
+     * @param       kys : The keys.
+     * @param       its : The iterators in which to store the results, each one being an end
+     *              iterator if its key isn't in the container. It must hold as many iterators as
+     *              there are keys.
+     */
+    void find_batch(std::span<const key_type> kys, std::span<iterator> its) noexcept
+    {
+        std::size_t hshs[BATCH_SIZE];
+        
+        for (std::size_t offs = 0; offs < kys.size(); offs += BATCH_SIZE)
+        {
+            const std::size_t n_kys = std::min(BATCH_SIZE, kys.size() - offs);
+            
+            prefetch_batch(kys.subspan(offs, n_kys), hshs);
+            
+            for (std::size_t i = 0; i < n_kys; ++i)
+            {
+                its[offs + i] = find_key(kys[offs + i], hshs[i]);
+            }
+        }
+    }
+    
+    /**
+     * @brief       Insert several key value pairs in the container. The keys are processed in
+     *              groups that are hashed and prefetched as in find_batch().
+     * @param       kys : The keys.
+     * @param       vals : The values, there must be as many values as keys.
+     * @throw       speed::containers::insertion_exception : If a key is already in the container,
+     *              in which case the pairs that precede it are inserted.
+     */
+    void insert_batch(std::span<const key_type> kys, std::span<const value_type> vals)
+    {
+        std::size_t hshs[BATCH_SIZE];
+        
+        for (std::size_t offs = 0; offs < kys.size(); offs += BATCH_SIZE)
+        {
+            const std::size_t n_kys = std::min(BATCH_SIZE, kys.size() - offs);
+            
+            prefetch_batch(kys.subspan(offs, n_kys), hshs);
+            
+            for (std::size_t i = 0; i < n_kys; ++i)
+            {
+                derived().insert_hashed(hshs[i], kys[offs + i], vals[offs + i]);
+            }
+        }
+    }
+    
+    /**
+     * @brief       Insert a key value pair in the container.
+     * @param       ky : The key.
+     * @param       val : The value.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename KeyT_, typename ValueT_>
+    iterator insert(KeyT_&& ky, ValueT_&& val)
+    {
+        const std::size_t hsh = get_hash<lookup_key_t<KeyT_>>(ky);
+        
+        return derived().insert_hashed(hsh, std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+    }
+    
+    /**
+     * @brief       Insert a key value pair in the container and erase it from the available list.
+     * @param       ky : The key.
+     * @param       val : The value.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename KeyT_, typename ValueT_>
+    iterator insert_and_lock(KeyT_&& ky, ValueT_&& val)
+    {
+        iterator it = insert(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+        lock(it);
+        
+        return it;
+    }
+    
+    /**
+     * @brief       Insert a key whose value is constructed in place from the specified arguments,
+     *              unless the key is already in the container, in which case nothing is
+     *              constructed.
+     * @param       ky : The key.
+     * @param       args : The arguments to forward to the value constructor.
+     * @return      An iterator to the element with the key, and true if it has been inserted or
+     *              false if it was already in the container.
+     */
+    template<typename KeyT_, typename... Ts_>
+    std::pair<iterator, bool> try_emplace(KeyT_&& ky, Ts_&&... args)
+    {
+        const std::size_t hsh = get_hash<lookup_key_t<KeyT_>>(ky);
+        buffer* const buf = find_live_buffer<lookup_key_t<KeyT_>>(ky, hsh);
+        
+        if (buf != nullptr)
+        {
+            return {iterator(derived().get_hash_buffer(), derived().get_hash_buffer_size(),
+                             get_hash_buffer_index(hsh), buf), false};
+        }
+        
+        return {derived().insert_unique(hsh, std::forward<KeyT_>(ky), std::forward<Ts_>(args)...),
+                true};
+    }
+    
+    /**
+     * @brief       Check whether the least recently used element is free (never used). The least
+     *              recently used element is the one that the eviction policy would recycle next.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_least_recently_used_free() const
+    {
+        return !get_least_recently_used_buffer()->flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER);
+    }
+    
+    /**
+     * @brief       Get the least recently used element.
+     * @return      The least recently used element.
+     * @throw       speed::containers::empty_container_exception : If the least recently used
+     *              element is free, so it holds no value.
+     */
+    value_type& get_least_recently_used()
+    {
+        buffer* const buf = get_least_recently_used_buffer();
+        
+        if (!buf->flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER))
+        {
+            throw empty_container_exception();
+        }
+        
+        return buf->get_value();
+    }
+    
+    /**
+     * @brief       Save all the elements in a snapshot file, from the one that the eviction policy
+     *              would evict first to the most recently used, the locked elements going last.
+     *              The file is written next to the path and renamed over it once complete, so an
+     *              interrupted save never leaves a truncated snapshot. A snapshot can only be
+     *              loaded by a program built with the same compiler, see load_snapshot().
+     * @param       pth : The path of the snapshot file.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool save_snapshot(const std::filesystem::path& pth) const requires SNAPSHOTS
+    {
+        const std::vector<buffer*> bufs = get_buffers_in_eviction_order();
+        std::vector<std::byte> ents(bufs.size() * SNAPSHOT_ENTRY_SIZE);
+        std::byte* cur_ent = ents.data();
+        snapshot_header hdr;
+        std::filesystem::path tmp_pth = pth;
+        std::error_code err_code;
+        
+        for (const buffer* buf : bufs)
+        {
+            std::memcpy(cur_ent, buf->ky_stg_, sizeof(key_type));
+            std::memcpy(cur_ent + sizeof(key_type), buf->val_stg_, sizeof(value_type));
+            cur_ent += SNAPSHOT_ENTRY_SIZE;
+        }
+        
+        hdr.n_ents_ = bufs.size();
+        hdr.chcksm_ = cryptography::city_hash_64(ents.data(), ents.size());
+        tmp_pth += ".tmp";
+        
+        {
+            std::ofstream ofs(tmp_pth, std::ios::binary | std::ios::trunc);
+            
+            ofs.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+            ofs.write(reinterpret_cast<const char*>(ents.data()),
+                      static_cast<std::streamsize>(ents.size()));
+            ofs.close();
+            
+            if (!ofs)
+            {
+                std::filesystem::remove(tmp_pth, err_code);
+                return false;
+            }
+        }
+        
+        std::filesystem::rename(tmp_pth, pth, err_code);
+        
+        return !err_code;
+    }
+    
+    /**
+     * @brief       Insert the elements saved in a snapshot file, in the order in which they were
+     *              saved, so they are evicted in the same order. The whole file is validated
+     *              before anything is inserted: it has to come from a cache with the same key and
+     *              value types, and its checksum has to match. The types are told apart by their
+     *              typeid names, which are implementation defined, so a snapshot saved by a
+     *              program built with another compiler may be rejected. The elements whose key is
+     *              already in the container are skipped, and when there are more elements than
+     *              buffers the oldest ones are evicted by the newest.
+     * @param       pth : The path of the snapshot file.
+     * @return      If function was successful true is returned, otherwise false is returned and
+     *              the container is left unchanged.
+     * @throw       speed::containers::exhausted_resources_exception : If an element can't be
+     *              inserted, for instance because of the locked elements. The elements inserted
+     *              before stay in the container and the ones they evicted aren't restored.
+     */
+    bool load_snapshot(const std::filesystem::path& pth) requires SNAPSHOTS
+    {
+        std::ifstream ifs(pth, std::ios::binary | std::ios::ate);
+        snapshot_header hdr;
+        
+        if (!ifs)
+        {
+            return false;
+        }
+        
+        const auto fl_sz = static_cast<std::uint64_t>(ifs.tellg());
+        ifs.seekg(0);
+        
+        if (fl_sz < sizeof(hdr) || !ifs.read(reinterpret_cast<char*>(&hdr), sizeof(hdr)) ||
+            !snapshot_header().is_compatible(hdr) ||
+            hdr.n_ents_ != (fl_sz - sizeof(hdr)) / SNAPSHOT_ENTRY_SIZE ||
+            (fl_sz - sizeof(hdr)) % SNAPSHOT_ENTRY_SIZE != 0)
+        {
+            return false;
+        }
+        
+        std::vector<std::byte> ents(hdr.n_ents_ * SNAPSHOT_ENTRY_SIZE);
+        
+        if (!ifs.read(reinterpret_cast<char*>(ents.data()),
+                      static_cast<std::streamsize>(ents.size())) ||
+            cryptography::city_hash_64(ents.data(), ents.size()) != hdr.chcksm_)
+        {
+            return false;
+        }
+        
+        for (const std::byte* cur_ent = ents.data(); cur_ent != ents.data() + ents.size();
+             cur_ent += SNAPSHOT_ENTRY_SIZE)
+        {
+            std::array<std::byte, sizeof(key_type)> ky_bytes;
+            std::array<std::byte, sizeof(value_type)> val_bytes;
+            
+            std::memcpy(ky_bytes.data(), cur_ent, sizeof(key_type));
+            std::memcpy(val_bytes.data(), cur_ent + sizeof(key_type), sizeof(value_type));
+            try_emplace(std::bit_cast<key_type>(ky_bytes), std::bit_cast<value_type>(val_bytes));
+        }
+        
+        return true;
+    }
+    
+    /**
+     * @brief       Get the statistics recorded by the statistics policy.
+     * @return      The statistics recorded by the statistics policy.
+     */
+    [[nodiscard]] cache_statistics get_statistics() const noexcept
+    {
+        return stats_.snapshot();
+    }
+
+protected:
+    /** The identifier written at the start of the snapshot files, "SPDCACHE" in little endian. */
+    static constexpr std::uint64_t SNAPSHOT_MAGIC = 0x4548434143445053ull;
+    
+    /** The version of the snapshot files format. */
+    static constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+    
+    /** The size of an element in the snapshot files. */
+    static constexpr std::size_t SNAPSHOT_ENTRY_SIZE = sizeof(key_type) + sizeof(value_type);
+    
+    /**
+     * @brief       Struct that represents the header of the snapshot files. The elements follow
+     *              it, every key being directly followed by its value.
+     */
+    struct snapshot_header
+    {
+        /** The snapshot files identifier, it also rejects the files of another endianness. */
+        std::uint64_t mgc_ = SNAPSHOT_MAGIC;
+        
+        /** The snapshot files format version. */
+        std::uint32_t vrsn_ = SNAPSHOT_VERSION;
+        
+        /** The size of the header. */
+        std::uint32_t hdr_sz_ = sizeof(snapshot_header);
+        
+        /** The size of the keys. */
+        std::uint32_t ky_sz_ = sizeof(key_type);
+        
+        /** The size of the values. */
+        std::uint32_t val_sz_ = sizeof(value_type);
+        
+        /** The hash of the key and value type names, only stable for a given compiler. */
+        std::uint64_t typs_hsh_ = get_types_hash();
+        
+        /** The number of elements. */
+        std::uint64_t n_ents_ = 0;
+        
+        /** The hash of the elements. */
+        std::uint64_t chcksm_ = 0;
+        
+        /**
+         * @brief       Check whether the elements of a snapshot file can be loaded in this cache,
+         *              being this the header of this cache.
+         * @param       rhs : The header of the snapshot file.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool is_compatible(const snapshot_header& rhs) const noexcept
+        {
+            return mgc_ == rhs.mgc_ && vrsn_ == rhs.vrsn_ && hdr_sz_ == rhs.hdr_sz_ &&
+                   ky_sz_ == rhs.ky_sz_ && val_sz_ == rhs.val_sz_ && typs_hsh_ == rhs.typs_hsh_;
+        }
+        
+        /**
+         * @brief       Get the hash of the key and value type names.
+         * @return      The hash of the key and value type names.
+         */
+        static std::uint64_t get_types_hash()
+        {
+            return cryptography::city_hash_64(std::string_view(typeid(key_type).name())) * 31 +
+                   cryptography::city_hash_64(std::string_view(typeid(value_type).name()));
+        }
+    };
+    
+    /**
+     * @brief       Default constructor.
+     */
+    cache_base() noexcept = default;
+    
+    /**
+     * @brief       Make all the buffers free and available. It has to be called by the derived
+     *              class once its buffers are constructed.
+     * @param       bufs : The first buffer.
+     * @param       n_bufs : The number of buffers.
+     */
+    void initialize(buffer* bufs, std::size_t n_bufs)
+            noexcept(noexcept(std::declval<policy_type&>().initialize(bufs, n_bufs)))
+    {
+        initialize(bufs, n_bufs, plcy_);
+    }
+    
+    /**
+     * @brief       Make all the buffers free and available in an eviction policy that isn't yet the
+     *              one of the container, so the derived class can prepare new buffers before it
+     *              replaces the current ones.
+     * @param       bufs : The first buffer.
+     * @param       n_bufs : The number of buffers.
+     * @param       plcy : The eviction policy.
+     */
+    static void initialize(buffer* bufs, std::size_t n_bufs, policy_type& plcy)
+            noexcept(noexcept(plcy.initialize(bufs, n_bufs)))
+    {
+        for (std::size_t i = 0; i < n_bufs; i++)
+        {
+            bufs[i].flgs_.set(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+        }
+        
+        plcy.initialize(bufs, n_bufs);
+    }
+    
+    /**
+     * @brief       Destroy the keys and the values held by the buffers. It has to be called by the
+     *              derived class before its buffers are destroyed.
+     * @param       bufs : The first buffer.
+     * @param       n_bufs : The number of buffers.
+     */
+    static void destroy_elements(buffer* bufs, std::size_t n_bufs) noexcept
+    {
+        for (std::size_t i = 0; i < n_bufs; i++)
+        {
+            if (bufs[i].flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER))
+            {
+                destroy_element(&bufs[i]);
+            }
+        }
+    }
+    
+    /**
+     * @brief       Get the derived class.
+     * @return      The derived class.
+     */
+    DerivedT& derived() noexcept
+    {
+        return static_cast<DerivedT&>(*this);
+    }
+    
+    /**
+     * @brief       Get the derived class.
+     * @return      The derived class.
+     */
+    const DerivedT& derived() const noexcept
+    {
+        return static_cast<const DerivedT&>(*this);
+    }
+    
+    /**
+     * @brief       Find the key associated value.
+     * @param       ky : The key, or a value equivalent to it.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful an iterator to the key associated value is returned,
+     *              an end iterator is returned.
+     */
+    template<typename KeyT_>
+    iterator find_key(const KeyT_& ky, std::size_t hsh) noexcept
+    {
+        buffer* const buf = find_live_buffer(ky, hsh);
+        
+        if (buf == nullptr)
+        {
+            stats_.on_miss();
+            return end();
+        }
+        
+        stats_.on_hit();
+        
+        if (buf->flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+        {
+            plcy_.on_hit(buf);
+        }
+        
+        return iterator(derived().get_hash_buffer(), derived().get_hash_buffer_size(),
+                        get_hash_buffer_index(hsh), buf);
+    }
+    
+    /**
+     * @brief       Insert a key value pair in the container once its key is hashed.
+     * @param       hsh : The hash of the key.
+     * @param       ky : The key.
+     * @param       val : The value.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename KeyT_, typename ValueT_>
+    iterator insert_hashed(std::size_t hsh, KeyT_&& ky, ValueT_&& val)
+    {
+        if (find_live_buffer<lookup_key_t<KeyT_>>(ky, hsh) != nullptr)
+        {
+            throw insertion_exception();
+        }
+        
+        return derived().insert_unique(
+                hsh, std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+    }
+    
+    /**
+     * @brief       Insert a key whose value is constructed from the specified arguments, knowing
+     *              that the key isn't in the container. The derived class can hide this function
+     *              to control how the elements are admitted.
+     * @param       hsh : The hash of the key.
+     * @param       ky : The key.
+     * @param       args : The arguments to forward to the value constructor.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename KeyT_, typename... Ts_>
+    iterator insert_unique(std::size_t hsh, KeyT_&& ky, Ts_&&... args)
+    {
+        return emplace_in_victim(hsh, std::forward<KeyT_>(ky), std::forward<Ts_>(args)...);
+    }
+    
+    /**
+     * @brief       Construct a key and its value in the buffer the eviction policy recycles next,
+     *              destroying the element it held, and link it in the hash buffer.
+     * @param       hsh : The hash of the key.
+     * @param       ky : The key.
+     * @param       args : The arguments to forward to the value constructor.
+     * @return      An iterator to the inserted element.
+     * @throw       The exceptions thrown by the constructors, in which case the buffer is left
+     *              free.
+     */
+    template<typename KeyT_, typename... Ts_>
+    iterator emplace_in_victim(std::size_t hsh, KeyT_&& ky, Ts_&&... args)
+    {
+        buffer* buf = get_least_recently_used_buffer();
+        const bool evctd = buf->flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER);
+        
+        if (evctd)
+        {
+            erase_from_hash_buffer(buf);
+            derived().on_buffer_erased(buf);
+            destroy_element(buf);
+            stats_.on_eviction();
+        }
+        
+        try
+        {
+            construct_element(buf, std::forward<KeyT_>(ky), std::forward<Ts_>(args)...);
+        }
+        catch (...)
+        {
+            if (evctd)
+            {
+                plcy_.on_erase(buf);
+            }
+            
+            throw;
+        }
+        
+        buf->hsh_ = hsh;
+        insert_in_hash_buffer_list(buf);
+        plcy_.on_insert(buf, hsh);
+        stats_.on_insert();
+    
+        return iterator(derived().get_hash_buffer(), derived().get_hash_buffer_size(),
+                        get_hash_buffer_index(hsh), buf);
+    }
+    
+    /**
+     * @brief       Hash a group of keys and prefetch their hash buffer lists, then the first
+     *              buffer of every list.
+     * @param       kys : The keys, at most BATCH_SIZE.
+     * @param       hshs : The array in which to store the hashes.
+     */
+    void prefetch_batch(std::span<const key_type> kys, std::size_t* hshs) const noexcept
+    {
+        hash_buffer* const hbuf = derived().get_hash_buffer();
+        
+        for (std::size_t i = 0; i < kys.size(); ++i)
+        {
+            hshs[i] = get_hash(kys[i]);
+            lowlevel::prefetch(&hbuf[get_hash_buffer_index(hshs[i])]);
+        }
+        
+        for (std::size_t i = 0; i < kys.size(); ++i)
+        {
+            const buffer* const buf = hbuf[get_hash_buffer_index(hshs[i])].b_list_;
+            
+            if (buf != nullptr)
+            {
+                lowlevel::prefetch(buf);
+                lowlevel::prefetch(buf->ky_stg_);
+            }
+        }
+    }
+    
+    /**
+     * @brief       Get the hash of a key.
+     * @param       ky : The key, or a value equivalent to it.
+     * @return      The hash of the key.
+     */
+    template<typename KeyT_>
+    static std::size_t get_hash(const KeyT_& ky) noexcept
+    {
+        return static_cast<std::size_t>(hash_type()(ky));
+    }
+    
+    /**
+     * @brief       Get the hash buffer index associated with a hash. Hashes such as
+     *              std::hash<int> and std::hash<T*> are the identity, so the hash is multiplied by
+     *              the 64-bit golden ratio and the index is taken from the high bits of the
+     *              product, which depend on all the bits of the hash.
+     * @param       hsh : The hash.
+     * @return      The hash buffer index associated with the hash.
+     */
+    [[nodiscard]] std::size_t get_hash_buffer_index(std::size_t hsh) const noexcept
+    {
+        const int hbuf_bits = std::countr_zero(derived().get_hash_buffer_size());
+        const std::uint64_t mixd_hsh = static_cast<std::uint64_t>(hsh) * 0x9E3779B97F4A7C15ull;
+        
+        return hbuf_bits == 0 ? 0 : static_cast<std::size_t>(mixd_hsh >> (64 - hbuf_bits));
+    }
+    
+    /**
+     * @brief       Find the buffer that holds a key. The stored hashes are compared before the
+     *              keys, so the predicate is only called for the likely matches.
+     * @param       ky : The key, or a value equivalent to it.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful the buffer is returned, otherwise nullptr is
+     *              returned.
+     */
+    template<typename KeyT_>
+    buffer* find_buffer(const KeyT_& ky, std::size_t hsh) const noexcept
+    {
+        buffer* const first = derived().get_hash_buffer()[get_hash_buffer_index(hsh)].b_list_;
+        buffer* cur = first;
+        std::size_t n_prbs = 0;
+        pred_type equal_to;
+        
+        if (first != nullptr)
+        {
+            do
+            {
+                ++n_prbs;
+                
+                if (cur->hsh_ == hsh && equal_to(cur->get_key(), ky))
+                {
+                    stats_.on_probe(n_prbs);
+                    return cur;
+                }
+                
+                cur = cur->b_nxt_;
+                
+            } while (cur != first);
+        }
+        
+        stats_.on_probe(n_prbs);
+        
+        return nullptr;
+    }
+    
+    /**
+     * @brief       Find the buffer that holds a key that hasn't expired. An available buffer whose
+     *              key has expired is released, so it is recycled before any other.
+     * @param       ky : The key, or a value equivalent to it.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful the buffer is returned, otherwise nullptr is
+     *              returned.
+     */
+    template<typename KeyT_>
+    buffer* find_live_buffer(const KeyT_& ky, std::size_t hsh) noexcept
+    {
+        buffer* const buf = find_buffer(ky, hsh);
+        
+        if (buf != nullptr && buf->flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST) &&
+            derived().is_buffer_expired(buf))
+        {
+            release_buffer(buf);
+            
+            return nullptr;
+        }
+        
+        return buf;
+    }
+    
+    /**
+     * @brief       Erase an available buffer from the hash buffer and make it free, so it is the
+     *              next one to be recycled.
+     * @param       buf : The buffer to release.
+     */
+    void release_buffer(buffer* buf) noexcept
+    {
+        erase_from_hash_buffer(buf);
+        derived().on_buffer_erased(buf);
+        destroy_element(buf);
+        plcy_.on_erase(buf);
+    }
+    
+    /**
+     * @brief       Construct a key and its value in a buffer that holds none.
+     * @param       buf : The buffer.
+     * @param       ky : The key.
+     * @param       args : The arguments to forward to the value constructor.
+     * @throw       The exceptions thrown by the constructors, in which case the buffer still
+     *              holds nothing.
+     */
+    template<typename KeyT_, typename... Ts_>
+    static void construct_element(buffer* buf, KeyT_&& ky, Ts_&&... args)
+    {
+        memory::construct_at(reinterpret_cast<key_type*>(buf->ky_stg_), std::forward<KeyT_>(ky));
+        
+        try
+        {
+            memory::construct_at(reinterpret_cast<value_type*>(buf->val_stg_),
+                                 std::forward<Ts_>(args)...);
+        }
+        catch (...)
+        {
+            memory::destroy_at(&buf->get_key());
+            throw;
+        }
+    }
+    
+    /**
+     * @brief       Destroy the key and the value held by a buffer.
+     * @param       buf : The buffer.
+     */
+    static void destroy_element(buffer* buf) noexcept
+    {
+        memory::destroy_at(&buf->get_value());
+        memory::destroy_at(&buf->get_key());
+    }
+    
+    /**
+     * @brief       Erase an available buffer from the available list.
+     * @param       buf : The buffer to lock.
+     */
+    void lock_buffer(buffer* buf) noexcept
+    {
+        plcy_.on_lock(buf);
+        buf->flgs_.unset(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+    }
+    
+    /**
+     * @brief       Insert a buffer in the end of a hash buffer.
+     * @param       buf : The buffer to insert.
+     */
+    void insert_in_hash_buffer_list(buffer* buf) noexcept
+    {
+        buffer** const pb_list =
+                &derived().get_hash_buffer()[get_hash_buffer_index(buf->hsh_)].b_list_;
+        
+        if (*pb_list == nullptr)
+        {
+            *pb_list = buf;
+            buf->b_nxt_ = buf;
+            buf->b_prev_ = buf;
+        }
+        else
+        {
+            buf->b_prev_ = (*pb_list)->b_prev_;
+            buf->b_nxt_ = *pb_list;
+            (*pb_list)->b_prev_->b_nxt_ = buf;
+            (*pb_list)->b_prev_ = buf;
+        }
+    
+        buf->flgs_.set(scbf_t::INSERTED_IN_HASH_BUFFER);
+    }
+    
+    /**
+     * @brief       Erase the specified buffer from the hash buffer.
+     * @param       buf : The buffer to erase.
+     */
+    void erase_from_hash_buffer(buffer* buf) noexcept
+    {
+        buffer** const pb_list =
+                &derived().get_hash_buffer()[get_hash_buffer_index(buf->hsh_)].b_list_;
+        
+        if (buf->b_nxt_ == buf)
+        {
+            *pb_list = nullptr;
+        }
+        else
+        {
+            if (buf == *pb_list)
+            {
+                *pb_list = (*pb_list)->b_nxt_;
+            }
+            
+            buf->b_prev_->b_nxt_ = buf->b_nxt_;
+            buf->b_nxt_->b_prev_ = buf->b_prev_;
+        }
+    
+        buf->flgs_.unset(scbf_t::INSERTED_IN_HASH_BUFFER);
+    }
+    
+    /**
+     * @brief       Get the least recently used buffer in the available list.
+     * @return      The least recently used buffer in the available list.
+     */
+    buffer* get_least_recently_used_buffer() const
+    {
+        buffer* const buf = plcy_.get_victim();
+        
+        if (buf == nullptr)
+        {
+            stats_.on_exhausted();
+            throw exhausted_resources_exception();
+        }
+        
+        return buf;
+    }
+    
+    /**
+     * @brief       Get the buffers that hold an element, the available ones in the order in which
+     *              the eviction policy would evict them followed by the locked ones.
+     * @return      The buffers that hold an element.
+     */
+    std::vector<buffer*> get_buffers_in_eviction_order() const
+    {
+        hash_buffer* const hbuf = derived().get_hash_buffer();
+        const std::size_t hbuf_sz = derived().get_hash_buffer_size();
+        std::vector<buffer*> bufs;
+        
+        bufs.reserve(hbuf_sz / 2);
+        
+        plcy_.for_each_in_eviction_order([&bufs](buffer* avl_buf)
+        {
+            if (avl_buf->flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER))
+            {
+                bufs.push_back(avl_buf);
+            }
+        });
+        
+        for (std::size_t i = 0; i < hbuf_sz; ++i)
+        {
+            buffer* const first = hbuf[i].b_list_;
+            buffer* cur = first;
+            
+            if (first == nullptr)
+            {
+                continue;
+            }
+            
+            do
+            {
+                if (!cur->flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+                {
+                    bufs.push_back(cur);
+                }
+                
+                cur = cur->b_nxt_;
+                
+            } while (cur != first);
+        }
+        
+        return bufs;
+    }
+    
+    /**
+     * @brief       Get the buffer an iterator points to.
+     * @param       it : The iterator.
+     * @return      The buffer the iterator points to.
+     */
+    static buffer* get_buffer(const const_iterator& it) noexcept
+    {
+        return it.current_hb_buf_;
+    }
+    
+    /**
+     * @brief       Check whether the key of an available buffer has expired. The derived class
+     *              can hide this function to make its keys expire, by default they never do.
+     * @param       buf : The buffer to check.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] static constexpr bool is_buffer_expired(const buffer* buf) noexcept
+    {
+        (void)buf;
+        return false;
+    }
+    
+    /**
+     * @brief       Notify that a buffer has been erased from the hash buffer. The derived class
+     *              can hide this function to drop the state it keeps for the buffer key.
+     * @param       buf : The buffer erased.
+     */
+    static constexpr void on_buffer_erased(buffer* buf) noexcept
+    {
+        (void)buf;
+    }
+    
+    /** The eviction policy, it orders the buffers in the available list. */
+    mutable policy_type plcy_;
+    
+    /** The statistics policy, it is notified from const functions as well. */
+    [[no_unique_address]] mutable statistics_type stats_;
+};
+
+}
+
+#endif
@@ -0,0 +1,184 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       clock_eviction_policy.hpp
+ * @brief      clock_eviction_policy class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_CLOCK_EVICTION_POLICY_HPP
+#define SPEED_CONTAINERS_CLOCK_EVICTION_POLICY_HPP
+
+#include <atomic>
+#include <cstddef>
+
+#include "detail/eviction_list.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a CLOCK (second chance) eviction policy. The available
+ *              nodes are kept in a circular list swept by a hand. A hit only sets the reference
+ *              bit of the node, and looking for a victim clears the bits of the referenced nodes
+ *              the hand passes over until it reaches an unreferenced one. Since the reference
+ *              bit is atomic, several readers can record hits at once.
+ */
+template<typename NodeT>
+class clock_eviction_policy
+{
+public:
+    /** The node type. */
+    using node_type = NodeT;
+
+    /** Whether on_hit can be called by several readers at once. */
+    static constexpr bool CONCURRENT_HITS = true;
+
+    /**
+     * @brief       Struct that represents the state kept in every node.
+     */
+    struct hook_type
+    {
+        /** Pointer to the next node in the clock. */
+        node_type* av_nxt_;
+
+        /** Pointer to the previous node in the clock. */
+        node_type* av_prev_;
+
+        /** Whether the node has been referenced since the hand last passed over it. */
+        std::atomic<bool> ref_ = false;
+    };
+
+    /**
+     * @brief       Make the specified nodes free and available.
+     * @param       nds : The first node.
+     * @param       n_nds : The number of nodes.
+     */
+    void initialize(node_type* nds, std::size_t n_nds) noexcept
+    {
+        clck_.clear();
+
+        for (std::size_t i = 0; i < n_nds; i++)
+        {
+            nds[i].plcy_hk_.ref_.store(false, std::memory_order_relaxed);
+            clck_.push_back(&nds[i]);
+        }
+    }
+
+    /**
+     * @brief       Sweep the clock until an unreferenced node is under the hand.
+     * @return      The node under the hand, or nullptr if there is no available node.
+     */
+    node_type* get_victim() noexcept
+    {
+        node_type* hnd = clck_.front();
+
+        if (hnd != nullptr)
+        {
+            while (hnd->plcy_hk_.ref_.load(std::memory_order_relaxed))
+            {
+                hnd->plcy_hk_.ref_.store(false, std::memory_order_relaxed);
+                clck_.move_to_back(hnd);
+                hnd = clck_.front();
+            }
+        }
+
+        return hnd;
+    }
+
+    /**
+     * @brief       Notify that the victim holds a new key. The hand moves past it, so the new key
+     *              survives at least one full sweep.
+     * @param       nd : The victim.
+     * @param       hsh : The hash of the new key.
+     */
+    void on_insert(node_type* nd, std::size_t hsh) noexcept
+    {
+        (void)hsh;
+        nd->plcy_hk_.ref_.store(false, std::memory_order_relaxed);
+
+        if (nd == clck_.front())
+        {
+            clck_.move_to_back(nd);
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been found.
+     * @param       nd : The node found.
+     */
+    void on_hit(node_type* nd) noexcept
+    {
+        if (!nd->plcy_hk_.ref_.load(std::memory_order_relaxed))
+        {
+            nd->plcy_hk_.ref_.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been locked.
+     * @param       nd : The node locked.
+     */
+    void on_lock(node_type* nd) noexcept
+    {
+        clck_.erase(nd);
+    }
+
+    /**
+     * @brief       Notify that a locked node has been unlocked.
+     * @param       nd : The node unlocked.
+     */
+    void on_unlock(node_type* nd) noexcept
+    {
+        nd->plcy_hk_.ref_.store(false, std::memory_order_relaxed);
+        clck_.push_back(nd);
+    }
+
+    /**
+     * @brief       Notify that an available node no longer holds a key. It becomes free, so it is
+     *              the next one to be recycled.
+     * @param       nd : The node erased.
+     */
+    void on_erase(node_type* nd) noexcept
+    {
+        clck_.erase(nd);
+        nd->plcy_hk_.ref_.store(false, std::memory_order_relaxed);
+        clck_.push_front(nd);
+    }
+
+    /**
+     * @brief       Call a function on every available node, from the one under the hand to the one
+     *              the hand will reach last, without modifying the policy.
+     * @param       fnc : The function to call.
+     */
+    template<typename FunctionT_>
+    void for_each_in_eviction_order(FunctionT_&& fnc) const
+    {
+        clck_.for_each(fnc);
+    }
+
+private:
+    /** The clock, its first node is the one under the hand. */
+    detail::eviction_list<node_type> clck_;
+};
+
+}
+
+#endif
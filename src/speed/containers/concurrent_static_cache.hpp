@@ -0,0 +1,564 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       concurrent_static_cache.hpp
+ * @brief      concurrent_static_cache class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_CONCURRENT_STATIC_CACHE_HPP
+#define SPEED_CONTAINERS_CONCURRENT_STATIC_CACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+#include "lru_eviction_policy.hpp"
+#include "no_statistics_policy.hpp"
+#include "static_cache.hpp"
+#include "statistics_policy.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a thread-safe generic static cache. The capacity is split
+ *              into a number of shards, each one being an independently locked static_cache. The
+ *              shard of a key is chosen through its hash, so operations on keys that live in
+ *              different shards never contend. Since iterators can't outlive the shard lock, the
+ *              values are accessed either by copy or through a function called under the lock.
+ *              Eviction is local to every shard, so a shard may evict an element while another
+ *              shard still has free buffers. When the eviction policy allows concurrent hits, as
+ *              the CLOCK policy does, every shard is protected by a reader-writer lock and the
+ *              lookups that only copy the value share it. The values can also be loaded through
+ *              get_or_compute(), which computes every missing value only once no matter how many
+ *              threads miss it at the same time.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        std::size_t SIZE,
+        std::size_t SHARDS = 16,
+        typename HashT = std::hash<KeyT>,
+        typename PredT = std::equal_to<KeyT>,
+        template<typename> class EvictionPolicyT = lru_eviction_policy,
+        typename StatisticsT = no_statistics_policy
+>
+class concurrent_static_cache
+{
+public:
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The hash type. */
+    using hash_type = HashT;
+
+    /** The predicate type. */
+    using pred_type = PredT;
+
+    /** The number of buffers held by every shard. */
+    static constexpr std::size_t SHARD_SIZE = (SIZE + SHARDS - 1) / SHARDS;
+
+    /** The cache used by every shard. */
+    using shard_cache_type = static_cache<
+            KeyT, ValueT, SHARD_SIZE, HashT, PredT, EvictionPolicyT, StatisticsT>;
+
+    /** Whether the lookups that don't modify the value can share the shard lock. */
+    static constexpr bool SHARED_LOOKUPS = shard_cache_type::policy_type::CONCURRENT_HITS;
+
+    /** The mutex type that protects every shard. */
+    using mutex_type = std::conditional_t<SHARED_LOOKUPS, std::shared_mutex, std::mutex>;
+
+    static_assert(SHARDS > 0 && SIZE >= SHARDS, "every shard must hold at least one buffer");
+
+    /**
+     * @brief       Default constructor.
+     */
+    concurrent_static_cache() = default;
+
+    /** @cond */
+    concurrent_static_cache(const concurrent_static_cache& rhs) = delete;
+
+    concurrent_static_cache(concurrent_static_cache&& rhs) = delete;
+
+    concurrent_static_cache& operator =(const concurrent_static_cache& rhs) = delete;
+
+    concurrent_static_cache& operator =(concurrent_static_cache&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Erase from the available list the element with the specified key.
+     * @param       ky : The element key.
+     */
+    void lock(const key_type& ky)
+    {
+        shard& shrd = get_shard(ky);
+        std::lock_guard<mutex_type> lck(shrd.mtx_);
+
+        shrd.cache_.lock(ky);
+    }
+
+    /**
+     * @brief       Insert in the available list the element with the specified key.
+     * @param       ky : The element key.
+     */
+    void unlock(const key_type& ky)
+    {
+        shard& shrd = get_shard(ky);
+        std::lock_guard<mutex_type> lck(shrd.mtx_);
+
+        shrd.cache_.unlock(ky);
+    }
+
+    /**
+     * @brief       Find the key associated value and copy it.
+     * @param       ky : The key.
+     * @param       val : The object in which copy the value.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool find(const key_type& ky, value_type& val)
+    {
+        shard& shrd = get_shard(ky);
+        read_lock_type lck(shrd.mtx_);
+        auto it = shrd.cache_.find(ky);
+
+        if (it.end())
+        {
+            return false;
+        }
+
+        val = *it;
+
+        return true;
+    }
+
+    /**
+     * @brief       Find the key associated value, copy it and remove it from the available list.
+     * @param       ky : The key.
+     * @param       val : The object in which copy the value.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool find_and_lock(const key_type& ky, value_type& val)
+    {
+        shard& shrd = get_shard(ky);
+        std::lock_guard<mutex_type> lck(shrd.mtx_);
+        auto it = shrd.cache_.find_and_lock(ky);
+
+        if (it.end())
+        {
+            return false;
+        }
+
+        val = *it;
+
+        return true;
+    }
+
+    /**
+     * @brief       Allows knowing whether a key is in the cache.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool contains(const key_type& ky)
+    {
+        shard& shrd = get_shard(ky);
+        read_lock_type lck(shrd.mtx_);
+
+        return !shrd.cache_.find(ky).end();
+    }
+
+    /**
+     * @brief       Call a function with the key associated value while holding its shard lock
+     *              exclusively.
+     * @param       ky : The key.
+     * @param       fnc : The function to call. It receives a reference to the value and it must
+     *              not access the cache.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename FunctionT_>
+    bool visit(const key_type& ky, FunctionT_&& fnc)
+    {
+        shard& shrd = get_shard(ky);
+        std::lock_guard<mutex_type> lck(shrd.mtx_);
+        auto it = shrd.cache_.find(ky);
+
+        if (it.end())
+        {
+            return false;
+        }
+
+        std::invoke(std::forward<FunctionT_>(fnc), *it);
+
+        return true;
+    }
+
+    /**
+     * @brief       Insert a key value pair in the container.
+     * @param       ky : The key.
+     * @param       val : The value.
+     */
+    template<typename KeyT_, typename ValueT_>
+    void insert(KeyT_&& ky, ValueT_&& val)
+    {
+        shard& shrd = get_shard(ky);
+        std::lock_guard<mutex_type> lck(shrd.mtx_);
+
+        shrd.cache_.insert(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+    }
+
+    /**
+     * @brief       Insert a key value pair in the container and erase it from the available list.
+     * @param       ky : The key.
+     * @param       val : The value.
+     */
+    template<typename KeyT_, typename ValueT_>
+    void insert_and_lock(KeyT_&& ky, ValueT_&& val)
+    {
+        shard& shrd = get_shard(ky);
+        std::lock_guard<mutex_type> lck(shrd.mtx_);
+
+        shrd.cache_.insert_and_lock(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+    }
+
+    /**
+     * @brief       Find the key associated value and copy it, or compute it and insert it if the
+     *              key isn't in the cache. When several threads miss the same key at once, only
+     *              one of them calls the loader while the others wait for its result, so the
+     *              value is computed and inserted once. The loader is called without holding
+     *              any lock, so if the key is inserted meanwhile that value is returned instead.
+     * @param       ky : The key.
+     * @param       ldr : The function that computes the value, it receives the key.
+     * @return      The key associated value.
+     * @throw       Any exception thrown by the loader or by the insertion, in which case the
+     *              threads that waited for the value throw it as well.
+     */
+    template<typename LoaderT_>
+    value_type get_or_compute(const key_type& ky, LoaderT_&& ldr)
+    {
+        return load<false>(ky, ldr);
+    }
+
+    /**
+     * @brief       Find the key associated value and copy it, or compute it and insert it if the
+     *              key isn't in the cache, and remove it from the available list. The value is
+     *              computed once as with get_or_compute().
+     * @param       ky : The key.
+     * @param       ldr : The function that computes the value, it receives the key.
+     * @return      The key associated value.
+     * @throw       Any exception thrown by the loader or by the insertion, in which case the
+     *              threads that waited for the value throw it as well.
+     */
+    template<typename LoaderT_>
+    value_type get_or_compute_and_lock(const key_type& ky, LoaderT_&& ldr)
+    {
+        return load<true>(ky, ldr);
+    }
+
+    /**
+     * @brief       Get the statistics recorded by the statistics policies of all the shards. The
+     *              shard locks aren't taken, so the operations in progress may be partly counted.
+     * @return      The sum of the statistics recorded by all the shards.
+     */
+    [[nodiscard]] cache_statistics get_statistics() const noexcept
+    {
+        cache_statistics stats;
+
+        for (const auto& shrd : shrds_)
+        {
+            stats += shrd.cache_.get_statistics();
+        }
+
+        return stats;
+    }
+
+    /**
+     * @brief       Get the number of shards.
+     * @return      The number of shards.
+     */
+    [[nodiscard]] static constexpr std::size_t get_shard_count() noexcept
+    {
+        return SHARDS;
+    }
+
+    /**
+     * @brief       Get the shard index associated with a key.
+     * @param       ky : The key.
+     * @return      The shard index associated with the key.
+     */
+    [[nodiscard]] static std::size_t get_shard_index(const key_type& ky) noexcept
+    {
+        auto hash_ky = static_cast<std::uint64_t>(hash_type()(ky));
+
+        // Hashes such as std::hash<int> are the identity, so the bits are mixed before the
+        // reduction, otherwise consecutive keys would all land in the same few shards.
+        return static_cast<std::size_t>((hash_ky * 0x9E3779B97F4A7C15ull) >> 32) % SHARDS;
+    }
+
+private:
+    /** Size of a cache line, used to keep the shard locks from sharing lines. */
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /** The lock used by the lookups that don't modify the value. */
+    using read_lock_type = std::conditional_t<
+            SHARED_LOOKUPS, std::shared_lock<mutex_type>, std::lock_guard<mutex_type>>;
+
+    /**
+     * @brief       Struct that represents the computation of a missing value. It lives in the
+     *              stack of the thread that computes the value, which doesn't return until all
+     *              the threads waiting for the value have copied it.
+     */
+    struct flight
+    {
+        /**
+         * @brief       Constructor with parameters.
+         * @param       ky : The key whose value is computed.
+         */
+        explicit flight(const key_type& ky) noexcept
+                : ky_(ky)
+        {
+        }
+
+        /** The key whose value is computed. */
+        const key_type& ky_;
+
+        /** The next computation in the shard. */
+        flight* nxt_ = nullptr;
+
+        /** The computed value, set once the computation is done. */
+        const value_type* val_ = nullptr;
+
+        /** The exception thrown by the computation. */
+        std::exception_ptr excptn_;
+
+        /** The number of threads waiting for the value. */
+        std::atomic<std::size_t> n_wtrs_ = 0;
+
+        /** Whether the computation is done. */
+        std::atomic<bool> done_ = false;
+    };
+
+    /**
+     * @brief       Struct that represents an independently locked part of the cache.
+     */
+    struct alignas(CACHE_LINE_SIZE) shard
+    {
+        /** The mutex that protects the shard. */
+        mutex_type mtx_;
+
+        /** The shard cache. */
+        shard_cache_type cache_;
+
+        /** The computations in progress in the shard. */
+        flight* flghts_ = nullptr;
+    };
+
+    /**
+     * @brief       Find the key associated value and copy it, or compute it and insert it.
+     * @param       ky : The key.
+     * @param       ldr : The function that computes the value.
+     * @return      The key associated value.
+     */
+    template<bool LOCK_, typename LoaderT_>
+    value_type load(const key_type& ky, LoaderT_& ldr)
+    {
+        shard& shrd = get_shard(ky);
+
+        if constexpr (!LOCK_)
+        {
+            read_lock_type lck(shrd.mtx_);
+            auto it = shrd.cache_.find(ky);
+
+            if (!it.end())
+            {
+                return *it;
+            }
+        }
+
+        std::unique_lock<mutex_type> lck(shrd.mtx_);
+        auto it = LOCK_ ? shrd.cache_.find_and_lock(ky) : shrd.cache_.find(ky);
+
+        if (!it.end())
+        {
+            return *it;
+        }
+
+        for (flight* flght = shrd.flghts_; flght != nullptr; flght = flght->nxt_)
+        {
+            if (pred_type()(flght->ky_, ky))
+            {
+                return wait_for_flight<LOCK_>(shrd, *flght, lck);
+            }
+        }
+
+        flight flght(ky);
+
+        flght.nxt_ = shrd.flghts_;
+        shrd.flghts_ = &flght;
+
+        try
+        {
+            lck.unlock();
+            const value_type val = std::invoke(ldr, ky);
+            lck.lock();
+
+            // A plain insertion of the key may have happened while the loader was running, in
+            // which case the value already in the cache is kept.
+            it = LOCK_ ? shrd.cache_.find_and_lock(ky) : shrd.cache_.find(ky);
+
+            if (!it.end())
+            {
+                const value_type cur_val = *it;
+
+                land_flight(shrd, flght, lck, &cur_val);
+
+                return cur_val;
+            }
+
+            if constexpr (LOCK_)
+            {
+                shrd.cache_.insert_and_lock(ky, val);
+            }
+            else
+            {
+                shrd.cache_.insert(ky, val);
+            }
+
+            land_flight(shrd, flght, lck, &val);
+
+            return val;
+        }
+        catch (...)
+        {
+            if (!lck.owns_lock())
+            {
+                lck.lock();
+            }
+
+            flght.excptn_ = std::current_exception();
+            land_flight(shrd, flght, lck, nullptr);
+
+            throw;
+        }
+    }
+
+    /**
+     * @brief       Wait for a computation to be done and copy its value.
+     * @param       shrd : The shard of the key.
+     * @param       flght : The computation.
+     * @param       lck : The lock held on the shard, it is released while waiting.
+     * @return      The computed value.
+     */
+    template<bool LOCK_>
+    static value_type wait_for_flight(
+            shard& shrd,
+            flight& flght,
+            std::unique_lock<mutex_type>& lck
+    )
+    {
+        flght.n_wtrs_.fetch_add(1);
+        lck.unlock();
+        flght.done_.wait(false);
+
+        struct waiter_guard
+        {
+            ~waiter_guard()
+            {
+                if (flght_.n_wtrs_.fetch_sub(1) == 1)
+                {
+                    flght_.n_wtrs_.notify_all();
+                }
+            }
+
+            flight& flght_;
+        } grd{flght};
+
+        if (flght.excptn_)
+        {
+            std::rethrow_exception(flght.excptn_);
+        }
+
+        if constexpr (LOCK_)
+        {
+            lck.lock();
+            shrd.cache_.lock(flght.ky_);
+        }
+
+        return *flght.val_;
+    }
+
+    /**
+     * @brief       Publish the result of a computation, and wait until all the threads waiting
+     *              for it have copied it.
+     * @param       shrd : The shard of the key.
+     * @param       flght : The computation.
+     * @param       lck : The lock held on the shard, it is released before waiting.
+     * @param       val : The computed value, or nullptr if the computation failed.
+     */
+    static void land_flight(
+            shard& shrd,
+            flight& flght,
+            std::unique_lock<mutex_type>& lck,
+            const value_type* val
+    ) noexcept
+    {
+        flight** pflght = &shrd.flghts_;
+
+        while (*pflght != &flght)
+        {
+            pflght = &(*pflght)->nxt_;
+        }
+
+        *pflght = flght.nxt_;
+        flght.val_ = val;
+        flght.done_.store(true);
+        flght.done_.notify_all();
+        lck.unlock();
+
+        for (std::size_t n = flght.n_wtrs_.load(); n != 0; n = flght.n_wtrs_.load())
+        {
+            flght.n_wtrs_.wait(n);
+        }
+    }
+
+    /**
+     * @brief       Get the shard associated with a key.
+     * @param       ky : The key.
+     * @return      The shard associated with the key.
+     */
+    shard& get_shard(const key_type& ky) noexcept
+    {
+        return shrds_[get_shard_index(ky)];
+    }
+
+private:
+    /** The shards. */
+    shard shrds_[SHARDS];
+};
+
+}
+
+#endif
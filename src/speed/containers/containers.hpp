@@ -27,10 +27,38 @@
 #ifndef SPEED_CONTAINERS_CONTAINERS_HPP
 #define SPEED_CONTAINERS_CONTAINERS_HPP
 
+#include "arc_eviction_policy.hpp"
+#include "bloom_filter.hpp"
+#include "btree_map.hpp"
+#include "cache_base.hpp"
+#include "clock_eviction_policy.hpp"
+#include "concurrent_static_cache.hpp"
+#include "cuckoo_filter.hpp"
+#include "dynamic_cache.hpp"
+#include "eviction_policy.hpp"
 #include "exception.hpp"
+#include "expiring_static_cache.hpp"
+#include "filter_hash.hpp"
 #include "flags.hpp"
+#include "flat_hash.hpp"
+#include "flat_hash_map.hpp"
+#include "flat_hash_set.hpp"
+#include "flat_map.hpp"
+#include "flat_static_cache.hpp"
+#include "intrusive_hash_table.hpp"
+#include "intrusive_list.hpp"
 #include "iterator_base.hpp"
+#include "lru_eviction_policy.hpp"
+#include "mpmc_ring.hpp"
+#include "no_statistics_policy.hpp"
+#include "s3_fifo_eviction_policy.hpp"
+#include "sharded_statistics_policy.hpp"
+#include "small_vector.hpp"
+#include "spsc_ring.hpp"
 #include "static_cache.hpp"
+#include "statistics_policy.hpp"
+#include "w_tinylfu_eviction_policy.hpp"
+#include "weighted_static_cache.hpp"
 
 namespace speed {
 
@@ -0,0 +1,529 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       cuckoo_filter.hpp
+ * @brief      cuckoo_filter class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_CUCKOO_FILTER_HPP
+#define SPEED_CONTAINERS_CUCKOO_FILTER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "exception.hpp"
+#include "filter_hash.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a cuckoo filter. It stores a fingerprint of each key in one
+ *              of two buckets of four slots, the second bucket being computed from the first one
+ *              and the fingerprint, so the fingerprints can be relocated without the keys and a
+ *              key can be erased, unlike in a Bloom filter. A lookup reads two buckets, never
+ *              gives a false negative, and gives a false positive with a rate that depends on the
+ *              number of bits of the fingerprints. Erasing a key that wasn't inserted may erase
+ *              another key.
+ */
+template<
+        typename KeyT,
+        typename HashT = filter_hash<KeyT>,
+        typename FingerprintT = std::uint16_t,
+        typename AllocatorT = std::allocator<KeyT>
+>
+class cuckoo_filter
+{
+public:
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The hash type. */
+    using hasher = HashT;
+
+    /** The fingerprint type. */
+    using fingerprint_type = FingerprintT;
+
+    /** The allocator type. */
+    using allocator_type = AllocatorT;
+
+    static_assert(std::is_unsigned_v<fingerprint_type> && sizeof(fingerprint_type) <= 4,
+                  "The fingerprint type must be an unsigned integer of at most 32 bits.");
+
+    /** The number of slots of a bucket. */
+    static constexpr std::size_t BUCKET_SIZE = 4;
+
+    /** The number of bits of a fingerprint. */
+    static constexpr std::size_t FINGERPRINT_BITS = std::numeric_limits<fingerprint_type>::digits;
+
+    /** The load factor up to which the insertions are expected to succeed. */
+    static constexpr double MAX_LOAD_FACTOR = 0.95;
+
+    /** The maximum number of fingerprints relocated by an insertion. */
+    static constexpr std::size_t MAX_KICKS = 500;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       n_elems : The number of keys that will be inserted.
+     * @param       hsh : The hash function.
+     * @param       alloc : The allocator.
+     */
+    explicit cuckoo_filter(
+            std::size_t n_elems,
+            const hasher& hsh = hasher(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : bkts_(get_bucket_count(n_elems), bucket(), bucket_allocator_type(alloc))
+            , msk_(bkts_.size() - 1)
+            , hsh_(hsh)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       n_elems : The number of keys that will be inserted.
+     * @param       fpr : The target false positive rate.
+     * @param       hsh : The hash function.
+     * @param       alloc : The allocator.
+     * @throw       out_of_range_exception : If the fingerprints needed to reach the target have
+     *              more bits than the fingerprint type.
+     */
+    cuckoo_filter(
+            std::size_t n_elems,
+            double fpr,
+            const hasher& hsh = hasher(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : cuckoo_filter(n_elems, hsh, alloc)
+    {
+        if (get_fingerprint_bits(fpr) > FINGERPRINT_BITS)
+        {
+            throw out_of_range_exception();
+        }
+    }
+
+    /**
+     * @brief       Insert a key. Once an insertion fails the filter is full: the fingerprint that
+     *              was left without a slot is kept aside, so no key is lost, but every other
+     *              insertion fails until a key is erased.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename KeyT_ = key_type>
+    bool insert(const KeyT_& ky)
+    {
+        return insert_hash(hsh_(ky));
+    }
+
+    /**
+     * @brief       Insert a key from its hash.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool insert_hash(std::uint64_t hsh) noexcept
+    {
+        if (vctm_.usd_)
+        {
+            return false;
+        }
+
+        insert_fingerprint(hsh & msk_, get_fingerprint(hsh));
+
+        return true;
+    }
+
+    /**
+     * @brief       Allows knowing whether a key may have been inserted.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename KeyT_ = key_type>
+    [[nodiscard]] bool contains(const KeyT_& ky) const
+    {
+        return contains_hash(hsh_(ky));
+    }
+
+    /**
+     * @brief       Allows knowing whether a key may have been inserted from its hash.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool contains_hash(std::uint64_t hsh) const noexcept
+    {
+        const fingerprint_type fp = get_fingerprint(hsh);
+        const std::size_t idx1 = hsh & msk_;
+        const std::size_t idx2 = get_alternate_index(idx1, fp);
+
+        return bucket_contains(idx1, fp) || bucket_contains(idx2, fp) ||
+               (vctm_.usd_ && vctm_.fp_ == fp && (vctm_.idx_ == idx1 || vctm_.idx_ == idx2));
+    }
+
+    /**
+     * @brief       Erase a key. The key must have been inserted.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename KeyT_ = key_type>
+    bool erase(const KeyT_& ky)
+    {
+        return erase_hash(hsh_(ky));
+    }
+
+    /**
+     * @brief       Erase a key from its hash. The key must have been inserted.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool erase_hash(std::uint64_t hsh) noexcept
+    {
+        const fingerprint_type fp = get_fingerprint(hsh);
+        const std::size_t idx1 = hsh & msk_;
+        const std::size_t idx2 = get_alternate_index(idx1, fp);
+
+        if (vctm_.usd_ && vctm_.fp_ == fp && (vctm_.idx_ == idx1 || vctm_.idx_ == idx2))
+        {
+            vctm_.usd_ = false;
+            --sz_;
+
+            return true;
+        }
+
+        if (!remove_from_bucket(idx1, fp) && !remove_from_bucket(idx2, fp))
+        {
+            return false;
+        }
+
+        --sz_;
+
+        if (vctm_.usd_)
+        {
+            vctm_.usd_ = false;
+            --sz_;
+            insert_fingerprint(vctm_.idx_, vctm_.fp_);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief       Erase all the keys.
+     */
+    void clear() noexcept
+    {
+        std::fill(bkts_.begin(), bkts_.end(), bucket());
+        vctm_ = victim();
+        sz_ = 0;
+    }
+
+    /**
+     * @brief       Allows knowing whether the filter is empty.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return sz_ == 0;
+    }
+
+    /**
+     * @brief       Get the number of fingerprints stored.
+     * @return      The number of fingerprints stored.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return sz_;
+    }
+
+    /**
+     * @brief       Get the number of buckets.
+     * @return      The number of buckets.
+     */
+    [[nodiscard]] std::size_t get_bucket_count() const noexcept
+    {
+        return bkts_.size();
+    }
+
+    /**
+     * @brief       Get the number of bytes used by the buckets.
+     * @return      The number of bytes used by the buckets.
+     */
+    [[nodiscard]] std::size_t get_memory_size() const noexcept
+    {
+        return bkts_.size() * sizeof(bucket);
+    }
+
+    /**
+     * @brief       Get the fraction of the slots that hold a fingerprint.
+     * @return      The fraction of the slots that hold a fingerprint.
+     */
+    [[nodiscard]] double get_load_factor() const noexcept
+    {
+        return static_cast<double>(sz_) / static_cast<double>(bkts_.size() * BUCKET_SIZE);
+    }
+
+    /**
+     * @brief       Get the expected false positive rate with the current load factor.
+     * @return      The expected false positive rate.
+     */
+    [[nodiscard]] double estimate_false_positive_rate() const noexcept
+    {
+        return estimate_false_positive_rate(get_load_factor());
+    }
+
+    /**
+     * @brief       Get the expected false positive rate with a load factor. A lookup compares
+     *              its fingerprint with the 2 * 4 * load factor fingerprints of its two buckets,
+     *              each of which matches with probability 1 / (2^bits - 1).
+     * @param       load_fctr : The load factor.
+     * @return      The expected false positive rate.
+     */
+    [[nodiscard]] static double estimate_false_positive_rate(double load_fctr) noexcept
+    {
+        const double n_fps = std::ldexp(1.0, static_cast<int>(FINGERPRINT_BITS)) - 1.0;
+
+        return 1.0 - std::pow(1.0 - 1.0 / n_fps, 2.0 * BUCKET_SIZE * load_fctr);
+    }
+
+    /**
+     * @brief       Get the number of bits of the fingerprints needed to reach a false positive
+     *              rate when the filter is full.
+     * @param       fpr : The target false positive rate.
+     * @return      The number of bits of the fingerprints.
+     */
+    [[nodiscard]] static std::size_t get_fingerprint_bits(double fpr) noexcept
+    {
+        if (!(fpr > 0.0))
+        {
+            return std::numeric_limits<std::size_t>::max();
+        }
+
+        return static_cast<std::size_t>(
+                std::max(1.0, std::ceil(std::log2(2.0 * BUCKET_SIZE / fpr + 1.0))));
+    }
+
+    /**
+     * @brief       Get the number of buckets needed to hold a number of keys, a power of two so
+     *              the buckets are chosen by masking the hash.
+     * @param       n_elems : The number of keys.
+     * @return      The number of buckets.
+     */
+    [[nodiscard]] static std::size_t get_bucket_count(std::size_t n_elems) noexcept
+    {
+        const auto n_bkts = static_cast<std::size_t>(std::ceil(
+                static_cast<double>(n_elems) / (BUCKET_SIZE * MAX_LOAD_FACTOR)));
+
+        return std::bit_ceil(std::max<std::size_t>(n_bkts, 1));
+    }
+
+    /**
+     * @brief       Get the hash function.
+     * @return      The hash function.
+     */
+    [[nodiscard]] hasher hash_function() const
+    {
+        return hsh_;
+    }
+
+private:
+    /**
+     * @brief       Struct that represents a bucket. A slot holding zero is empty.
+     */
+    struct alignas(BUCKET_SIZE * sizeof(fingerprint_type)) bucket
+    {
+        /** The fingerprints. */
+        fingerprint_type fps_[BUCKET_SIZE] = {};
+    };
+
+    /**
+     * @brief       Struct that represents the fingerprint left without a slot by a failed
+     *              insertion.
+     */
+    struct victim
+    {
+        /** The fingerprint. */
+        fingerprint_type fp_ = 0;
+
+        /** The index of one of its buckets. */
+        std::size_t idx_ = 0;
+
+        /** Whether the victim holds a fingerprint. */
+        bool usd_ = false;
+    };
+
+    /** The bucket allocator type. */
+    using bucket_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<bucket>;
+
+    /**
+     * @brief       Get the fingerprint of a hash, taken from its high bits, which are independent
+     *              of the low ones that choose the bucket. Zero is mapped to one as it marks the
+     *              empty slots.
+     * @param       hsh : The hash.
+     * @return      The fingerprint.
+     */
+    [[nodiscard]] static fingerprint_type get_fingerprint(std::uint64_t hsh) noexcept
+    {
+        const auto fp = static_cast<fingerprint_type>(hsh >> (64 - FINGERPRINT_BITS));
+
+        return fp == 0 ? 1 : fp;
+    }
+
+    /**
+     * @brief       Get the other bucket of a fingerprint. The bucket index is xored with a hash
+     *              of the fingerprint, so the function is its own inverse.
+     * @param       idx : The index of one of the buckets.
+     * @param       fp : The fingerprint.
+     * @return      The index of the other bucket.
+     */
+    [[nodiscard]] std::size_t get_alternate_index(std::size_t idx, fingerprint_type fp) const
+            noexcept
+    {
+        return (idx ^ static_cast<std::size_t>((fp * 0xC6A4A7935BD1E995ull) >> 32)) & msk_;
+    }
+
+    /**
+     * @brief       Store a fingerprint in a free slot of a bucket.
+     * @param       idx : The index of the bucket.
+     * @param       fp : The fingerprint.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool add_to_bucket(std::size_t idx, fingerprint_type fp) noexcept
+    {
+        for (auto& slt : bkts_[idx].fps_)
+        {
+            if (slt == 0)
+            {
+                slt = fp;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief       Allows knowing whether a bucket holds a fingerprint.
+     * @param       idx : The index of the bucket.
+     * @param       fp : The fingerprint.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool bucket_contains(std::size_t idx, fingerprint_type fp) const noexcept
+    {
+        const bucket& bkt = bkts_[idx];
+        bool fnd = false;
+
+        for (auto slt : bkt.fps_)
+        {
+            fnd |= slt == fp;
+        }
+
+        return fnd;
+    }
+
+    /**
+     * @brief       Remove a fingerprint from a bucket.
+     * @param       idx : The index of the bucket.
+     * @param       fp : The fingerprint.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool remove_from_bucket(std::size_t idx, fingerprint_type fp) noexcept
+    {
+        for (auto& slt : bkts_[idx].fps_)
+        {
+            if (slt == fp)
+            {
+                slt = 0;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief       Insert a fingerprint knowing one of its buckets. When both buckets are full
+     *              a fingerprint of the bucket is evicted to its other bucket, and so on, until
+     *              a free slot is found or MAX_KICKS is reached, in which case the last evicted
+     *              fingerprint is kept aside.
+     * @param       idx : The index of one of the buckets.
+     * @param       fp : The fingerprint.
+     */
+    void insert_fingerprint(std::size_t idx, fingerprint_type fp) noexcept
+    {
+        for (std::size_t i = 0; i < MAX_KICKS; ++i)
+        {
+            if (add_to_bucket(idx, fp) || add_to_bucket(get_alternate_index(idx, fp), fp))
+            {
+                ++sz_;
+                return;
+            }
+
+            std::swap(fp, bkts_[idx].fps_[next_random() % BUCKET_SIZE]);
+            idx = get_alternate_index(idx, fp);
+        }
+
+        vctm_ = {fp, idx, true};
+        ++sz_;
+    }
+
+    /**
+     * @brief       Get the next number of the generator that picks the slots to relocate.
+     * @return      The next number.
+     */
+    std::uint64_t next_random() noexcept
+    {
+        rnd_ ^= rnd_ << 13;
+        rnd_ ^= rnd_ >> 7;
+        rnd_ ^= rnd_ << 17;
+
+        return rnd_;
+    }
+
+private:
+    /** The buckets. */
+    std::vector<bucket, bucket_allocator_type> bkts_;
+
+    /** The mask that gives a bucket index. */
+    std::size_t msk_;
+
+    /** The number of fingerprints stored. */
+    std::size_t sz_ = 0;
+
+    /** The fingerprint left without a slot by a failed insertion. */
+    victim vctm_;
+
+    /** The state of the generator that picks the slots to relocate. */
+    std::uint64_t rnd_ = 0x9E3779B97F4A7C15ull;
+
+    /** The hash function. */
+    [[no_unique_address]] hasher hsh_;
+};
+
+}
+
+#endif
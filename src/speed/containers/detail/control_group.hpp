@@ -0,0 +1,256 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       control_group.hpp
+ * @brief      control_group class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_DETAIL_CONTROL_GROUP_HPP
+#define SPEED_CONTAINERS_DETAIL_CONTROL_GROUP_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SPEED_CONTAINERS_SSE2 1
+#endif
+
+namespace speed::containers::detail {
+
+/** The control byte of a slot that has never held an element. */
+inline constexpr std::int8_t CONTROL_EMPTY = -128;
+
+/** The control byte of a slot whose element has been erased. */
+inline constexpr std::int8_t CONTROL_DELETED = -2;
+
+/**
+ * @brief       Class that represents a set of slots of a control group, one bit or byte per slot.
+ */
+template<typename MaskT, std::size_t SHIFT>
+class control_mask
+{
+public:
+    /**
+     * @brief       Constructor with parameters.
+     * @param       msk : The mask.
+     */
+    explicit control_mask(MaskT msk) noexcept
+            : msk_(msk)
+    {
+    }
+
+    /**
+     * @brief       Allows knowing whether the mask holds any slot.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    explicit operator bool() const noexcept
+    {
+        return msk_ != 0;
+    }
+
+    /**
+     * @brief       Get the offset of the lowest slot of the mask.
+     * @return      The offset of the lowest slot of the mask.
+     */
+    [[nodiscard]] std::size_t get_lowest() const noexcept
+    {
+        return static_cast<std::size_t>(std::countr_zero(msk_)) >> SHIFT;
+    }
+
+    /**
+     * @brief       Remove the lowest slot from the mask.
+     */
+    void remove_lowest() noexcept
+    {
+        msk_ &= msk_ - 1;
+    }
+
+private:
+    /** The mask. */
+    MaskT msk_;
+};
+
+#ifdef SPEED_CONTAINERS_SSE2
+
+/**
+ * @brief       Class that represents the control bytes of a group of slots, compared all at once
+ *              with SSE2 instructions. A control byte holds the seven low bits of the hash of the
+ *              element of its slot, or a negative value if the slot holds no element.
+ */
+class control_group
+{
+public:
+    /** The number of slots of a group. */
+    static constexpr std::size_t WIDTH = 16;
+
+    /** The mask type. */
+    using mask_type = control_mask<std::uint32_t, 0>;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       ctrl : The control bytes of the group, they don't need to be aligned.
+     */
+    explicit control_group(const std::int8_t* ctrl) noexcept
+            : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+    {
+    }
+
+    /**
+     * @brief       Get the slots whose control byte matches the low bits of a hash.
+     * @param       h2 : The seven low bits of the hash.
+     * @return      The slots whose control byte matches.
+     */
+    [[nodiscard]] mask_type match(std::int8_t h2) const noexcept
+    {
+        return mask_type(static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+    }
+
+    /**
+     * @brief       Get the empty slots.
+     * @return      The empty slots.
+     */
+    [[nodiscard]] mask_type match_empty() const noexcept
+    {
+        return match(CONTROL_EMPTY);
+    }
+
+    /**
+     * @brief       Get the slots that hold no element, either empty or deleted.
+     * @return      The slots that hold no element.
+     */
+    [[nodiscard]] mask_type match_free() const noexcept
+    {
+        return mask_type(static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_)));
+    }
+
+    /**
+     * @brief       Get the slots that hold an element.
+     * @return      The slots that hold an element.
+     */
+    [[nodiscard]] mask_type match_full() const noexcept
+    {
+        return mask_type(static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_)) ^ 0xFFFF);
+    }
+
+private:
+    /** The control bytes. */
+    __m128i ctrl_;
+};
+
+#else
+
+/**
+ * @brief       Class that represents the control bytes of a group of slots, compared all at once
+ *              as the bytes of a word. A control byte holds the seven low bits of the hash of the
+ *              element of its slot, or a negative value if the slot holds no element.
+ */
+class control_group
+{
+public:
+    /** The number of slots of a group. */
+    static constexpr std::size_t WIDTH = 8;
+
+    /** The mask type. */
+    using mask_type = control_mask<std::uint64_t, 3>;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       ctrl : The control bytes of the group, they don't need to be aligned.
+     */
+    explicit control_group(const std::int8_t* ctrl) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::memcpy(&ctrl_, ctrl, sizeof(ctrl_));
+        }
+        else
+        {
+            ctrl_ = 0;
+
+            for (std::size_t i = 0; i < WIDTH; ++i)
+            {
+                ctrl_ |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(ctrl[i])) << (i * 8);
+            }
+        }
+    }
+
+    /**
+     * @brief       Get the slots whose control byte matches the low bits of a hash. A slot that
+     *              follows a match can be reported wrongly, so the keys have to be compared.
+     * @param       h2 : The seven low bits of the hash.
+     * @return      The slots whose control byte matches.
+     */
+    [[nodiscard]] mask_type match(std::int8_t h2) const noexcept
+    {
+        const std::uint64_t wrd = ctrl_ ^ (LSBS * static_cast<std::uint8_t>(h2));
+
+        return mask_type((wrd - LSBS) & ~wrd & MSBS);
+    }
+
+    /**
+     * @brief       Get the empty slots. Only the empty control byte has its high bit set and its
+     *              second bit clear.
+     * @return      The empty slots.
+     */
+    [[nodiscard]] mask_type match_empty() const noexcept
+    {
+        return mask_type(ctrl_ & ~(ctrl_ << 6) & MSBS);
+    }
+
+    /**
+     * @brief       Get the slots that hold no element, either empty or deleted.
+     * @return      The slots that hold no element.
+     */
+    [[nodiscard]] mask_type match_free() const noexcept
+    {
+        return mask_type(ctrl_ & MSBS);
+    }
+
+    /**
+     * @brief       Get the slots that hold an element.
+     * @return      The slots that hold an element.
+     */
+    [[nodiscard]] mask_type match_full() const noexcept
+    {
+        return mask_type(~ctrl_ & MSBS);
+    }
+
+private:
+    /** A word with the lowest bit of every byte set. */
+    static constexpr std::uint64_t LSBS = 0x0101010101010101ull;
+
+    /** A word with the highest bit of every byte set. */
+    static constexpr std::uint64_t MSBS = 0x8080808080808080ull;
+
+    /** The control bytes. */
+    std::uint64_t ctrl_;
+};
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,189 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       eviction_list.hpp
+ * @brief      eviction_list class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_DETAIL_EVICTION_LIST_HPP
+#define SPEED_CONTAINERS_DETAIL_EVICTION_LIST_HPP
+
+#include <cstddef>
+
+namespace speed::containers::detail {
+
+/**
+ * @brief       Class that represents a circular doubly linked list of cache nodes used by the
+ *              eviction policies. The links are the av_nxt_ and av_prev_ members of the node
+ *              policy hook, so a node can only be in one list at a time. The first node is the
+ *              oldest one.
+ */
+template<typename NodeT>
+class eviction_list
+{
+public:
+    /** The node type. */
+    using node_type = NodeT;
+
+    /**
+     * @brief       Insert a node in the end of the list.
+     * @param       nd : The node to insert.
+     */
+    void push_back(node_type* nd) noexcept
+    {
+        if (head_ == nullptr)
+        {
+            head_ = nd;
+            nd->plcy_hk_.av_nxt_ = nd;
+            nd->plcy_hk_.av_prev_ = nd;
+        }
+        else
+        {
+            nd->plcy_hk_.av_prev_ = head_->plcy_hk_.av_prev_;
+            nd->plcy_hk_.av_nxt_ = head_;
+            head_->plcy_hk_.av_prev_->plcy_hk_.av_nxt_ = nd;
+            head_->plcy_hk_.av_prev_ = nd;
+        }
+
+        ++sz_;
+    }
+
+    /**
+     * @brief       Insert a node in the beginning of the list.
+     * @param       nd : The node to insert.
+     */
+    void push_front(node_type* nd) noexcept
+    {
+        push_back(nd);
+        head_ = nd;
+    }
+
+    /**
+     * @brief       Erase the specified node from the list.
+     * @param       nd : The node to erase.
+     */
+    void erase(node_type* nd) noexcept
+    {
+        if (nd->plcy_hk_.av_nxt_ == nd)
+        {
+            head_ = nullptr;
+        }
+        else
+        {
+            if (nd == head_)
+            {
+                head_ = head_->plcy_hk_.av_nxt_;
+            }
+
+            nd->plcy_hk_.av_prev_->plcy_hk_.av_nxt_ = nd->plcy_hk_.av_nxt_;
+            nd->plcy_hk_.av_nxt_->plcy_hk_.av_prev_ = nd->plcy_hk_.av_prev_;
+        }
+
+        --sz_;
+    }
+
+    /**
+     * @brief       Move a node of the list to its end.
+     * @param       nd : The node to move.
+     */
+    void move_to_back(node_type* nd) noexcept
+    {
+        if (nd == head_)
+        {
+            head_ = head_->plcy_hk_.av_nxt_;
+        }
+        else
+        {
+            erase(nd);
+            push_back(nd);
+        }
+    }
+
+    /**
+     * @brief       Call a function on every node of the list, from the first to the last.
+     * @param       fnc : The function to call.
+     */
+    template<typename FunctionT_>
+    void for_each(FunctionT_&& fnc) const
+    {
+        node_type* cur = head_;
+
+        if (cur == nullptr)
+        {
+            return;
+        }
+
+        do
+        {
+            fnc(cur);
+            cur = cur->plcy_hk_.av_nxt_;
+
+        } while (cur != head_);
+    }
+
+    /**
+     * @brief       Get the first node of the list.
+     * @return      The first node of the list, or nullptr if the list is empty.
+     */
+    [[nodiscard]] node_type* front() const noexcept
+    {
+        return head_;
+    }
+
+    /**
+     * @brief       Get the number of nodes in the list.
+     * @return      The number of nodes in the list.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return sz_;
+    }
+
+    /**
+     * @brief       Allows knowing whether the list is empty.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return head_ == nullptr;
+    }
+
+    /**
+     * @brief       Forget all the nodes of the list.
+     */
+    void clear() noexcept
+    {
+        head_ = nullptr;
+        sz_ = 0;
+    }
+
+private:
+    /** The first node of the list. */
+    node_type* head_ = nullptr;
+
+    /** The number of nodes in the list. */
+    std::size_t sz_ = 0;
+};
+
+}
+
+#endif
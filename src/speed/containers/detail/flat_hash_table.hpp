@@ -0,0 +1,1255 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       flat_hash_table.hpp
+ * @brief      flat_hash_table class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_DETAIL_FLAT_HASH_TABLE_HPP
+#define SPEED_CONTAINERS_DETAIL_FLAT_HASH_TABLE_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../iterator_base.hpp"
+#include "control_group.hpp"
+
+namespace speed::containers::detail {
+
+/**
+ * @brief       Concept that is satisfied when a hash and a predicate accept keys of any type
+ *              comparable with the stored ones.
+ */
+template<typename HashT, typename PredT>
+concept transparent_hash = requires
+{
+    typename HashT::is_transparent;
+    typename PredT::is_transparent;
+};
+
+/**
+ * @brief       Class that represents an open addressing hash table in the manner of the swiss
+ *              tables. Every slot has a control byte that holds the seven low bits of the hash of
+ *              its element, or tells that the slot is empty or deleted. A lookup compares the
+ *              control bytes of a whole group of slots at once and only compares the keys whose
+ *              control byte matches, then moves to the next group with a triangular probing. The
+ *              elements live in a single array of slots, so inserting an element doesn't allocate
+ *              unless the table grows. The policy tells how to get the key of an element and how
+ *              to move an element into another slot.
+ */
+template<typename PolicyT, typename HashT, typename PredT, typename AllocatorT>
+class flat_hash_table
+{
+public:
+    /** The key type. */
+    using key_type = typename PolicyT::key_type;
+
+    /** The value type. */
+    using value_type = typename PolicyT::value_type;
+
+    /** The hash type. */
+    using hash_type = HashT;
+
+    /** The predicate type. */
+    using pred_type = PredT;
+
+    /** The allocator type. */
+    using allocator_type = AllocatorT;
+
+    /** The size type. */
+    using size_type = std::size_t;
+
+    /** The control group type. */
+    using group_type = control_group;
+
+    /** The number of slots compared at once. */
+    static constexpr std::size_t GROUP_WIDTH = group_type::WIDTH;
+
+    /**
+     * @brief       Class that represents const iterators.
+     */
+    class const_iterator : public const_iterator_base<value_type, const_iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_iterator_base<value_type, const_iterator>;
+
+        /** The node iteration type. */
+        using node_type = std::size_t;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        const_iterator() noexcept = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       tbl : The table in which iterate.
+         * @param       cur_slot : The current slot index.
+         */
+        const_iterator(flat_hash_table* tbl, std::size_t cur_slot) noexcept
+                : tbl_(tbl)
+                , cur_slot_(cur_slot)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node. The control bytes are scanned a group at a time.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            const std::size_t cap = tbl_->cap_;
+
+            if (cur_slot_ < cap)
+            {
+                ++cur_slot_;
+
+                while (cur_slot_ < cap)
+                {
+                    auto msk = group_type(tbl_->ctrl_ + cur_slot_).match_full();
+
+                    if (msk)
+                    {
+                        cur_slot_ += msk.get_lowest();
+                        break;
+                    }
+
+                    cur_slot_ += GROUP_WIDTH;
+                }
+
+                if (cur_slot_ > cap)
+                {
+                    cur_slot_ = cap;
+                }
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            if (cur_slot_ < tbl_->cap_)
+            {
+                do
+                {
+                    if (cur_slot_ == 0)
+                    {
+                        cur_slot_ = tbl_->cap_;
+                        break;
+                    }
+
+                    --cur_slot_;
+
+                } while (tbl_->ctrl_[cur_slot_] < 0);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return cur_slot_ == rhs.cur_slot_;
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return tbl_ == nullptr || cur_slot_ >= tbl_->cap_;
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        const value_type& operator *() const noexcept
+        {
+            return tbl_->slts_[cur_slot_];
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        const value_type* operator ->() const noexcept
+        {
+            return &tbl_->slts_[cur_slot_];
+        }
+
+        friend class flat_hash_table;
+
+    protected:
+        /** The table in which iterate. */
+        flat_hash_table* tbl_ = nullptr;
+
+        /** The current slot index. */
+        std::size_t cur_slot_ = 0;
+    };
+
+    /**
+     * @brief       Class that represents mutable iterators.
+     */
+    class mutable_iterator
+            : public const_mutable_iterator_base<value_type, const_iterator, mutable_iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = mutable_iterator;
+
+        /** The const iterator base. */
+        using const_self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_mutable_iterator_base<
+                value_type, const_iterator, mutable_iterator>;
+
+        /** The node iteration type. */
+        using node_type = std::size_t;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        mutable_iterator() = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       tbl : The table in which iterate.
+         * @param       cur_slot : The current slot index.
+         */
+        mutable_iterator(flat_hash_table* tbl, std::size_t cur_slot) noexcept
+                : base_type(tbl, cur_slot)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            const_self_type::operator ++();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            const_self_type::operator --();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return const_self_type::operator ==(rhs);
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return const_self_type::end();
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        value_type& operator *() const noexcept
+        {
+            return const_self_type::tbl_->slts_[const_self_type::cur_slot_];
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        value_type* operator ->() const noexcept
+        {
+            return &operator *();
+        }
+
+        friend class flat_hash_table;
+    };
+
+    /** The iterator type, it only gives mutable access when the policy allows it. */
+    using iterator = std::conditional_t<PolicyT::MUTABLE, mutable_iterator, const_iterator>;
+
+    /**
+     * @brief       Default constructor.
+     */
+    flat_hash_table() noexcept(std::is_nothrow_default_constructible_v<hash_type> &&
+                               std::is_nothrow_default_constructible_v<pred_type> &&
+                               std::is_nothrow_default_constructible_v<allocator_type>)
+            = default;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       n_elems : The number of elements to reserve room for.
+     * @param       hshr : The hash.
+     * @param       eq : The predicate.
+     * @param       alloc : The allocator.
+     */
+    explicit flat_hash_table(
+            size_type n_elems,
+            const hash_type& hshr = hash_type(),
+            const pred_type& eq = pred_type(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : hshr_(hshr)
+            , eq_(eq)
+            , alloc_(alloc)
+    {
+        reserve(n_elems);
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       alloc : The allocator.
+     */
+    explicit flat_hash_table(const allocator_type& alloc)
+            : alloc_(alloc)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       il : The elements to insert.
+     * @param       n_elems : The number of elements to reserve room for.
+     * @param       hshr : The hash.
+     * @param       eq : The predicate.
+     * @param       alloc : The allocator.
+     */
+    flat_hash_table(
+            std::initializer_list<value_type> il,
+            size_type n_elems = 0,
+            const hash_type& hshr = hash_type(),
+            const pred_type& eq = pred_type(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : flat_hash_table(n_elems > il.size() ? n_elems : il.size(), hshr, eq, alloc)
+    {
+        insert(il.begin(), il.end());
+    }
+
+    /**
+     * @brief       Copy constructor.
+     * @param       rhs : The object to copy.
+     */
+    flat_hash_table(const flat_hash_table& rhs)
+            : hshr_(rhs.hshr_)
+            , eq_(rhs.eq_)
+            , alloc_(slot_allocator_traits::select_on_container_copy_construction(rhs.alloc_))
+    {
+        reserve(rhs.sz_);
+
+        for (std::size_t i = 0; i < rhs.cap_; ++i)
+        {
+            if (rhs.ctrl_[i] >= 0)
+            {
+                const std::uint64_t mixd_hsh = get_mixed_hash(PolicyT::get_key(rhs.slts_[i]));
+                const std::size_t free_slot = find_free_slot(mixd_hsh);
+
+                slot_allocator_traits::construct(alloc_, slts_ + free_slot, rhs.slts_[i]);
+                commit_insert({free_slot, mixd_hsh, true});
+            }
+        }
+    }
+
+    /**
+     * @brief       Move constructor.
+     * @param       rhs : The object to move.
+     */
+    flat_hash_table(flat_hash_table&& rhs) noexcept
+            : hshr_(std::move(rhs.hshr_))
+            , eq_(std::move(rhs.eq_))
+            , alloc_(std::move(rhs.alloc_))
+            , ctrl_(std::exchange(rhs.ctrl_, nullptr))
+            , slts_(std::exchange(rhs.slts_, nullptr))
+            , cap_(std::exchange(rhs.cap_, 0))
+            , sz_(std::exchange(rhs.sz_, 0))
+            , grwth_lft_(std::exchange(rhs.grwth_lft_, 0))
+    {
+    }
+
+    /**
+     * @brief       Destructor.
+     */
+    ~flat_hash_table()
+    {
+        destroy_slots();
+    }
+
+    /**
+     * @brief       Copy assignment operator.
+     * @param       rhs : The object to copy.
+     * @return      The object who call the method.
+     */
+    flat_hash_table& operator =(const flat_hash_table& rhs)
+    {
+        if (this != &rhs)
+        {
+            flat_hash_table(rhs).swap(*this);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief       Move assignment operator.
+     * @param       rhs : The object to move.
+     * @return      The object who call the method.
+     */
+    flat_hash_table& operator =(flat_hash_table&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            flat_hash_table(std::move(rhs)).swap(*this);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief       Get the first element iterator of the container.
+     * @return      The first element iterator of the container.
+     */
+    iterator begin() noexcept
+    {
+        iterator it(this, 0);
+
+        if (cap_ > 0 && ctrl_[0] < 0)
+        {
+            ++it;
+        }
+
+        return it;
+    }
+
+    /**
+     * @brief       Get the first element iterator of the container.
+     * @return      The first element iterator of the container.
+     */
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    /**
+     * @brief       Get the first element iterator of the container.
+     * @return      The first element iterator of the container.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return const_cast<flat_hash_table*>(this)->begin();
+    }
+
+    /**
+     * @brief       Get the past-the-end iterator of the container.
+     * @return      The past-the-end iterator of the container.
+     */
+    iterator end() noexcept
+    {
+        return iterator(this, cap_);
+    }
+
+    /**
+     * @brief       Get the past-the-end iterator of the container.
+     * @return      The past-the-end iterator of the container.
+     */
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    /**
+     * @brief       Get the past-the-end iterator of the container.
+     * @return      The past-the-end iterator of the container.
+     */
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(const_cast<flat_hash_table*>(this), cap_);
+    }
+
+    /**
+     * @brief       Allows knowing whether the container holds no element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return sz_ == 0;
+    }
+
+    /**
+     * @brief       Get the number of elements.
+     * @return      The number of elements.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return sz_;
+    }
+
+    /**
+     * @brief       Get the number of slots.
+     * @return      The number of slots.
+     */
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return cap_;
+    }
+
+    /**
+     * @brief       Get the ratio between the number of elements and the number of slots.
+     * @return      The ratio between the number of elements and the number of slots.
+     */
+    [[nodiscard]] float load_factor() const noexcept
+    {
+        return cap_ == 0 ? 0.0f : static_cast<float>(sz_) / static_cast<float>(cap_);
+    }
+
+    /**
+     * @brief       Destroy all the elements. The slots are kept.
+     */
+    void clear() noexcept
+    {
+        for (std::size_t i = 0; i < cap_; ++i)
+        {
+            if (ctrl_[i] >= 0)
+            {
+                slot_allocator_traits::destroy(alloc_, slts_ + i);
+            }
+        }
+
+        if (cap_ > 0)
+        {
+            std::memset(ctrl_, CONTROL_EMPTY, cap_ + GROUP_WIDTH - 1);
+        }
+
+        sz_ = 0;
+        grwth_lft_ = get_growth(cap_);
+    }
+
+    /**
+     * @brief       Make room for a number of elements, so inserting them doesn't grow the table.
+     * @param       n_elems : The number of elements.
+     */
+    void reserve(size_type n_elems)
+    {
+        if (n_elems > sz_ + grwth_lft_)
+        {
+            std::size_t new_cap = GROUP_WIDTH;
+
+            while (get_growth(new_cap) < n_elems)
+            {
+                new_cap <<= 1;
+            }
+
+            resize(new_cap);
+        }
+    }
+
+    /**
+     * @brief       Find an element.
+     * @param       ky : The key of the element.
+     * @return      An iterator to the element if it is found, otherwise the past-the-end iterator.
+     */
+    iterator find(const key_type& ky)
+    {
+        return iterator(this, find_slot(ky, get_mixed_hash(ky)));
+    }
+
+    /**
+     * @brief       Find an element.
+     * @param       ky : The key of the element.
+     * @return      An iterator to the element if it is found, otherwise the past-the-end iterator.
+     */
+    const_iterator find(const key_type& ky) const
+    {
+        return const_cast<flat_hash_table*>(this)->find(ky);
+    }
+
+    /**
+     * @brief       Find an element with a key of another type.
+     * @param       ky : A key comparable with the key of the element.
+     * @return      An iterator to the element if it is found, otherwise the past-the-end iterator.
+     */
+    template<typename KeyT_>
+    requires transparent_hash<HashT, PredT>
+    iterator find(const KeyT_& ky)
+    {
+        return iterator(this, find_slot(ky, get_mixed_hash(ky)));
+    }
+
+    /**
+     * @brief       Find an element with a key of another type.
+     * @param       ky : A key comparable with the key of the element.
+     * @return      An iterator to the element if it is found, otherwise the past-the-end iterator.
+     */
+    template<typename KeyT_>
+    requires transparent_hash<HashT, PredT>
+    const_iterator find(const KeyT_& ky) const
+    {
+        return const_cast<flat_hash_table*>(this)->find(ky);
+    }
+
+    /**
+     * @brief       Allows knowing whether an element is in the container.
+     * @param       ky : The key of the element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool contains(const key_type& ky) const
+    {
+        return find_slot(ky, get_mixed_hash(ky)) != cap_;
+    }
+
+    /**
+     * @brief       Allows knowing whether an element is in the container.
+     * @param       ky : A key comparable with the key of the element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename KeyT_>
+    requires transparent_hash<HashT, PredT>
+    [[nodiscard]] bool contains(const KeyT_& ky) const
+    {
+        return find_slot(ky, get_mixed_hash(ky)) != cap_;
+    }
+
+    /**
+     * @brief       Get the number of elements with a key.
+     * @param       ky : The key of the elements.
+     * @return      The number of elements with the key, either zero or one.
+     */
+    [[nodiscard]] size_type count(const key_type& ky) const
+    {
+        return contains(ky) ? 1 : 0;
+    }
+
+    /**
+     * @brief       Insert an element if its key isn't in the container.
+     * @param       val : The element to insert.
+     * @return      An iterator to the element with the key and whether the insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& val)
+    {
+        return emplace_key(PolicyT::get_key(val), val);
+    }
+
+    /**
+     * @brief       Insert an element if its key isn't in the container.
+     * @param       val : The element to insert.
+     * @return      An iterator to the element with the key and whether the insertion took place.
+     */
+    std::pair<iterator, bool> insert(value_type&& val)
+    {
+        const insert_location loc = prepare_insert(PolicyT::get_key(val));
+
+        if (loc.insrtd_)
+        {
+            PolicyT::transfer(alloc_, slts_ + loc.slt_, &val);
+            commit_insert(loc);
+        }
+
+        return {iterator(this, loc.slt_), loc.insrtd_};
+    }
+
+    /**
+     * @brief       Insert a range of elements. The elements whose key is already in the container
+     *              are skipped.
+     * @param       first : The first element of the range.
+     * @param       last : The past-the-end element of the range.
+     */
+    template<typename InputIteratorT_>
+    void insert(InputIteratorT_ first, InputIteratorT_ last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief       Construct an element if its key isn't in the container. The element is built
+     *              before looking up its key, so it is moved once in its slot if it is inserted.
+     * @param       args : The arguments to construct the element.
+     * @return      An iterator to the element with the key and whether the insertion took place.
+     */
+    template<typename... Ts_>
+    std::pair<iterator, bool> emplace(Ts_&&... args)
+    {
+        value_type val(std::forward<Ts_>(args)...);
+
+        return insert(std::move(val));
+    }
+
+    /**
+     * @brief       Erase an element. No slot is moved, so the other iterators stay valid.
+     * @param       it : An iterator to the element.
+     * @return      An iterator to the element that follows the erased one.
+     */
+    iterator erase(const_iterator it) noexcept
+    {
+        iterator nxt_it(this, it.cur_slot_);
+
+        erase_slot(it.cur_slot_);
+
+        return ++nxt_it;
+    }
+
+    /**
+     * @brief       Erase the element with a key.
+     * @param       ky : The key of the element.
+     * @return      The number of erased elements, either zero or one.
+     */
+    size_type erase(const key_type& ky)
+    {
+        const std::size_t cur_slot = find_slot(ky, get_mixed_hash(ky));
+
+        if (cur_slot == cap_)
+        {
+            return 0;
+        }
+
+        erase_slot(cur_slot);
+
+        return 1;
+    }
+
+    /**
+     * @brief       Erase the element with a key of another type.
+     * @param       ky : A key comparable with the key of the element.
+     * @return      The number of erased elements, either zero or one.
+     */
+    template<typename KeyT_>
+    requires (transparent_hash<HashT, PredT> &&
+              !std::is_convertible_v<const KeyT_&, const_iterator>)
+    size_type erase(const KeyT_& ky)
+    {
+        const std::size_t cur_slot = find_slot(ky, get_mixed_hash(ky));
+
+        if (cur_slot == cap_)
+        {
+            return 0;
+        }
+
+        erase_slot(cur_slot);
+
+        return 1;
+    }
+
+    /**
+     * @brief       Exchange the content with another container.
+     * @param       rhs : The other container.
+     */
+    void swap(flat_hash_table& rhs) noexcept
+    {
+        std::swap(hshr_, rhs.hshr_);
+        std::swap(eq_, rhs.eq_);
+        std::swap(alloc_, rhs.alloc_);
+        std::swap(ctrl_, rhs.ctrl_);
+        std::swap(slts_, rhs.slts_);
+        std::swap(cap_, rhs.cap_);
+        std::swap(sz_, rhs.sz_);
+        std::swap(grwth_lft_, rhs.grwth_lft_);
+    }
+
+    /**
+     * @brief       Get the hash.
+     * @return      The hash.
+     */
+    [[nodiscard]] hash_type hash_function() const
+    {
+        return hshr_;
+    }
+
+    /**
+     * @brief       Get the predicate.
+     * @return      The predicate.
+     */
+    [[nodiscard]] pred_type key_eq() const
+    {
+        return eq_;
+    }
+
+    /**
+     * @brief       Get the allocator.
+     * @return      The allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return allocator_type(alloc_);
+    }
+
+protected:
+    /** The allocator of the slots. */
+    using slot_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<value_type>;
+
+    /** The slot allocator traits. */
+    using slot_allocator_traits = std::allocator_traits<slot_allocator_type>;
+
+    /** The allocator of the control bytes. */
+    using control_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<std::int8_t>;
+
+    /** The control allocator traits. */
+    using control_allocator_traits = std::allocator_traits<control_allocator_type>;
+
+    /** Whether the elements are copied into a new array of slots, since moving them may throw. */
+    static constexpr bool COPY_ON_RESIZE =
+            !PolicyT::NOTHROW_TRANSFER && std::is_copy_constructible_v<value_type>;
+
+    /**
+     * @brief       Struct that represents the slot of a key looked up for an insertion.
+     */
+    struct insert_location
+    {
+        /** The slot that holds the key, or in which to insert it. */
+        std::size_t slt_;
+
+        /** The mixed hash of the key. */
+        std::uint64_t mixd_hsh_;
+
+        /** Whether the key was missing. */
+        bool insrtd_;
+    };
+
+    /**
+     * @brief       Get the mixed hash of a key. The user hash is multiplied by the 64-bit golden
+     *              ratio and its high half is folded in the low one, so the seven low bits kept in
+     *              the control bytes and the bits that choose the first group both depend on the
+     *              whole hash, even for identity hashes such as std::hash<int>.
+     * @param       ky : The key.
+     * @return      The mixed hash of the key.
+     */
+    template<typename KeyT_>
+    std::uint64_t get_mixed_hash(const KeyT_& ky) const
+    {
+        const std::uint64_t mixd_hsh = static_cast<std::uint64_t>(hshr_(ky)) *
+                0x9E3779B97F4A7C15ull;
+
+        return mixd_hsh ^ (mixd_hsh >> 32);
+    }
+
+    /**
+     * @brief       Get the control byte of a mixed hash.
+     * @param       mixd_hsh : The mixed hash.
+     * @return      The control byte of the mixed hash.
+     */
+    static std::int8_t get_h2(std::uint64_t mixd_hsh) noexcept
+    {
+        return static_cast<std::int8_t>(mixd_hsh & 0x7F);
+    }
+
+    /**
+     * @brief       Get the number of elements that a number of slots can hold before growing,
+     *              which keeps the load factor under seven eighths.
+     * @param       cap : The number of slots.
+     * @return      The number of elements.
+     */
+    static std::size_t get_growth(std::size_t cap) noexcept
+    {
+        return cap - cap / 8;
+    }
+
+    /**
+     * @brief       Find the slot that holds a key.
+     * @param       ky : The key.
+     * @param       mixd_hsh : The mixed hash of the key.
+     * @return      If function was successful the slot index is returned, otherwise the number of
+     *              slots is returned.
+     */
+    template<typename KeyT_>
+    std::size_t find_slot(const KeyT_& ky, std::uint64_t mixd_hsh) const
+    {
+        if (cap_ == 0)
+        {
+            return 0;
+        }
+
+        const std::size_t msk = cap_ - 1;
+        const std::int8_t h2 = get_h2(mixd_hsh);
+        std::size_t cur_slot = static_cast<std::size_t>(mixd_hsh >> 7) & msk;
+        std::size_t stp = 0;
+        std::size_t match_slot;
+
+        for (;;)
+        {
+            group_type grp(ctrl_ + cur_slot);
+            auto match_msk = grp.match(h2);
+
+            while (match_msk)
+            {
+                match_slot = (cur_slot + match_msk.get_lowest()) & msk;
+
+                if (eq_(PolicyT::get_key(slts_[match_slot]), ky))
+                {
+                    return match_slot;
+                }
+
+                match_msk.remove_lowest();
+            }
+
+            if (grp.match_empty())
+            {
+                return cap_;
+            }
+
+            stp += GROUP_WIDTH;
+            cur_slot = (cur_slot + stp) & msk;
+        }
+    }
+
+    /**
+     * @brief       Find the first slot that holds no element in the probing sequence of a hash.
+     * @param       mixd_hsh : The mixed hash.
+     * @return      The slot index.
+     */
+    std::size_t find_free_slot(std::uint64_t mixd_hsh) const noexcept
+    {
+        const std::size_t msk = cap_ - 1;
+        std::size_t cur_slot = static_cast<std::size_t>(mixd_hsh >> 7) & msk;
+        std::size_t stp = 0;
+
+        for (;;)
+        {
+            auto free_msk = group_type(ctrl_ + cur_slot).match_free();
+
+            if (free_msk)
+            {
+                return (cur_slot + free_msk.get_lowest()) & msk;
+            }
+
+            stp += GROUP_WIDTH;
+            cur_slot = (cur_slot + stp) & msk;
+        }
+    }
+
+    /**
+     * @brief       Look up a key and, if it is missing, find the slot in which to insert it,
+     *              growing the table if needed.
+     * @param       ky : The key.
+     * @return      The location of the key.
+     */
+    template<typename KeyT_>
+    insert_location prepare_insert(const KeyT_& ky)
+    {
+        const std::uint64_t mixd_hsh = get_mixed_hash(ky);
+        std::size_t cur_slot = find_slot(ky, mixd_hsh);
+
+        if (cur_slot != cap_)
+        {
+            return {cur_slot, mixd_hsh, false};
+        }
+
+        if (cap_ == 0)
+        {
+            resize(GROUP_WIDTH);
+        }
+
+        cur_slot = find_free_slot(mixd_hsh);
+
+        if (grwth_lft_ == 0 && ctrl_[cur_slot] == CONTROL_EMPTY)
+        {
+            resize(sz_ <= get_growth(cap_) / 2 ? cap_ : cap_ * 2);
+            cur_slot = find_free_slot(mixd_hsh);
+        }
+
+        return {cur_slot, mixd_hsh, true};
+    }
+
+    /**
+     * @brief       Construct an element from some arguments if its key is missing.
+     * @param       ky : The key of the element.
+     * @param       args : The arguments to construct the element.
+     * @return      An iterator to the element with the key and whether the insertion took place.
+     */
+    template<typename KeyT_, typename... Ts_>
+    std::pair<iterator, bool> emplace_key(const KeyT_& ky, Ts_&&... args)
+    {
+        const insert_location loc = prepare_insert(ky);
+
+        if (loc.insrtd_)
+        {
+            slot_allocator_traits::construct(alloc_, slts_ + loc.slt_, std::forward<Ts_>(args)...);
+            commit_insert(loc);
+        }
+
+        return {iterator(this, loc.slt_), loc.insrtd_};
+    }
+
+    /**
+     * @brief       Mark as used the slot in which an element has just been constructed.
+     * @param       loc : The location of the element.
+     */
+    void commit_insert(const insert_location& loc) noexcept
+    {
+        if (ctrl_[loc.slt_] == CONTROL_EMPTY)
+        {
+            --grwth_lft_;
+        }
+
+        set_control(loc.slt_, get_h2(loc.mixd_hsh_));
+        ++sz_;
+    }
+
+    /**
+     * @brief       Destroy the element of a slot. The slot is marked as deleted, so the probing
+     *              sequences that go through it are kept.
+     * @param       cur_slot : The slot.
+     */
+    void erase_slot(std::size_t cur_slot) noexcept
+    {
+        slot_allocator_traits::destroy(alloc_, slts_ + cur_slot);
+        set_control(cur_slot, CONTROL_DELETED);
+        --sz_;
+    }
+
+    /**
+     * @brief       Set the control byte of a slot and of its mirrored byte. The first control
+     *              bytes are mirrored after the end, so a group can be loaded from any slot
+     *              without wrapping.
+     * @param       cur_slot : The slot.
+     * @param       ctrl : The control byte.
+     */
+    void set_control(std::size_t cur_slot, std::int8_t ctrl) noexcept
+    {
+        ctrl_[cur_slot] = ctrl;
+
+        if (cur_slot < GROUP_WIDTH - 1)
+        {
+            ctrl_[cap_ + cur_slot] = ctrl;
+        }
+    }
+
+    /**
+     * @brief       Move all the elements in a new array of slots. The deleted slots are dropped.
+     *              When moving an element may throw, the elements are copied instead, so if an
+     *              exception is thrown the table is left unchanged. Otherwise only the hash can
+     *              throw, in which case the elements already moved are kept and the others are
+     *              destroyed.
+     * @param       new_cap : The new number of slots, a power of two not lower than the group
+     *              width.
+     */
+    void resize(std::size_t new_cap)
+    {
+        control_allocator_type ctrl_alloc(alloc_);
+        std::int8_t* const old_ctrl = ctrl_;
+        value_type* const old_slts = slts_;
+        const std::size_t old_cap = cap_;
+        const std::size_t old_grwth_lft = grwth_lft_;
+        std::size_t i = 0;
+
+        ctrl_ = control_allocator_traits::allocate(ctrl_alloc, new_cap + GROUP_WIDTH - 1);
+
+        try
+        {
+            slts_ = slot_allocator_traits::allocate(alloc_, new_cap);
+        }
+        catch (...)
+        {
+            control_allocator_traits::deallocate(ctrl_alloc, ctrl_, new_cap + GROUP_WIDTH - 1);
+            ctrl_ = old_ctrl;
+            throw;
+        }
+
+        std::memset(ctrl_, CONTROL_EMPTY, new_cap + GROUP_WIDTH - 1);
+        cap_ = new_cap;
+        grwth_lft_ = get_growth(new_cap) - sz_;
+
+        try
+        {
+            for (; i < old_cap; ++i)
+            {
+                if (old_ctrl[i] >= 0)
+                {
+                    const std::uint64_t mixd_hsh = get_mixed_hash(PolicyT::get_key(old_slts[i]));
+                    const std::size_t free_slot = find_free_slot(mixd_hsh);
+
+                    if constexpr (COPY_ON_RESIZE)
+                    {
+                        slot_allocator_traits::construct(
+                                alloc_, slts_ + free_slot, std::as_const(old_slts[i]));
+                    }
+                    else
+                    {
+                        PolicyT::transfer(alloc_, slts_ + free_slot, old_slts + i);
+                        slot_allocator_traits::destroy(alloc_, old_slts + i);
+                    }
+
+                    set_control(free_slot, get_h2(mixd_hsh));
+                }
+            }
+        }
+        catch (...)
+        {
+            if constexpr (COPY_ON_RESIZE)
+            {
+                for (std::size_t j = 0; j < new_cap; ++j)
+                {
+                    if (ctrl_[j] >= 0)
+                    {
+                        slot_allocator_traits::destroy(alloc_, slts_ + j);
+                    }
+                }
+
+                slot_allocator_traits::deallocate(alloc_, slts_, new_cap);
+                control_allocator_traits::deallocate(ctrl_alloc, ctrl_, new_cap + GROUP_WIDTH - 1);
+                ctrl_ = old_ctrl;
+                slts_ = old_slts;
+                cap_ = old_cap;
+                grwth_lft_ = old_grwth_lft;
+            }
+            else
+            {
+                for (; i < old_cap; ++i)
+                {
+                    if (old_ctrl[i] >= 0)
+                    {
+                        slot_allocator_traits::destroy(alloc_, old_slts + i);
+                        --sz_;
+                    }
+                }
+
+                grwth_lft_ = get_growth(new_cap) - sz_;
+                deallocate_slots(old_ctrl, old_slts, old_cap);
+            }
+
+            throw;
+        }
+
+        if constexpr (COPY_ON_RESIZE)
+        {
+            for (i = 0; i < old_cap; ++i)
+            {
+                if (old_ctrl[i] >= 0)
+                {
+                    slot_allocator_traits::destroy(alloc_, old_slts + i);
+                }
+            }
+        }
+
+        deallocate_slots(old_ctrl, old_slts, old_cap);
+    }
+
+    /**
+     * @brief       Deallocate an array of slots and its control bytes, once their elements are
+     *              destroyed.
+     * @param       ctrl : The control bytes.
+     * @param       slts : The slots.
+     * @param       cap : The number of slots, the arrays aren't allocated if it is zero.
+     */
+    void deallocate_slots(std::int8_t* ctrl, value_type* slts, std::size_t cap) noexcept
+    {
+        control_allocator_type ctrl_alloc(alloc_);
+
+        if (cap > 0)
+        {
+            slot_allocator_traits::deallocate(alloc_, slts, cap);
+            control_allocator_traits::deallocate(ctrl_alloc, ctrl, cap + GROUP_WIDTH - 1);
+        }
+    }
+
+    /**
+     * @brief       Destroy all the elements and deallocate the slots.
+     */
+    void destroy_slots() noexcept
+    {
+        if (cap_ == 0)
+        {
+            return;
+        }
+
+        clear();
+        deallocate_slots(ctrl_, slts_, cap_);
+        ctrl_ = nullptr;
+        slts_ = nullptr;
+        cap_ = 0;
+        grwth_lft_ = 0;
+    }
+
+private:
+    /** The hash. */
+    [[no_unique_address]] hash_type hshr_;
+
+    /** The predicate. */
+    [[no_unique_address]] pred_type eq_;
+
+    /** The allocator of the slots. */
+    [[no_unique_address]] slot_allocator_type alloc_;
+
+    /** The control bytes, followed by the mirror of the first group. */
+    std::int8_t* ctrl_ = nullptr;
+
+    /** The slots. */
+    value_type* slts_ = nullptr;
+
+    /** The number of slots, zero or a power of two not lower than the group width. */
+    std::size_t cap_ = 0;
+
+    /** The number of elements. */
+    std::size_t sz_ = 0;
+
+    /** The number of elements that can be inserted in empty slots before growing. */
+    std::size_t grwth_lft_ = 0;
+};
+
+}
+
+#endif
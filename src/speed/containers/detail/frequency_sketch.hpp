@@ -0,0 +1,160 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       frequency_sketch.hpp
+ * @brief      frequency_sketch class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_DETAIL_FREQUENCY_SKETCH_HPP
+#define SPEED_CONTAINERS_DETAIL_FREQUENCY_SKETCH_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace speed::containers::detail {
+
+/**
+ * @brief       Class that represents a count-min sketch of 4-bit counters that estimates how
+ *              often a hash has been seen recently. Every hash is counted in one counter of each
+ *              of four rows and its frequency is the smallest of them. Once the number of
+ *              additions reaches ten times the capacity every counter is halved, so the
+ *              estimates follow the changes of popularity.
+ */
+class frequency_sketch
+{
+public:
+    /** The greatest frequency a counter can hold. */
+    static constexpr std::uint32_t MAX_FREQUENCY = 15;
+
+    /**
+     * @brief       Allocate the sketch.
+     * @param       cap : The number of elements whose frequency has to be told apart.
+     */
+    void initialize(std::size_t cap)
+    {
+        tbl_.assign(std::bit_ceil(cap < 16 ? std::size_t(16) : cap) / 4, 0);
+        smpl_sz_ = (cap < 1 ? 1 : cap) * 10;
+        n_adds_ = 0;
+    }
+
+    /**
+     * @brief       Count an occurrence of a hash.
+     * @param       hsh : The hash.
+     */
+    void increment(std::size_t hsh) noexcept
+    {
+        bool added = false;
+
+        for (std::size_t i = 0; i < N_ROWS; ++i)
+        {
+            const std::uint64_t idx = get_counter_index(hsh, i);
+            std::uint64_t& wrd = tbl_[idx >> 4];
+            const std::uint64_t shft = (idx & 15) << 2;
+
+            if (((wrd >> shft) & 0xF) < MAX_FREQUENCY)
+            {
+                wrd += std::uint64_t(1) << shft;
+                added = true;
+            }
+        }
+
+        if (added && ++n_adds_ >= smpl_sz_)
+        {
+            reset();
+        }
+    }
+
+    /**
+     * @brief       Get the estimated frequency of a hash.
+     * @param       hsh : The hash.
+     * @return      The estimated frequency of the hash.
+     */
+    [[nodiscard]] std::uint32_t get_frequency(std::size_t hsh) const noexcept
+    {
+        std::uint32_t freq = MAX_FREQUENCY;
+
+        for (std::size_t i = 0; i < N_ROWS; ++i)
+        {
+            const std::uint64_t idx = get_counter_index(hsh, i);
+            const auto cur_freq = static_cast<std::uint32_t>(
+                    (tbl_[idx >> 4] >> ((idx & 15) << 2)) & 0xF);
+
+            freq = cur_freq < freq ? cur_freq : freq;
+        }
+
+        return freq;
+    }
+
+private:
+    /** The number of rows. */
+    static constexpr std::size_t N_ROWS = 4;
+
+    /**
+     * @brief       Get the index of the counter of a hash in a row. Every row covers all the
+     *              counters of the table with its own hash function.
+     * @param       hsh : The hash.
+     * @param       row : The row.
+     * @return      The index of the counter of the hash in the row.
+     */
+    [[nodiscard]] std::uint64_t get_counter_index(std::size_t hsh, std::size_t row) const noexcept
+    {
+        static constexpr std::uint64_t SEEDS[N_ROWS] = {
+                0x97CB3127F3F5A1D3ull, 0xB492B66FBE98F273ull,
+                0x9AE16A3B2F90404Full, 0xCBF29CE484222325ull
+        };
+
+        std::uint64_t h = (static_cast<std::uint64_t>(hsh) + SEEDS[row]) * SEEDS[row];
+
+        h ^= h >> 32;
+
+        return h & ((tbl_.size() << 4) - 1);
+    }
+
+    /**
+     * @brief       Halve all the counters.
+     */
+    void reset() noexcept
+    {
+        for (auto& wrd : tbl_)
+        {
+            wrd = (wrd >> 1) & 0x7777777777777777ull;
+        }
+
+        n_adds_ /= 2;
+    }
+
+private:
+    /** The counters, sixteen in every word. */
+    std::vector<std::uint64_t> tbl_;
+
+    /** The number of additions after which the counters are halved. */
+    std::size_t smpl_sz_ = 1;
+
+    /** The number of additions since the last halving. */
+    std::size_t n_adds_ = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,250 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       ghost_list.hpp
+ * @brief      ghost_list class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_DETAIL_GHOST_LIST_HPP
+#define SPEED_CONTAINERS_DETAIL_GHOST_LIST_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace speed::containers::detail {
+
+/**
+ * @brief       Class that represents a bounded first in first out list of the hashes of keys
+ *              that have been evicted. Only the hashes are kept, so a ghost list remembers many
+ *              more keys than the cache holds for a few words each. When the list is full the
+ *              oldest hash is forgotten. All the memory is allocated by initialize.
+ */
+class ghost_list
+{
+public:
+    /**
+     * @brief       Allocate the list.
+     * @param       cap : The maximum number of hashes held by the list.
+     */
+    void initialize(std::size_t cap)
+    {
+        const std::size_t n_buckets = std::bit_ceil(cap * 2 < 2 ? 2 : cap * 2);
+
+        ents_.assign(cap, entry());
+        bkts_.assign(n_buckets, NIL);
+        bkt_shft_ = 64 - static_cast<std::size_t>(std::countr_zero(n_buckets));
+        head_ = NIL;
+        sz_ = 0;
+        free_ = NIL;
+
+        for (std::size_t i = cap; i-- > 0;)
+        {
+            ents_[i].nxt_ = free_;
+            free_ = static_cast<index_type>(i);
+        }
+    }
+
+    /**
+     * @brief       Insert a hash in the end of the list, forgetting the oldest one if the list
+     *              is full.
+     * @param       hsh : The hash to insert.
+     */
+    void push_back(std::size_t hsh) noexcept
+    {
+        if (ents_.empty())
+        {
+            return;
+        }
+
+        if (free_ == NIL)
+        {
+            pop_front();
+        }
+
+        const index_type idx = free_;
+        entry& ent = ents_[idx];
+        index_type& bkt = bkts_[get_bucket_index(hsh)];
+
+        free_ = ent.nxt_;
+        ent.hsh_ = hsh;
+        ent.b_nxt_ = bkt;
+        bkt = idx;
+
+        if (head_ == NIL)
+        {
+            head_ = idx;
+            ent.nxt_ = idx;
+            ent.prev_ = idx;
+        }
+        else
+        {
+            ent.prev_ = ents_[head_].prev_;
+            ent.nxt_ = head_;
+            ents_[ents_[head_].prev_].nxt_ = idx;
+            ents_[head_].prev_ = idx;
+        }
+
+        ++sz_;
+    }
+
+    /**
+     * @brief       Forget the oldest hash of the list.
+     */
+    void pop_front() noexcept
+    {
+        if (head_ != NIL)
+        {
+            erase_entry(head_);
+        }
+    }
+
+    /**
+     * @brief       Forget a hash if it is in the list.
+     * @param       hsh : The hash to forget.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool erase(std::size_t hsh) noexcept
+    {
+        if (ents_.empty())
+        {
+            return false;
+        }
+
+        for (index_type idx = bkts_[get_bucket_index(hsh)]; idx != NIL; idx = ents_[idx].b_nxt_)
+        {
+            if (ents_[idx].hsh_ == hsh)
+            {
+                erase_entry(idx);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief       Get the number of hashes in the list.
+     * @return      The number of hashes in the list.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return sz_;
+    }
+
+private:
+    /** The index type. */
+    using index_type = std::uint32_t;
+
+    /** The index that represents the absence of entry. */
+    static constexpr index_type NIL = std::numeric_limits<index_type>::max();
+
+    /**
+     * @brief       Struct that represents a remembered hash.
+     */
+    struct entry
+    {
+        /** The hash. */
+        std::size_t hsh_ = 0;
+
+        /** The next entry in the list, or in the free entries. */
+        index_type nxt_ = NIL;
+
+        /** The previous entry in the list. */
+        index_type prev_ = NIL;
+
+        /** The next entry in the same bucket. */
+        index_type b_nxt_ = NIL;
+    };
+
+    /**
+     * @brief       Get the bucket index associated with a hash.
+     * @param       hsh : The hash.
+     * @return      The bucket index associated with the hash.
+     */
+    [[nodiscard]] std::size_t get_bucket_index(std::size_t hsh) const noexcept
+    {
+        return static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(hsh) * 0x9E3779B97F4A7C15ull) >> bkt_shft_);
+    }
+
+    /**
+     * @brief       Erase an entry from the list and from its bucket.
+     * @param       idx : The entry index.
+     */
+    void erase_entry(index_type idx) noexcept
+    {
+        entry& ent = ents_[idx];
+        index_type* pidx = &bkts_[get_bucket_index(ent.hsh_)];
+
+        while (*pidx != idx)
+        {
+            pidx = &ents_[*pidx].b_nxt_;
+        }
+
+        *pidx = ent.b_nxt_;
+
+        if (ent.nxt_ == idx)
+        {
+            head_ = NIL;
+        }
+        else
+        {
+            if (idx == head_)
+            {
+                head_ = ent.nxt_;
+            }
+
+            ents_[ent.prev_].nxt_ = ent.nxt_;
+            ents_[ent.nxt_].prev_ = ent.prev_;
+        }
+
+        ent.nxt_ = free_;
+        free_ = idx;
+        --sz_;
+    }
+
+private:
+    /** The entries. */
+    std::vector<entry> ents_;
+
+    /** The first entry of every bucket. */
+    std::vector<index_type> bkts_;
+
+    /** The shift that reduces a mixed hash to a bucket index. */
+    std::size_t bkt_shft_ = 63;
+
+    /** The oldest entry of the list. */
+    index_type head_ = NIL;
+
+    /** The first free entry. */
+    index_type free_ = NIL;
+
+    /** The number of hashes in the list. */
+    std::size_t sz_ = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,336 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       timer_wheel.hpp
+ * @brief      timer_wheel class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_DETAIL_TIMER_WHEEL_HPP
+#define SPEED_CONTAINERS_DETAIL_TIMER_WHEEL_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace speed::containers::detail {
+
+/**
+ * @brief       Struct that represents the links of a node scheduled in a timer wheel.
+ */
+struct timer_link
+{
+    /** Pointer to the next node in the slot, or nullptr if the node isn't scheduled. */
+    timer_link* tmr_nxt_ = nullptr;
+
+    /** Pointer to the previous node in the slot. */
+    timer_link* tmr_prev_ = nullptr;
+};
+
+/**
+ * @brief       Class that represents a hierarchical timer wheel. The nodes derive from
+ *              timer_link and hold their deadline in nanoseconds in a member named ddln_. Time
+ *              is split in ticks of 2^TICK_BITS nanoseconds, and every level of the wheel has
+ *              N_SLOTS slots that each span N_SLOTS times the ticks of the level below. A node
+ *              is scheduled in the level that matches how far its deadline is, and it is moved
+ *              to a lower level when the wheel reaches its slot, so advancing the wheel only
+ *              visits the nodes that expire and the slots that are due. Every slot keeps a bit
+ *              in an occupancy mask, which lets the wheel skip the empty ones.
+ */
+template<typename NodeT>
+class timer_wheel
+{
+public:
+    /** The node type. */
+    using node_type = NodeT;
+
+    /** The number of bits of a deadline in nanoseconds that are dropped to get its tick. */
+    static constexpr std::size_t TICK_BITS = 20;
+
+    /** The number of bits of a tick that index the slots of a level. */
+    static constexpr std::size_t SLOT_BITS = 6;
+
+    /** The number of slots in every level. */
+    static constexpr std::size_t N_SLOTS = std::size_t(1) << SLOT_BITS;
+
+    /** The number of levels, the wheel spans N_SLOTS^N_LEVELS ticks, more than two years. */
+    static constexpr std::size_t N_LEVELS = 6;
+
+    /**
+     * @brief       Default constructor.
+     */
+    timer_wheel() noexcept
+    {
+        for (auto& lvl : slts_)
+        {
+            for (auto& slt : lvl)
+            {
+                slt.tmr_nxt_ = &slt;
+                slt.tmr_prev_ = &slt;
+            }
+        }
+    }
+
+    /** @cond */
+    timer_wheel(const timer_wheel& rhs) = delete;
+
+    timer_wheel(timer_wheel&& rhs) = delete;
+
+    timer_wheel& operator =(const timer_wheel& rhs) = delete;
+
+    timer_wheel& operator =(timer_wheel&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Schedule a node that isn't scheduled. A node whose deadline has already passed
+     *              expires the next time the wheel is advanced.
+     * @param       nd : The node to schedule.
+     * @param       now_tck : The current tick, it lets an empty wheel catch up with the time.
+     */
+    void schedule(node_type* nd, std::uint64_t now_tck) noexcept
+    {
+        if (n_nds_ == 0 && cur_tck_ < now_tck)
+        {
+            cur_tck_ = now_tck;
+        }
+
+        link(nd, nd->ddln_ >> TICK_BITS);
+        ++n_nds_;
+    }
+
+    /**
+     * @brief       Unschedule a scheduled node.
+     * @param       nd : The node to unschedule.
+     */
+    void cancel(node_type* nd) noexcept
+    {
+        unlink(nd);
+        --n_nds_;
+    }
+
+    /**
+     * @brief       Allows knowing whether a node is scheduled.
+     * @param       nd : The node to check.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] static bool is_scheduled(const node_type* nd) noexcept
+    {
+        return nd->tmr_nxt_ != nullptr;
+    }
+
+    /**
+     * @brief       Advance the wheel up to a tick and unschedule all the nodes whose deadline is
+     *              in an earlier tick.
+     * @param       tck : The first tick that isn't processed.
+     * @param       expre : Function called with every unscheduled node. If it returns false the
+     *              node is kept and scheduled again in the tick tck.
+     */
+    template<typename ExpireT>
+    void advance(std::uint64_t tck, ExpireT&& expre)
+    {
+        while (cur_tck_ < tck)
+        {
+            if (n_nds_ == 0)
+            {
+                cur_tck_ = tck;
+                break;
+            }
+
+            std::size_t lvl = 0;
+
+            while (lvl < N_LEVELS - 1 && occ_[lvl] == 0)
+            {
+                ++lvl;
+            }
+
+            const std::size_t shft = (lvl == 0 ? 1 : lvl) * SLOT_BITS;
+            const std::uint64_t nxt_bndry = ((cur_tck_ >> shft) + 1) << shft;
+            const std::uint64_t end_tck = nxt_bndry < tck ? nxt_bndry : tck;
+
+            if (lvl == 0)
+            {
+                const std::size_t fst_slt = cur_tck_ & (N_SLOTS - 1);
+                const std::size_t lst_slt = (end_tck - 1) & (N_SLOTS - 1);
+                std::uint64_t due = occ_[0] & (~std::uint64_t(0) << fst_slt) &
+                                    (~std::uint64_t(0) >> (N_SLOTS - 1 - lst_slt));
+
+                while (due != 0)
+                {
+                    const auto slt = static_cast<std::size_t>(std::countr_zero(due));
+
+                    due &= due - 1;
+                    expire_slot(slt, tck, expre);
+                }
+            }
+
+            cur_tck_ = end_tck;
+            cascade();
+        }
+    }
+
+private:
+    /**
+     * @brief       Get the number of ticks spanned by all the slots of a level.
+     * @param       lvl : The level.
+     * @return      The number of ticks spanned by all the slots of the level.
+     */
+    static constexpr std::uint64_t get_level_span(std::size_t lvl) noexcept
+    {
+        return std::uint64_t(1) << ((lvl + 1) * SLOT_BITS);
+    }
+
+    /**
+     * @brief       Insert a node in the slot of a tick.
+     * @param       nd : The node to insert.
+     * @param       tck : The tick, it is moved to the current tick if it is earlier.
+     */
+    void link(node_type* nd, std::uint64_t tck) noexcept
+    {
+        if (tck < cur_tck_)
+        {
+            tck = cur_tck_;
+        }
+        else if (tck - cur_tck_ >= get_level_span(N_LEVELS - 1))
+        {
+            tck = cur_tck_ + get_level_span(N_LEVELS - 1) - 1;
+        }
+
+        const std::uint64_t dlta = tck - cur_tck_;
+        const std::size_t lvl = dlta < N_SLOTS ?
+                0 : (static_cast<std::size_t>(std::bit_width(dlta)) - 1) / SLOT_BITS;
+        const std::size_t slt = (tck >> (lvl * SLOT_BITS)) & (N_SLOTS - 1);
+        timer_link* const hd = &slts_[lvl][slt];
+
+        nd->tmr_prev_ = hd->tmr_prev_;
+        nd->tmr_nxt_ = hd;
+        hd->tmr_prev_->tmr_nxt_ = nd;
+        hd->tmr_prev_ = nd;
+        occ_[lvl] |= std::uint64_t(1) << slt;
+    }
+
+    /**
+     * @brief       Erase a node from its slot.
+     * @param       nd : The node to erase.
+     */
+    static void unlink(timer_link* nd) noexcept
+    {
+        nd->tmr_prev_->tmr_nxt_ = nd->tmr_nxt_;
+        nd->tmr_nxt_->tmr_prev_ = nd->tmr_prev_;
+        nd->tmr_nxt_ = nullptr;
+        nd->tmr_prev_ = nullptr;
+    }
+
+    /**
+     * @brief       Detach all the nodes of a slot.
+     * @param       lvl : The slot level.
+     * @param       slt : The slot index.
+     * @return      The first detached node, the last one has a nullptr next link.
+     */
+    timer_link* detach_slot(std::size_t lvl, std::size_t slt) noexcept
+    {
+        timer_link* const hd = &slts_[lvl][slt];
+        timer_link* const fst = hd->tmr_nxt_;
+
+        occ_[lvl] &= ~(std::uint64_t(1) << slt);
+
+        if (fst == hd)
+        {
+            return nullptr;
+        }
+
+        hd->tmr_prev_->tmr_nxt_ = nullptr;
+        hd->tmr_nxt_ = hd;
+        hd->tmr_prev_ = hd;
+
+        return fst;
+    }
+
+    /**
+     * @brief       Unschedule all the nodes of a slot of the lowest level.
+     * @param       slt : The slot index.
+     * @param       tck : The tick in which the kept nodes are scheduled again.
+     * @param       expre : Function called with every unscheduled node.
+     */
+    template<typename ExpireT>
+    void expire_slot(std::size_t slt, std::uint64_t tck, ExpireT& expre)
+    {
+        timer_link* cur = detach_slot(0, slt);
+
+        while (cur != nullptr)
+        {
+            timer_link* const nxt = cur->tmr_nxt_;
+            auto* const nd = static_cast<node_type*>(cur);
+
+            nd->tmr_nxt_ = nullptr;
+            nd->tmr_prev_ = nullptr;
+            --n_nds_;
+
+            if (!expre(nd))
+            {
+                link(nd, tck);
+                ++n_nds_;
+            }
+
+            cur = nxt;
+        }
+    }
+
+    /**
+     * @brief       Move to lower levels the nodes of the slots the current tick has reached.
+     */
+    void cascade() noexcept
+    {
+        for (std::size_t lvl = 1; lvl < N_LEVELS; ++lvl)
+        {
+            if ((cur_tck_ & ((std::uint64_t(1) << (lvl * SLOT_BITS)) - 1)) != 0)
+            {
+                break;
+            }
+
+            timer_link* cur = detach_slot(lvl, (cur_tck_ >> (lvl * SLOT_BITS)) & (N_SLOTS - 1));
+
+            while (cur != nullptr)
+            {
+                timer_link* const nxt = cur->tmr_nxt_;
+                auto* const nd = static_cast<node_type*>(cur);
+
+                link(nd, nd->ddln_ >> TICK_BITS);
+                cur = nxt;
+            }
+        }
+    }
+
+    /** The slots of every level, each one is the head of a circular list. */
+    timer_link slts_[N_LEVELS][N_SLOTS];
+
+    /** The occupancy mask of every level, a bit is set for every slot that may hold nodes. */
+    std::uint64_t occ_[N_LEVELS] = {};
+
+    /** The first tick that hasn't been processed. */
+    std::uint64_t cur_tck_ = 0;
+
+    /** The number of scheduled nodes. */
+    std::size_t n_nds_ = 0;
+};
+
+}
+
+#endif
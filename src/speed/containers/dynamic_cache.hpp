@@ -0,0 +1,378 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       dynamic_cache.hpp
+ * @brief      dynamic_cache class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_DYNAMIC_CACHE_HPP
+#define SPEED_CONTAINERS_DYNAMIC_CACHE_HPP
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "cache_base.hpp"
+#include "lru_eviction_policy.hpp"
+#include "no_statistics_policy.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a generic cache whose number of buffers is chosen at run
+ *              time. The buffers and the hash buffer are held in a single arena obtained from the
+ *              allocator, so inserting an element never allocates, and the cache can be resized.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        typename HashT = std::hash<KeyT>,
+        typename PredT = std::equal_to<KeyT>,
+        template<typename> class EvictionPolicyT = lru_eviction_policy,
+        typename AllocatorT = std::allocator<std::byte>,
+        typename StatisticsT = no_statistics_policy
+>
+class dynamic_cache
+        : public cache_base<
+                dynamic_cache<
+                        KeyT, ValueT, HashT, PredT, EvictionPolicyT, AllocatorT, StatisticsT>,
+                KeyT,
+                ValueT,
+                HashT,
+                PredT,
+                EvictionPolicyT,
+                StatisticsT
+        >
+{
+public:
+    /** The base class. */
+    using base_type = cache_base<
+            dynamic_cache, KeyT, ValueT, HashT, PredT, EvictionPolicyT, StatisticsT>;
+    
+    /** The buffer type. */
+    using typename base_type::buffer;
+    
+    /** The hash buffer type. */
+    using typename base_type::hash_buffer;
+    
+    /** The allocator type. */
+    using allocator_type = AllocatorT;
+    
+    /** The eviction policy type. */
+    using typename base_type::policy_type;
+    
+    /**
+     * @brief       Constructor with parameters.
+     * @param       sz : The number of buffers.
+     * @param       alloc : The allocator used to obtain the arena.
+     */
+    explicit dynamic_cache(std::size_t sz, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
+            , arna_(allocate_arena(sz))
+    {
+        base_type::initialize(arna_.bufs_, arna_.sz_);
+    }
+    
+    /** @cond */
+    dynamic_cache(const dynamic_cache& rhs) = delete;
+    
+    dynamic_cache(dynamic_cache&& rhs) = delete;
+    
+    dynamic_cache& operator =(const dynamic_cache& rhs) = delete;
+    
+    dynamic_cache& operator =(dynamic_cache&& rhs) = delete;
+    /** @endcond */
+    
+    /**
+     * @brief       Destructor.
+     */
+    ~dynamic_cache()
+    {
+        deallocate_arena(arna_);
+    }
+    
+    /**
+     * @brief       Change the number of buffers. A new arena is allocated and the elements are
+     *              moved into it and linked in its hash buffer using their stored hashes, so no
+     *              key is hashed again. The locked elements are kept locked. When the cache
+     *              shrinks, the elements that the eviction policy would evict first are dropped.
+     *              The policy starts over with the elements ordered as they would have been
+     *              evicted, so any state it kept besides that order, like frequencies, is lost.
+     *              All the iterators are invalidated. The new arena and its eviction policy are
+     *              prepared before the current ones are touched, so if an exception is thrown while
+     *              doing so the cache is left unchanged. If moving an element throws, the elements
+     *              that were already moved are kept and the others are destroyed.
+     * @param       sz : The new number of buffers.
+     * @throw       exhausted_resources_exception : If the locked elements don't fit in the new
+     *              number of buffers.
+     */
+    void resize(std::size_t sz)
+    {
+        std::size_t n_lckd = 0;
+        std::size_t n_unlckd = 0;
+        
+        for (std::size_t i = 0; i < arna_.sz_; i++)
+        {
+            const auto& flgs = arna_.bufs_[i].flgs_;
+            
+            if (!flgs.is_set(scbf_t::INSERTED_IN_HASH_BUFFER))
+            {
+                continue;
+            }
+            
+            if (flgs.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+            {
+                ++n_unlckd;
+            }
+            else
+            {
+                ++n_lckd;
+            }
+        }
+        
+        if (n_lckd > sz)
+        {
+            base_type::stats_.on_exhausted();
+            throw exhausted_resources_exception();
+        }
+        
+        arena new_arna = allocate_arena(sz);
+        policy_type new_plcy;
+        
+        try
+        {
+            base_type::initialize(new_arna.bufs_, new_arna.sz_, new_plcy);
+        }
+        catch (...)
+        {
+            deallocate_arena(new_arna);
+            throw;
+        }
+        
+        std::size_t n_drops = n_lckd + n_unlckd > sz ? n_lckd + n_unlckd - sz : 0;
+        buffer* unlckd_first = nullptr;
+        buffer** unlckd_lst = &unlckd_first;
+        buffer* vctm;
+        
+        // The old hash buffer is no longer needed, so the b_nxt_ links are reused to chain the
+        // unlocked elements in the order in which the eviction policy would have evicted them.
+        while ((vctm = base_type::plcy_.get_victim()) != nullptr)
+        {
+            base_type::plcy_.on_lock(vctm);
+            
+            if (vctm->flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER))
+            {
+                if (n_drops > 0)
+                {
+                    --n_drops;
+                    base_type::stats_.on_eviction();
+                }
+                else
+                {
+                    *unlckd_lst = vctm;
+                    unlckd_lst = &vctm->b_nxt_;
+                }
+            }
+        }
+        
+        *unlckd_lst = nullptr;
+        arena old_arna = std::exchange(arna_, new_arna);
+        base_type::plcy_ = std::move(new_plcy);
+        
+        try
+        {
+            for (std::size_t i = 0; i < old_arna.sz_; i++)
+            {
+                const auto& flgs = old_arna.bufs_[i].flgs_;
+                
+                if (flgs.is_set(scbf_t::INSERTED_IN_HASH_BUFFER) &&
+                    !flgs.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+                {
+                    base_type::lock_buffer(
+                            base_type::get_buffer(move_buffer(&old_arna.bufs_[i])));
+                }
+            }
+            
+            for (buffer* buf = unlckd_first; buf != nullptr; buf = buf->b_nxt_)
+            {
+                move_buffer(buf);
+            }
+        }
+        catch (...)
+        {
+            deallocate_arena(old_arna);
+            throw;
+        }
+        
+        deallocate_arena(old_arna);
+    }
+    
+    /**
+     * @brief       Get the number of buffers.
+     * @return      The number of buffers.
+     */
+    [[nodiscard]] std::size_t get_size() const noexcept
+    {
+        return arna_.sz_;
+    }
+    
+    /**
+     * @brief       Get the allocator.
+     * @return      The allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
+protected:
+    /**
+     * @brief       Get the hash buffer.
+     * @return      The hash buffer.
+     */
+    [[nodiscard]] hash_buffer* get_hash_buffer() const noexcept
+    {
+        return arna_.hbuf_;
+    }
+    
+    /**
+     * @brief       Get the hash buffer size.
+     * @return      The hash buffer size.
+     */
+    [[nodiscard]] std::size_t get_hash_buffer_size() const noexcept
+    {
+        return arna_.hbuf_sz_;
+    }
+    
+    friend base_type;
+    
+private:
+    /** The allocator that provides the arena storage. */
+    using buffer_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<buffer>;
+    
+    /** The buffer allocator traits. */
+    using buffer_allocator_traits = std::allocator_traits<buffer_allocator_type>;
+    
+    /**
+     * @brief       Struct that represents a contiguous block holding the buffers followed by the
+     *              hash buffer.
+     */
+    struct arena
+    {
+        /** The buffers. */
+        buffer* bufs_ = nullptr;
+        
+        /** The number of buffers. */
+        std::size_t sz_ = 0;
+        
+        /** The hash buffer. */
+        hash_buffer* hbuf_ = nullptr;
+        
+        /** The hash buffer size. */
+        std::size_t hbuf_sz_ = 0;
+        
+        /** The number of buffer sized slots allocated. */
+        std::size_t n_slts_ = 0;
+    };
+    
+    /**
+     * @brief       Allocate an arena and construct its buffers and its hash buffer. The hash
+     *              buffer is placed after the buffers, whose alignment is at least the one of a
+     *              pointer.
+     * @param       sz : The number of buffers.
+     * @return      The arena.
+     */
+    arena allocate_arena(std::size_t sz)
+    {
+        buffer_allocator_type buf_alloc(alloc_);
+        arena arna;
+        
+        arna.sz_ = sz;
+        arna.hbuf_sz_ = std::bit_ceil(sz * 2 > 0 ? sz * 2 : 1);
+        arna.n_slts_ = sz + (arna.hbuf_sz_ * sizeof(hash_buffer) + sizeof(buffer) - 1) /
+                sizeof(buffer);
+        arna.bufs_ = buffer_allocator_traits::allocate(buf_alloc, arna.n_slts_);
+        
+        try
+        {
+            std::uninitialized_default_construct_n(arna.bufs_, sz);
+        }
+        catch (...)
+        {
+            buffer_allocator_traits::deallocate(buf_alloc, arna.bufs_, arna.n_slts_);
+            throw;
+        }
+        
+        arna.hbuf_ = reinterpret_cast<hash_buffer*>(arna.bufs_ + sz);
+        std::uninitialized_default_construct_n(arna.hbuf_, arna.hbuf_sz_);
+        
+        return arna;
+    }
+    
+    /**
+     * @brief       Destroy the elements and the buffers of an arena and deallocate it.
+     * @param       arna : The arena.
+     */
+    void deallocate_arena(arena& arna) noexcept
+    {
+        buffer_allocator_type buf_alloc(alloc_);
+        
+        base_type::destroy_elements(arna.bufs_, arna.sz_);
+        std::destroy_n(arna.bufs_, arna.sz_);
+        buffer_allocator_traits::deallocate(buf_alloc, arna.bufs_, arna.n_slts_);
+        arna = arena();
+    }
+    
+    /**
+     * @brief       Move the element of a buffer of another arena into a free buffer and link it
+     *              in the hash buffer. The moved-from element is destroyed with its arena.
+     * @param       src : The buffer to move.
+     * @return      An iterator to the moved element.
+     */
+    typename base_type::iterator move_buffer(buffer* src)
+    {
+        buffer* const buf = base_type::get_least_recently_used_buffer();
+        
+        base_type::construct_element(buf, std::move(src->get_key()), std::move(src->get_value()));
+        buf->hsh_ = src->hsh_;
+        
+        base_type::insert_in_hash_buffer_list(buf);
+        base_type::plcy_.on_insert(buf, buf->hsh_);
+        
+        return typename base_type::iterator(
+                arna_.hbuf_, arna_.hbuf_sz_, base_type::get_hash_buffer_index(buf->hsh_), buf);
+    }
+    
+private:
+    /** The allocator. */
+    allocator_type alloc_;
+    
+    /** The arena. */
+    arena arna_;
+};
+
+}
+
+#endif
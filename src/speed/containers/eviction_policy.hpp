@@ -0,0 +1,75 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       eviction_policy.hpp
+ * @brief      eviction_policy concept header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_EVICTION_POLICY_HPP
+#define SPEED_CONTAINERS_EVICTION_POLICY_HPP
+
+#include <concepts>
+#include <cstddef>
+
+namespace speed::containers {
+
+/**
+ * @brief       Concept that represents the policy that decides which node of a cache is
+ *              recycled. The cache owns the nodes and the policy only orders the nodes that are
+ *              available, that is the ones that aren't locked. Every node embeds a public member
+ *              named plcy_hk_ of type PolicyT::hook_type in which the policy keeps its per-node
+ *              state. The policy is notified through the following members:
+ *              - initialize(nds, n) : The n nodes starting at nds are free and available. This
+ *                is the only place where the policy may allocate memory.
+ *              - get_victim() : Get the node to recycle, or nullptr if there is none. Free nodes
+ *                are returned first. It may update the policy state, but calling it again
+ *                without any other notification in between returns the same node.
+ *              - on_insert(nd, hsh) : The node returned by get_victim() now holds the key whose
+ *                hash is hsh.
+ *              - on_hit(nd) : An available node has been found. When CONCURRENT_HITS is true
+ *                this may be called by several readers at once.
+ *              - on_lock(nd) : An available node has been locked and can't be recycled.
+ *              - on_unlock(nd) : A locked node has been unlocked.
+ *              - on_erase(nd) : An available node no longer holds a key. It has to be returned
+ *                by get_victim() before the nodes that still hold one.
+ *              - for_each_in_eviction_order(fnc) : Call fnc on every available node, roughly in
+ *                the order in which they would be recycled, without modifying the policy.
+ */
+template<typename PolicyT, typename NodeT>
+concept eviction_policy = requires(PolicyT plcy, const PolicyT& c_plcy, NodeT* nd, std::size_t n,
+                                   std::size_t hsh, void (*fnc)(NodeT*))
+{
+    typename PolicyT::hook_type;
+    { PolicyT::CONCURRENT_HITS } -> std::convertible_to<bool>;
+    plcy.initialize(nd, n);
+    { plcy.get_victim() } -> std::same_as<NodeT*>;
+    plcy.on_insert(nd, hsh);
+    plcy.on_hit(nd);
+    plcy.on_lock(nd);
+    plcy.on_unlock(nd);
+    plcy.on_erase(nd);
+    c_plcy.for_each_in_eviction_order(fnc);
+};
+
+}
+
+#endif
@@ -0,0 +1,286 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       expiring_static_cache.hpp
+ * @brief      expiring_static_cache class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_EXPIRING_STATIC_CACHE_HPP
+#define SPEED_CONTAINERS_EXPIRING_STATIC_CACHE_HPP
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include "../time/monotonic_clock.hpp"
+#include "cache_base.hpp"
+#include "detail/timer_wheel.hpp"
+#include "lru_eviction_policy.hpp"
+#include "no_statistics_policy.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a generic static cache whose elements can expire. Every
+ *              element can be given a time to live, its deadline is taken from the monotonic
+ *              time of ClockT, which has to provide a static get_nseconds() function. An expired
+ *              element is dropped lazily when it is looked up, and the deadlines are kept in a
+ *              hierarchical timer wheel so purge_expired() only visits the elements that have
+ *              expired. A dropped element leaves a free buffer that is recycled before any
+ *              other. Locked elements never expire while they are locked.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        std::size_t SIZE,
+        typename HashT = std::hash<KeyT>,
+        typename PredT = std::equal_to<KeyT>,
+        template<typename> class EvictionPolicyT = lru_eviction_policy,
+        typename ClockT = time::monotonic_clock,
+        typename StatisticsT = no_statistics_policy
+>
+class expiring_static_cache
+        : public cache_base<
+                expiring_static_cache<
+                        KeyT, ValueT, SIZE, HashT, PredT, EvictionPolicyT, ClockT, StatisticsT>,
+                KeyT,
+                ValueT,
+                HashT,
+                PredT,
+                EvictionPolicyT,
+                StatisticsT
+        >
+{
+public:
+    /** The base class. */
+    using base_type = cache_base<
+            expiring_static_cache, KeyT, ValueT, HashT, PredT, EvictionPolicyT, StatisticsT>;
+    
+    /** The clock type. */
+    using clock_type = ClockT;
+    
+    /** The buffer type. */
+    using typename base_type::buffer;
+    
+    /** The hash buffer type. */
+    using typename base_type::hash_buffer;
+    
+    /** The iterator type. */
+    using typename base_type::iterator;
+    
+    /** The number of lists in the hash buffer, a power of two so it can be indexed by mask. */
+    static constexpr std::size_t HASH_BUFFER_SIZE = std::bit_ceil(SIZE * 2);
+    
+    /** The deadline of the elements that never expire. */
+    static constexpr std::uint64_t NO_DEADLINE = std::numeric_limits<std::uint64_t>::max();
+    
+    /**
+     * @brief       Default constructor.
+     */
+    expiring_static_cache() noexcept(noexcept(
+            std::declval<typename base_type::policy_type&>().initialize(nullptr, SIZE)))
+    {
+        base_type::initialize(buffers_, SIZE);
+    }
+    
+    /** @cond */
+    expiring_static_cache(const expiring_static_cache& rhs) = delete;
+    
+    expiring_static_cache(expiring_static_cache&& rhs) = delete;
+    
+    expiring_static_cache& operator =(const expiring_static_cache& rhs) = delete;
+    
+    expiring_static_cache& operator =(expiring_static_cache&& rhs) = delete;
+    /** @endcond */
+    
+    /**
+     * @brief       Destructor.
+     */
+    ~expiring_static_cache()
+    {
+        base_type::destroy_elements(buffers_, SIZE);
+    }
+    
+    using base_type::insert;
+    
+    using base_type::insert_and_lock;
+    
+    /**
+     * @brief       Insert a key value pair in the container that expires after a time to live.
+     * @param       ky : The key.
+     * @param       val : The value.
+     * @param       ttl : The time to live in nanoseconds.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename KeyT_, typename ValueT_>
+    iterator insert(KeyT_&& ky, ValueT_&& val, std::uint64_t ttl)
+    {
+        iterator it = base_type::insert(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+        set_deadline(base_type::get_buffer(it), ttl);
+        
+        return it;
+    }
+    
+    /**
+     * @brief       Insert a key value pair in the container that expires after a time to live and
+     *              erase it from the available list. It won't expire until it is unlocked.
+     * @param       ky : The key.
+     * @param       val : The value.
+     * @param       ttl : The time to live in nanoseconds.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename KeyT_, typename ValueT_>
+    iterator insert_and_lock(KeyT_&& ky, ValueT_&& val, std::uint64_t ttl)
+    {
+        iterator it = insert(std::forward<KeyT_>(ky), std::forward<ValueT_>(val), ttl);
+        base_type::lock(it);
+        
+        return it;
+    }
+    
+    /**
+     * @brief       Drop the elements that have expired. The deadlines are checked with the
+     *              resolution of the timer wheel ticks, so an element may be dropped up to one
+     *              tick after its deadline, while lookups always use the exact deadline.
+     * @return      The number of elements dropped.
+     */
+    std::size_t purge_expired() noexcept
+    {
+        using wheel_type = detail::timer_wheel<expiry_entry>;
+        
+        std::size_t n_purgd = 0;
+        
+        whl_.advance(clock_type::get_nseconds() >> wheel_type::TICK_BITS,
+                     [&](expiry_entry* ent) noexcept
+        {
+            buffer* const buf = &buffers_[ent - ents_];
+            
+            if (!buf->flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+            {
+                return false;
+            }
+            
+            base_type::release_buffer(buf);
+            ++n_purgd;
+            
+            return true;
+        });
+        
+        return n_purgd;
+    }
+
+protected:
+    /**
+     * @brief       Struct that represents the expiration state of a buffer.
+     */
+    struct expiry_entry : detail::timer_link
+    {
+        /** The deadline in nanoseconds, NO_DEADLINE if the buffer never expires. */
+        std::uint64_t ddln_ = NO_DEADLINE;
+    };
+    
+    /**
+     * @brief       Get the hash buffer.
+     * @return      The hash buffer.
+     */
+    [[nodiscard]] hash_buffer* get_hash_buffer() const noexcept
+    {
+        return const_cast<hash_buffer*>(hbuf_);
+    }
+    
+    /**
+     * @brief       Get the hash buffer size.
+     * @return      The hash buffer size.
+     */
+    [[nodiscard]] static constexpr std::size_t get_hash_buffer_size() noexcept
+    {
+        return HASH_BUFFER_SIZE;
+    }
+    
+    /**
+     * @brief       Check whether the key of an available buffer has expired.
+     * @param       buf : The buffer to check.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_buffer_expired(const buffer* buf) const noexcept
+    {
+        const std::uint64_t ddln = ents_[buf - buffers_].ddln_;
+        
+        return ddln != NO_DEADLINE && ddln <= clock_type::get_nseconds();
+    }
+    
+    /**
+     * @brief       Notify that a buffer has been erased from the hash buffer.
+     * @param       buf : The buffer erased.
+     */
+    void on_buffer_erased(buffer* buf) noexcept
+    {
+        expiry_entry* const ent = &ents_[buf - buffers_];
+        
+        if (whl_.is_scheduled(ent))
+        {
+            whl_.cancel(ent);
+        }
+        
+        ent->ddln_ = NO_DEADLINE;
+    }
+    
+    /**
+     * @brief       Set the deadline of a buffer that has just been inserted.
+     * @param       buf : The buffer.
+     * @param       ttl : The time to live in nanoseconds.
+     */
+    void set_deadline(buffer* buf, std::uint64_t ttl) noexcept
+    {
+        using wheel_type = detail::timer_wheel<expiry_entry>;
+        
+        expiry_entry* const ent = &ents_[buf - buffers_];
+        const std::uint64_t now = clock_type::get_nseconds();
+        
+        if (ttl < NO_DEADLINE - now)
+        {
+            ent->ddln_ = now + ttl;
+            whl_.schedule(ent, now >> wheel_type::TICK_BITS);
+        }
+    }
+    
+    friend base_type;
+    
+private:
+    /** All the buffers. */
+    buffer buffers_[SIZE];
+    
+    /** The hash buffer. */
+    hash_buffer hbuf_[HASH_BUFFER_SIZE];
+    
+    /** The expiration state of every buffer, indexed as the buffers. */
+    expiry_entry ents_[SIZE];
+    
+    /** The timer wheel in which the buffers that can expire are scheduled. */
+    detail::timer_wheel<expiry_entry> whl_;
+};
+
+}
+
+#endif
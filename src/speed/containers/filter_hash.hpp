@@ -0,0 +1,84 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       filter_hash.hpp
+ * @brief      filter_hash struct header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_FILTER_HASH_HPP
+#define SPEED_CONTAINERS_FILTER_HASH_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../cryptography/city_hash.hpp"
+#include "flat_hash.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Struct that represents the default hash of the probabilistic filters. The filters
+ *              take several independent indexes and fingerprints from the 64 bits of the hash, so
+ *              unlike std::hash it computes the city-hash of the bytes of the key, which must
+ *              have a unique object representation.
+ */
+template<typename KeyT>
+struct filter_hash
+{
+    static_assert(std::has_unique_object_representations_v<KeyT>,
+                  "The key must have a unique object representation, or provide a hash.");
+
+    /**
+     * @brief       Get the hash of a key.
+     * @param       ky : The key.
+     * @return      The hash of the key.
+     */
+    std::uint64_t operator ()(const KeyT& ky) const
+    {
+        return cryptography::city_hash_64(&ky, sizeof(KeyT));
+    }
+};
+
+/**
+ * @brief       Struct that represents the default hash of the probabilistic filters for strings.
+ */
+template<typename CharT, typename CharTraitsT, typename AllocatorT>
+struct filter_hash<std::basic_string<CharT, CharTraitsT, AllocatorT>>
+        : public flat_string_hash<CharT, CharTraitsT>
+{
+};
+
+/**
+ * @brief       Struct that represents the default hash of the probabilistic filters for string
+ *              views.
+ */
+template<typename CharT, typename CharTraitsT>
+struct filter_hash<std::basic_string_view<CharT, CharTraitsT>>
+        : public flat_string_hash<CharT, CharTraitsT>
+{
+};
+
+}
+
+#endif
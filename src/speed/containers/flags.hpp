@@ -63,6 +63,9 @@ public:
     
         /** The node iteration type. */
         using node_type = std::uint8_t;
+    
+        using base_type::operator ++;
+        using base_type::operator --;
         
         /**
          * @brief       Constructor with parameters.
@@ -93,7 +96,7 @@ public:
          * @brief       Move to the forward node.
          * @return      A reference to an iterator pointing the current node.
          */
-        self_type& operator ++() override
+        self_type& operator ++()
         {
             do
             {
@@ -114,7 +117,7 @@ public:
          * @brief       Move to the backward node.
          * @return      A reference to an iterator pointing the current node.
          */
-        self_type& operator --() override
+        self_type& operator --()
         {
             do
             {
@@ -136,7 +139,7 @@ public:
          * @param       rhs : The value to compare.
          * @return      If function was successful true is returned, otherwise false is returned.
          */
-        bool operator ==(const self_type& rhs) const noexcept override
+        bool operator ==(const self_type& rhs) const noexcept
         {
             return cur_ == rhs.cur_ && las_ == rhs.las_ && val_ == rhs.val_;
         }
@@ -145,7 +148,7 @@ public:
          * @brief       Allows knowing whether the iterator is past-the-end or not.
          * @return      If function was successful true is returned, otherwise false is returned.
          */
-        bool end() const noexcept override
+        bool end() const noexcept
         {
             return val_ == nullptr;
         }
@@ -154,17 +157,28 @@ public:
          * @brief       Get the reference of the iterator current node.
          * @return      The reference of the iterator current node.
          */
-        const value_type& operator *() const override
+        const value_type& operator *() const
         {
             aux_val_ = static_cast<value_type>(static_cast<underlying_type>(*val_) & (1u << cur_));
             return aux_val_;
         }
     
+        /**
+         * @brief       Get the value of the node n times forward. The value is returned by copy
+         *              since the iterators produce it on the fly.
+         * @param       n : The number of times to move.
+         * @return      The value of the resulting node.
+         */
+        value_type operator [](std::size_t n) const
+        {
+            return *(*this + n);
+        }
+    
         /**
          * @brief       Get the address of the iterator current node.
          * @return      The address of the iterator current node.
          */
-        const value_type* operator ->() const override
+        const value_type* operator ->() const
         {
             throw bad_iteration_exception();
         }
@@ -211,6 +225,9 @@ public:
         /** The node iteration type. */
         using node_type = std::uint8_t;
     
+        using base_type::operator ++;
+        using base_type::operator --;
+    
         /**
          * @brief       Constructor with parameters.
          * @param       val : The value encapsulated by the iterator.
@@ -224,7 +241,7 @@ public:
          * @brief       Move to the forward node.
          * @return      A reference to an iterator pointing the current node.
          */
-        self_type& operator ++() noexcept override
+        self_type& operator ++() noexcept
         {
             const_self_type::operator ++();
             return *this;
@@ -234,7 +251,7 @@ public:
          * @brief       Move to the backward node.
          * @return      A reference to an iterator pointing the current node.
          */
-        self_type& operator --() noexcept override
+        self_type& operator --() noexcept
         {
             const_self_type::operator --();
             return *this;
@@ -245,7 +262,7 @@ public:
          * @param       rhs : The value to compare.
          * @return      If function was successful true is returned, otherwise false is returned.
          */
-        bool operator ==(const self_type& rhs) const noexcept override
+        bool operator ==(const self_type& rhs) const noexcept
         {
             return const_self_type::operator ==(rhs);
         }
@@ -254,7 +271,7 @@ public:
          * @brief       Allows knowing whether the iterator is past-the-end or not.
          * @return      If function was successful true is returned, otherwise false is returned.
          */
-        bool end() const noexcept override
+        bool end() const noexcept
         {
             return const_self_type::end();
         }
@@ -263,16 +280,27 @@ public:
          * @brief       Get the reference of the iterator current node.
          * @return      The reference of the iterator current node.
          */
-        value_type& operator *() noexcept override
+        value_type& operator *() noexcept
         {
             return const_cast<value_type&>(const_self_type::operator*());
         }
     
+        /**
+         * @brief       Get the value of the node n times forward. The value is returned by copy
+         *              since the iterators produce it on the fly.
+         * @param       n : The number of times to move.
+         * @return      The value of the resulting node.
+         */
+        value_type operator [](std::size_t n) const
+        {
+            return const_self_type::operator [](n);
+        }
+    
         /**
          * @brief       Get the address of the iterator current node.
          * @return      The address of the iterator current node.
          */
-        value_type* operator ->() noexcept override
+        value_type* operator ->() noexcept
         {
             return const_cast<value_type*>(const_self_type::operator->());
         }
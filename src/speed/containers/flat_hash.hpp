@@ -0,0 +1,102 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       flat_hash.hpp
+ * @brief      flat_hash struct header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_FLAT_HASH_HPP
+#define SPEED_CONTAINERS_FLAT_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "../cryptography/city_hash.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Struct that represents the default hash of the flat hash containers. It forwards
+ *              to std::hash, the containers mix the result so identity hashes are fine.
+ */
+template<typename KeyT>
+struct flat_hash
+{
+    /**
+     * @brief       Get the hash of a key.
+     * @param       ky : The key.
+     * @return      The hash of the key.
+     */
+    std::size_t operator ()(const KeyT& ky) const noexcept(noexcept(std::hash<KeyT>()(ky)))
+    {
+        return std::hash<KeyT>()(ky);
+    }
+};
+
+/**
+ * @brief       Struct that represents the default hash of the flat hash containers and of the
+ *              probabilistic filters for strings. It computes the 64-bit city-hash of the
+ *              characters and accepts any string that converts to a string view, so the lookups
+ *              don't need to build a key.
+ */
+template<typename CharT, typename CharTraitsT>
+struct flat_string_hash
+{
+    /** Enables the heterogeneous lookups. */
+    using is_transparent = void;
+
+    /**
+     * @brief       Get the hash of a string.
+     * @param       str : The string.
+     * @return      The hash of the string.
+     */
+    std::uint64_t operator ()(std::basic_string_view<CharT, CharTraitsT> str) const
+    {
+        return cryptography::city_hash_64(str.data(), str.size() * sizeof(CharT));
+    }
+};
+
+/**
+ * @brief       Struct that represents the default hash of the flat hash containers for strings.
+ */
+template<typename CharT, typename CharTraitsT, typename AllocatorT>
+struct flat_hash<std::basic_string<CharT, CharTraitsT, AllocatorT>>
+        : public flat_string_hash<CharT, CharTraitsT>
+{
+};
+
+/**
+ * @brief       Struct that represents the default hash of the flat hash containers for string
+ *              views.
+ */
+template<typename CharT, typename CharTraitsT>
+struct flat_hash<std::basic_string_view<CharT, CharTraitsT>>
+        : public flat_string_hash<CharT, CharTraitsT>
+{
+};
+
+}
+
+#endif
@@ -0,0 +1,244 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       flat_hash_map.hpp
+ * @brief      flat_hash_map class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_FLAT_HASH_MAP_HPP
+#define SPEED_CONTAINERS_FLAT_HASH_MAP_HPP
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "detail/flat_hash_table.hpp"
+#include "exception.hpp"
+#include "flat_hash.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Struct that tells the flat hash table how to handle the elements of a map.
+ */
+template<typename KeyT, typename ValueT>
+struct flat_hash_map_policy
+{
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The value type. */
+    using value_type = std::pair<const KeyT, ValueT>;
+
+    /** Whether the iterators give mutable access to the elements. */
+    static constexpr bool MUTABLE = true;
+
+    /** Whether moving an element into another slot never throws. */
+    static constexpr bool NOTHROW_TRANSFER = std::is_nothrow_move_constructible_v<KeyT> &&
+            std::is_nothrow_move_constructible_v<ValueT>;
+
+    /**
+     * @brief       Get the key of an element.
+     * @param       val : The element.
+     * @return      The key of the element.
+     */
+    static const key_type& get_key(const value_type& val) noexcept
+    {
+        return val.first;
+    }
+
+    /**
+     * @brief       Move an element into an uninitialized slot. The key is moved too, which is
+     *              fine since the source is destroyed right after.
+     * @param       alloc : The slot allocator.
+     * @param       dest : The slot.
+     * @param       src : The element to move.
+     */
+    template<typename AllocatorT_>
+    static void transfer(AllocatorT_& alloc, value_type* dest, value_type* src)
+    {
+        std::allocator_traits<AllocatorT_>::construct(
+                alloc, dest, std::move(const_cast<key_type&>(src->first)),
+                std::move(src->second));
+    }
+};
+
+/**
+ * @brief       Class that represents a hash map that stores its elements in a flat array of slots,
+ *              in the manner of the swiss tables. It offers the interface of std::unordered_map
+ *              besides the buckets. The keys can be looked up with any type accepted by the hash
+ *              and the predicate when both are transparent, which is the case by default for the
+ *              strings. Inserting an element can move the other ones, so the references and the
+ *              iterators are invalidated when the map grows.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        typename HashT = flat_hash<KeyT>,
+        typename PredT = std::equal_to<>,
+        typename AllocatorT = std::allocator<std::pair<const KeyT, ValueT>>
+>
+class flat_hash_map
+        : public detail::flat_hash_table<
+                flat_hash_map_policy<KeyT, ValueT>, HashT, PredT, AllocatorT>
+{
+public:
+    /** The base class. */
+    using base_type = detail::flat_hash_table<
+            flat_hash_map_policy<KeyT, ValueT>, HashT, PredT, AllocatorT>;
+
+    /** The key type. */
+    using typename base_type::key_type;
+
+    /** The mapped type. */
+    using mapped_type = ValueT;
+
+    /** The value type. */
+    using typename base_type::value_type;
+
+    /** The iterator type. */
+    using typename base_type::iterator;
+
+    /** The const iterator type. */
+    using typename base_type::const_iterator;
+
+    using base_type::base_type;
+
+    /**
+     * @brief       Construct an element if its key isn't in the map. When the arguments are a key
+     *              and a value the key is looked up first, so nothing is built if it is there.
+     * @param       args : The arguments to construct the element.
+     * @return      An iterator to the element with the key and whether the insertion took place.
+     */
+    template<typename... Ts_>
+    std::pair<iterator, bool> emplace(Ts_&&... args)
+    {
+        if constexpr (sizeof...(Ts_) == 2 && std::is_same_v<
+                std::remove_cvref_t<std::tuple_element_t<0, std::tuple<Ts_...>>>, key_type>)
+        {
+            return try_emplace(std::forward<Ts_>(args)...);
+        }
+        else
+        {
+            return base_type::emplace(std::forward<Ts_>(args)...);
+        }
+    }
+
+    /**
+     * @brief       Construct an element from a key and some arguments if the key isn't in the map.
+     * @param       ky : The key.
+     * @param       args : The arguments to construct the mapped value.
+     * @return      An iterator to the element with the key and whether the insertion took place.
+     */
+    template<typename KeyT_, typename... Ts_>
+    requires std::is_same_v<std::remove_cvref_t<KeyT_>, key_type>
+    std::pair<iterator, bool> try_emplace(KeyT_&& ky, Ts_&&... args)
+    {
+        return base_type::emplace_key(
+                ky, std::piecewise_construct, std::forward_as_tuple(std::forward<KeyT_>(ky)),
+                std::forward_as_tuple(std::forward<Ts_>(args)...));
+    }
+
+    /**
+     * @brief       Insert an element or assign the mapped value if the key is in the map.
+     * @param       ky : The key.
+     * @param       val : The mapped value.
+     * @return      An iterator to the element with the key and whether the insertion took place.
+     */
+    template<typename KeyT_, typename ValueT_>
+    requires std::is_same_v<std::remove_cvref_t<KeyT_>, key_type>
+    std::pair<iterator, bool> insert_or_assign(KeyT_&& ky, ValueT_&& val)
+    {
+        auto res = try_emplace(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+
+        if (!res.second)
+        {
+            res.first->second = std::forward<ValueT_>(val);
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key, inserting a default one if it is missing.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     */
+    mapped_type& operator [](const key_type& ky)
+    {
+        return try_emplace(ky).first->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key, inserting a default one if it is missing.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     */
+    mapped_type& operator [](key_type&& ky)
+    {
+        return try_emplace(std::move(ky)).first->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key.
+     * @param       ky : The key, or a key comparable with it when the hash is transparent.
+     * @return      The mapped value of the key.
+     * @throw       out_of_range_exception : If the key isn't in the map.
+     */
+    template<typename KeyT_ = key_type>
+    mapped_type& at(const KeyT_& ky)
+    {
+        auto it = base_type::find(ky);
+
+        if (it.end())
+        {
+            throw out_of_range_exception();
+        }
+
+        return it->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key.
+     * @param       ky : The key, or a key comparable with it when the hash is transparent.
+     * @return      The mapped value of the key.
+     * @throw       out_of_range_exception : If the key isn't in the map.
+     */
+    template<typename KeyT_ = key_type>
+    const mapped_type& at(const KeyT_& ky) const
+    {
+        auto it = base_type::find(ky);
+
+        if (it.end())
+        {
+            throw out_of_range_exception();
+        }
+
+        return it->second;
+    }
+};
+
+}
+
+#endif
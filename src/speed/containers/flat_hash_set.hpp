@@ -0,0 +1,140 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       flat_hash_set.hpp
+ * @brief      flat_hash_set class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_FLAT_HASH_SET_HPP
+#define SPEED_CONTAINERS_FLAT_HASH_SET_HPP
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "detail/flat_hash_table.hpp"
+#include "flat_hash.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Struct that tells the flat hash table how to handle the elements of a set.
+ */
+template<typename KeyT>
+struct flat_hash_set_policy
+{
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The value type. */
+    using value_type = KeyT;
+
+    /** Whether the iterators give mutable access to the elements. */
+    static constexpr bool MUTABLE = false;
+
+    /** Whether moving an element into another slot never throws. */
+    static constexpr bool NOTHROW_TRANSFER = std::is_nothrow_move_constructible_v<KeyT>;
+
+    /**
+     * @brief       Get the key of an element.
+     * @param       val : The element.
+     * @return      The key of the element.
+     */
+    static const key_type& get_key(const value_type& val) noexcept
+    {
+        return val;
+    }
+
+    /**
+     * @brief       Move an element into an uninitialized slot.
+     * @param       alloc : The slot allocator.
+     * @param       dest : The slot.
+     * @param       src : The element to move.
+     */
+    template<typename AllocatorT_>
+    static void transfer(AllocatorT_& alloc, value_type* dest, value_type* src)
+    {
+        std::allocator_traits<AllocatorT_>::construct(alloc, dest, std::move(*src));
+    }
+};
+
+/**
+ * @brief       Class that represents a hash set that stores its elements in a flat array of slots,
+ *              in the manner of the swiss tables. It offers the interface of std::unordered_set
+ *              besides the buckets. The keys can be looked up with any type accepted by the hash
+ *              and the predicate when both are transparent, which is the case by default for the
+ *              strings. Inserting an element can move the other ones, so the references and the
+ *              iterators are invalidated when the set grows.
+ */
+template<
+        typename KeyT,
+        typename HashT = flat_hash<KeyT>,
+        typename PredT = std::equal_to<>,
+        typename AllocatorT = std::allocator<KeyT>
+>
+class flat_hash_set
+        : public detail::flat_hash_table<flat_hash_set_policy<KeyT>, HashT, PredT, AllocatorT>
+{
+public:
+    /** The base class. */
+    using base_type = detail::flat_hash_table<
+            flat_hash_set_policy<KeyT>, HashT, PredT, AllocatorT>;
+
+    /** The key type. */
+    using typename base_type::key_type;
+
+    /** The value type. */
+    using typename base_type::value_type;
+
+    /** The iterator type. */
+    using typename base_type::iterator;
+
+    /** The const iterator type. */
+    using typename base_type::const_iterator;
+
+    using base_type::base_type;
+
+    /**
+     * @brief       Construct an element if it isn't in the set. When the argument is a key it is
+     *              looked up first, so nothing is built if it is there.
+     * @param       args : The arguments to construct the element.
+     * @return      An iterator to the element and whether the insertion took place.
+     */
+    template<typename... Ts_>
+    std::pair<iterator, bool> emplace(Ts_&&... args)
+    {
+        if constexpr (sizeof...(Ts_) == 1 &&
+                      (std::is_same_v<std::remove_cvref_t<Ts_>, key_type> && ...))
+        {
+            return base_type::emplace_key(args..., std::forward<Ts_>(args)...);
+        }
+        else
+        {
+            return base_type::emplace(std::forward<Ts_>(args)...);
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,660 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       flat_map.hpp
+ * @brief      flat_map class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_FLAT_MAP_HPP
+#define SPEED_CONTAINERS_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "exception.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents an ordered map that keeps its elements sorted by key in a
+ *              single vector. Lookups are binary searches over contiguous memory and iterating is
+ *              walking an array, which makes it the fastest ordered map for data that is mostly
+ *              read. Inserting or erasing an element moves the elements that follow it, so the
+ *              elements should be inserted in bulk with insert_range, which sorts the new ones and
+ *              merges them once. Inserting or erasing invalidates the iterators. The keys of the
+ *              elements must not be modified through the iterators.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        typename CompareT = std::less<KeyT>,
+        typename AllocatorT = std::allocator<std::pair<KeyT, ValueT>>
+>
+class flat_map
+{
+public:
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The mapped type. */
+    using mapped_type = ValueT;
+
+    /** The value type. */
+    using value_type = std::pair<key_type, mapped_type>;
+
+    /** The key comparison type. */
+    using key_compare = CompareT;
+
+    /** The allocator type. */
+    using allocator_type = typename std::allocator_traits<AllocatorT>::template rebind_alloc<
+            value_type>;
+
+    /** The container that holds the elements. */
+    using container_type = std::vector<value_type, allocator_type>;
+
+    /** The size type. */
+    using size_type = std::size_t;
+
+    /** The iterator type. */
+    using iterator = typename container_type::iterator;
+
+    /** The const iterator type. */
+    using const_iterator = typename container_type::const_iterator;
+
+    /** The reverse iterator type. */
+    using reverse_iterator = typename container_type::reverse_iterator;
+
+    /** The const reverse iterator type. */
+    using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+    /**
+     * @brief       Default constructor.
+     */
+    flat_map() = default;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       comp : The key comparison function.
+     * @param       alloc : The allocator.
+     */
+    explicit flat_map(const key_compare& comp, const allocator_type& alloc = allocator_type())
+            : elems_(alloc)
+            , comp_(comp)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       alloc : The allocator.
+     */
+    explicit flat_map(const allocator_type& alloc)
+            : elems_(alloc)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters. When a key appears several times, the first
+     *              element with it is kept.
+     * @param       first : The first element of the range to copy.
+     * @param       last : The end of the range to copy.
+     * @param       comp : The key comparison function.
+     * @param       alloc : The allocator.
+     */
+    template<std::input_iterator InputIteratorT_>
+    flat_map(
+            InputIteratorT_ first,
+            InputIteratorT_ last,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : elems_(alloc)
+            , comp_(comp)
+    {
+        insert_range(first, last);
+    }
+
+    /**
+     * @brief       Constructor with parameters. When a key appears several times, the first
+     *              element with it is kept.
+     * @param       il : The elements to copy.
+     * @param       comp : The key comparison function.
+     * @param       alloc : The allocator.
+     */
+    flat_map(
+            std::initializer_list<value_type> il,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type()
+    )
+            : elems_(alloc)
+            , comp_(comp)
+    {
+        insert_range(il.begin(), il.end());
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    iterator begin() noexcept
+    {
+        return elems_.begin();
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    const_iterator begin() const noexcept
+    {
+        return elems_.begin();
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return elems_.cbegin();
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    iterator end() noexcept
+    {
+        return elems_.end();
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator end() const noexcept
+    {
+        return elems_.end();
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator cend() const noexcept
+    {
+        return elems_.cend();
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the last element.
+     * @return      A reverse iterator to the last element.
+     */
+    reverse_iterator rbegin() noexcept
+    {
+        return elems_.rbegin();
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the last element.
+     * @return      A reverse iterator to the last element.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return elems_.rbegin();
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the reverse end.
+     * @return      A reverse iterator to the reverse end.
+     */
+    reverse_iterator rend() noexcept
+    {
+        return elems_.rend();
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the reverse end.
+     * @return      A reverse iterator to the reverse end.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return elems_.rend();
+    }
+
+    /**
+     * @brief       Allows knowing whether the map is empty.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return elems_.empty();
+    }
+
+    /**
+     * @brief       Get the number of elements.
+     * @return      The number of elements.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return elems_.size();
+    }
+
+    /**
+     * @brief       Get the number of elements that can be held without reallocating.
+     * @return      The number of elements that can be held without reallocating.
+     */
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return elems_.capacity();
+    }
+
+    /**
+     * @brief       Make room for a number of elements without reallocating.
+     * @param       n_elems : The number of elements.
+     */
+    void reserve(size_type n_elems)
+    {
+        elems_.reserve(n_elems);
+    }
+
+    /**
+     * @brief       Release the unused capacity.
+     */
+    void shrink_to_fit()
+    {
+        elems_.shrink_to_fit();
+    }
+
+    /**
+     * @brief       Erase all the elements.
+     */
+    void clear() noexcept
+    {
+        elems_.clear();
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is not less than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    iterator lower_bound(const KeyT_& ky)
+    {
+        return std::lower_bound(elems_.begin(), elems_.end(), ky, get_key_less());
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is not less than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    const_iterator lower_bound(const KeyT_& ky) const
+    {
+        return std::lower_bound(elems_.begin(), elems_.end(), ky, get_key_less());
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is greater than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    iterator upper_bound(const KeyT_& ky)
+    {
+        return std::upper_bound(elems_.begin(), elems_.end(), ky, get_key_greater());
+    }
+
+    /**
+     * @brief       Get an iterator to the first element whose key is greater than a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element, or the end iterator if there is none.
+     */
+    template<typename KeyT_ = key_type>
+    const_iterator upper_bound(const KeyT_& ky) const
+    {
+        return std::upper_bound(elems_.begin(), elems_.end(), ky, get_key_greater());
+    }
+
+    /**
+     * @brief       Find the element with a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element if it was found, otherwise the end iterator.
+     */
+    template<typename KeyT_ = key_type>
+    iterator find(const KeyT_& ky)
+    {
+        auto it = lower_bound(ky);
+
+        return it != elems_.end() && !comp_(ky, it->first) ? it : elems_.end();
+    }
+
+    /**
+     * @brief       Find the element with a key.
+     * @param       ky : The key.
+     * @return      An iterator to the element if it was found, otherwise the end iterator.
+     */
+    template<typename KeyT_ = key_type>
+    const_iterator find(const KeyT_& ky) const
+    {
+        auto it = lower_bound(ky);
+
+        return it != elems_.end() && !comp_(ky, it->first) ? it : elems_.end();
+    }
+
+    /**
+     * @brief       Allows knowing whether an element with a key is in the map.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename KeyT_ = key_type>
+    [[nodiscard]] bool contains(const KeyT_& ky) const
+    {
+        return find(ky) != elems_.end();
+    }
+
+    /**
+     * @brief       Count the elements with a key.
+     * @param       ky : The key.
+     * @return      The number of elements with the key, zero or one.
+     */
+    template<typename KeyT_ = key_type>
+    [[nodiscard]] size_type count(const KeyT_& ky) const
+    {
+        return contains(ky) ? 1 : 0;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     * @throw       out_of_range_exception : If the key isn't in the map.
+     */
+    template<typename KeyT_ = key_type>
+    mapped_type& at(const KeyT_& ky)
+    {
+        auto it = find(ky);
+
+        if (it == elems_.end())
+        {
+            throw out_of_range_exception();
+        }
+
+        return it->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     * @throw       out_of_range_exception : If the key isn't in the map.
+     */
+    template<typename KeyT_ = key_type>
+    const mapped_type& at(const KeyT_& ky) const
+    {
+        auto it = find(ky);
+
+        if (it == elems_.end())
+        {
+            throw out_of_range_exception();
+        }
+
+        return it->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key, inserting a default one if it is missing.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     */
+    mapped_type& operator [](const key_type& ky)
+    {
+        return try_emplace(ky).first->second;
+    }
+
+    /**
+     * @brief       Get the mapped value of a key, inserting a default one if it is missing.
+     * @param       ky : The key.
+     * @return      The mapped value of the key.
+     */
+    mapped_type& operator [](key_type&& ky)
+    {
+        return try_emplace(std::move(ky)).first->second;
+    }
+
+    /**
+     * @brief       Insert an element if its key isn't in the map.
+     * @param       val : The element.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    std::pair<iterator, bool> insert(const value_type& val)
+    {
+        return try_emplace(val.first, val.second);
+    }
+
+    /**
+     * @brief       Insert an element if its key isn't in the map.
+     * @param       val : The element.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    std::pair<iterator, bool> insert(value_type&& val)
+    {
+        return try_emplace(std::move(val.first), std::move(val.second));
+    }
+
+    /**
+     * @brief       Construct an element if its key isn't in the map. The element is constructed
+     *              before looking for its key.
+     * @param       args : The arguments to construct the element.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    template<typename... Ts_>
+    std::pair<iterator, bool> emplace(Ts_&&... args)
+    {
+        value_type val(std::forward<Ts_>(args)...);
+
+        return insert(std::move(val));
+    }
+
+    /**
+     * @brief       Construct an element with a key if the key isn't in the map. Nothing is
+     *              constructed if the key is found.
+     * @param       ky : The key.
+     * @param       args : The arguments to construct the mapped value.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    template<typename KeyT_, typename... Ts_>
+    std::pair<iterator, bool> try_emplace(KeyT_&& ky, Ts_&&... args)
+    {
+        auto it = lower_bound(ky);
+
+        if (it != elems_.end() && !comp_(ky, it->first))
+        {
+            return {it, false};
+        }
+
+        it = elems_.emplace(it, std::piecewise_construct,
+                            std::forward_as_tuple(std::forward<KeyT_>(ky)),
+                            std::forward_as_tuple(std::forward<Ts_>(args)...));
+
+        return {it, true};
+    }
+
+    /**
+     * @brief       Insert an element, or assign its mapped value if the key is in the map.
+     * @param       ky : The key.
+     * @param       val : The mapped value.
+     * @return      An iterator to the element with the key, and whether the element was inserted.
+     */
+    template<typename KeyT_, typename ValueT_>
+    std::pair<iterator, bool> insert_or_assign(KeyT_&& ky, ValueT_&& val)
+    {
+        auto res = try_emplace(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+
+        if (!res.second)
+        {
+            res.first->second = std::forward<ValueT_>(val);
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief       Insert the elements of a range whose keys aren't in the map. The elements are
+     *              appended, the appended ones are sorted, and both sorted runs are merged in a
+     *              single pass, so inserting n elements in a map of m costs O(n log n + m) instead
+     *              of the O(n m) of inserting them one by one. When a key appears several times,
+     *              the element already in the map, or else the first one in the range, is kept.
+     * @param       first : The first element of the range.
+     * @param       last : The end of the range.
+     */
+    template<std::input_iterator InputIteratorT_>
+    void insert_range(InputIteratorT_ first, InputIteratorT_ last)
+    {
+        const auto old_sz = static_cast<std::ptrdiff_t>(elems_.size());
+        auto key_less = [&](const value_type& lhs, const value_type& rhs)
+        {
+            return comp_(lhs.first, rhs.first);
+        };
+
+        elems_.insert(elems_.end(), first, last);
+
+        auto mid = elems_.begin() + old_sz;
+
+        std::stable_sort(mid, elems_.end(), key_less);
+        std::inplace_merge(elems_.begin(), mid, elems_.end(), key_less);
+
+        elems_.erase(std::unique(elems_.begin(), elems_.end(),
+                                 [&](const value_type& lhs, const value_type& rhs)
+                                 {
+                                     return !comp_(lhs.first, rhs.first);
+                                 }),
+                     elems_.end());
+    }
+
+    /**
+     * @brief       Insert the elements of a range whose keys aren't in the map.
+     * @param       rng : The range.
+     */
+    template<std::ranges::input_range RangeT_>
+    void insert_range(RangeT_&& rng)
+    {
+        insert_range(std::ranges::begin(rng), std::ranges::end(rng));
+    }
+
+    /**
+     * @brief       Erase an element.
+     * @param       pos : The element.
+     * @return      An iterator to the element that followed the erased one.
+     */
+    iterator erase(const_iterator pos)
+    {
+        return elems_.erase(pos);
+    }
+
+    /**
+     * @brief       Erase a range of elements.
+     * @param       first : The first element to erase.
+     * @param       last : The end of the range to erase.
+     * @return      An iterator to the element that followed the erased ones.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return elems_.erase(first, last);
+    }
+
+    /**
+     * @brief       Erase the element with a key.
+     * @param       ky : The key.
+     * @return      The number of erased elements.
+     */
+    size_type erase(const key_type& ky)
+    {
+        auto it = find(ky);
+
+        if (it == elems_.end())
+        {
+            return 0;
+        }
+
+        elems_.erase(it);
+
+        return 1;
+    }
+
+    /**
+     * @brief       Get the key comparison function.
+     * @return      The key comparison function.
+     */
+    [[nodiscard]] key_compare key_comp() const
+    {
+        return comp_;
+    }
+
+    /**
+     * @brief       Get the allocator.
+     * @return      The allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return elems_.get_allocator();
+    }
+
+private:
+    /**
+     * @brief       Get a function that tells whether the key of an element is less than a key.
+     * @return      The function.
+     */
+    [[nodiscard]] auto get_key_less() const noexcept
+    {
+        return [this](const value_type& val, const auto& ky) { return comp_(val.first, ky); };
+    }
+
+    /**
+     * @brief       Get a function that tells whether a key is less than the key of an element.
+     * @return      The function.
+     */
+    [[nodiscard]] auto get_key_greater() const noexcept
+    {
+        return [this](const auto& ky, const value_type& val) { return comp_(ky, val.first); };
+    }
+
+private:
+    /** The elements, sorted by key. */
+    container_type elems_;
+
+    /** The key comparison function. */
+    [[no_unique_address]] key_compare comp_;
+};
+
+}
+
+#endif
@@ -0,0 +1,921 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       flat_static_cache.hpp
+ * @brief      flat_static_cache class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_FLAT_STATIC_CACHE_HPP
+#define SPEED_CONTAINERS_FLAT_STATIC_CACHE_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+#include "exception.hpp"
+#include "flags.hpp"
+#include "iterator_base.hpp"
+#include "static_cache.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a generic static cache stored as a structure of arrays. The
+ *              keys live in a linear probing table, next to a separate array of 8-bit hash
+ *              fingerprints, and the values live in a dense array indexed by entry. The
+ *              least recently used order is kept in index-linked arrays instead of pointers. A
+ *              lookup scans the fingerprints eight at a time and only compares the keys whose
+ *              fingerprint matches, so it usually touches one or two cache lines. It offers the
+ *              same interface as static_cache.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        std::size_t SIZE,
+        typename HashT = std::hash<KeyT>,
+        typename PredT = std::equal_to<KeyT>
+>
+class flat_static_cache
+{
+public:
+    /** The key type. */
+    using key_type = KeyT;
+
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The hash type. */
+    using hash_type = HashT;
+
+    /** The predicate type. */
+    using pred_type = PredT;
+
+    /** The type used to index the entries. */
+    using index_type = std::uint32_t;
+
+    /** Class that represents flags container */
+    template<typename T>
+    using flags_type = flags<T>;
+
+    static_assert(SIZE > 0 && SIZE < std::numeric_limits<index_type>::max(),
+                  "the number of entries must fit in the index type");
+
+    /** The number of slots in the probing table, which keeps the load factor under one half. */
+    static constexpr std::size_t TABLE_SIZE = std::bit_ceil(SIZE * 2);
+
+    /**
+     * @brief       Struct that represents a slot of the probing table.
+     */
+    struct slot
+    {
+        /** The slot key. */
+        key_type ky_;
+
+        /** The entry that holds the value associated with the key. */
+        index_type ent_;
+    };
+
+    /**
+     * @brief       Struct that represents the metadata of an entry. It is kept apart from the
+     *              value, so the least recently used bookkeeping of a hit stays within a line.
+     */
+    struct entry
+    {
+        /** The next entry in the available list. */
+        index_type av_nxt_;
+
+        /** The previous entry in the available list. */
+        index_type av_prev_;
+
+        /** The slot that holds the entry key. */
+        index_type slt_idx_;
+
+        /** The entry flags. */
+        flags_type<scbf_t> flgs_;
+    };
+
+    /**
+     * @brief       Class that represents const iterators.
+     */
+    class const_iterator : public const_iterator_base<value_type, const_iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_iterator_base<value_type, const_iterator>;
+
+        /** The node iteration type. */
+        using node_type = std::size_t;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        const_iterator() noexcept = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       cache : The cache in which iterate.
+         * @param       cur_slot : The current slot index.
+         */
+        const_iterator(flat_static_cache* cache, std::size_t cur_slot) noexcept
+                : cache_(cache)
+                , cur_slot_(cur_slot)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++()
+        {
+            if (cur_slot_ < TABLE_SIZE)
+            {
+                do
+                {
+                    ++cur_slot_;
+
+                } while (cur_slot_ < TABLE_SIZE && cache_->fps_[cur_slot_] == 0);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --()
+        {
+            if (cur_slot_ < TABLE_SIZE)
+            {
+                do
+                {
+                    if (cur_slot_ == 0)
+                    {
+                        cur_slot_ = TABLE_SIZE;
+                        break;
+                    }
+
+                    --cur_slot_;
+
+                } while (cache_->fps_[cur_slot_] == 0);
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return cur_slot_ == rhs.cur_slot_;
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return cur_slot_ >= TABLE_SIZE;
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        const value_type& operator *() const
+        {
+            return cache_->vals_[cache_->slts_[cur_slot_].ent_];
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        const value_type* operator ->() const
+        {
+            return &cache_->vals_[cache_->slts_[cur_slot_].ent_];
+        }
+
+        template<
+                typename KeyT__,
+                typename ValueT__,
+                std::size_t SIZE__,
+                typename HashT__,
+                typename PredT__
+        >
+        friend class flat_static_cache;
+
+    protected:
+        /** The cache in which iterate. */
+        flat_static_cache* cache_ = nullptr;
+
+        /** The current slot index. */
+        std::size_t cur_slot_ = TABLE_SIZE;
+    };
+
+    /**
+     * @brief       Class that represents iterators.
+     */
+    class iterator : public const_mutable_iterator_base<value_type, const_iterator, iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = iterator;
+
+        /** The const iterator base. */
+        using const_self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_mutable_iterator_base<value_type, const_iterator, iterator>;
+
+        /** The node iteration type. */
+        using node_type = std::size_t;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        iterator() = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       cache : The cache in which iterate.
+         * @param       cur_slot : The current slot index.
+         */
+        iterator(flat_static_cache* cache, std::size_t cur_slot) noexcept
+                : base_type(cache, cur_slot)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++()
+        {
+            const_self_type::operator ++();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --()
+        {
+            const_self_type::operator --();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return const_self_type::operator ==(rhs);
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return const_self_type::end();
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        value_type& operator *()
+        {
+            return const_self_type::cache_->vals_[
+                    const_self_type::cache_->slts_[const_self_type::cur_slot_].ent_];
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        value_type* operator ->()
+        {
+            return &operator *();
+        }
+
+        template<
+                typename KeyT__,
+                typename ValueT__,
+                std::size_t SIZE__,
+                typename HashT__,
+                typename PredT__
+        >
+        friend class flat_static_cache;
+    };
+
+    /**
+     * @brief       Default constructor.
+     */
+    flat_static_cache() noexcept
+            : av_list_(0)
+    {
+        index_type i;
+
+        for (i = 0; i + 1 < SIZE; i++)
+        {
+            ents_[i].av_nxt_ = i + 1;
+            ents_[i + 1].av_prev_ = i;
+            ents_[i].flgs_.set(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+        }
+
+        ents_[i].av_nxt_ = 0;
+        ents_[0].av_prev_ = i;
+        ents_[i].flgs_.set(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+    }
+
+    /** @cond */
+    flat_static_cache(const flat_static_cache& rhs) = delete;
+
+    flat_static_cache(flat_static_cache&& rhs) = delete;
+
+    flat_static_cache& operator =(const flat_static_cache& rhs) = delete;
+
+    flat_static_cache& operator =(flat_static_cache&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Get the first element iterator of the container.
+     * @return      The first element iterator of the container.
+     */
+    iterator begin() noexcept
+    {
+        std::size_t cur_slot = 0;
+
+        while (cur_slot < TABLE_SIZE && fps_[cur_slot] == 0)
+        {
+            ++cur_slot;
+        }
+
+        return iterator(this, cur_slot);
+    }
+
+    /**
+     * @brief       Get the first element const iterator of the container.
+     * @return      The first element const iterator of the container.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return const_cast<flat_static_cache*>(this)->begin();
+    }
+
+    /**
+     * @brief       Get an iterator to the past-the-end element in the container.
+     * @return      An iterator to the past-the-end element in the container.
+     */
+    iterator end() noexcept
+    {
+        return iterator(this, TABLE_SIZE);
+    }
+
+    /**
+     * @brief       Get a const iterator to the past-the-end element in the container.
+     * @return      A const iterator to the past-the-end element in the container
+     */
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(const_cast<flat_static_cache*>(this), TABLE_SIZE);
+    }
+
+    /**
+     * @brief       Erase from the available list the element.
+     * @param       it : The element to erase from the available list.
+     */
+    void lock(const_iterator& it) noexcept
+    {
+        const index_type ent = slts_[it.cur_slot_].ent_;
+
+        if (ents_[ent].flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+        {
+            erase_from_available_list(ent);
+        }
+    }
+
+    /**
+     * @brief       Erase from the available list the element with the specified key.
+     * @param       ky : The element key.
+     */
+    void lock(const key_type& ky) noexcept
+    {
+        iterator it = find(ky);
+
+        if (!it.end())
+        {
+            lock(it);
+        }
+    }
+
+    /**
+     * @brief       Insert in the available list the specified element.
+     * @param       it : The element to insert in the available list.
+     */
+    void unlock(const_iterator& it) noexcept
+    {
+        const index_type ent = slts_[it.cur_slot_].ent_;
+
+        if (!ents_[ent].flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+        {
+            insert_in_available_list(ent);
+        }
+    }
+
+    /**
+     * @brief       Insert in the available list the element with the specified key.
+     * @param       ky : The element key.
+     */
+    void unlock(const key_type& ky) noexcept
+    {
+        iterator it = find(ky);
+
+        if (!it.end())
+        {
+            unlock(it);
+        }
+    }
+
+    /**
+     * @brief       Find the key associated value.
+     * @param       ky : The key.
+     * @return      If function was successful an iterator to the key associated value is returned,
+     *              an end iterator is returned.
+     */
+    iterator find(const key_type& ky) noexcept
+    {
+        const std::size_t cur_slot = find_slot(ky, get_mixed_hash(ky));
+
+        if (cur_slot != TABLE_SIZE)
+        {
+            const index_type ent = slts_[cur_slot].ent_;
+
+            if (ents_[ent].flgs_.is_set(scbf_t::INSERTED_IN_AVAILABLE_LIST))
+            {
+                set_most_recently_used_entry(ent);
+            }
+        }
+
+        return iterator(this, cur_slot);
+    }
+
+    /**
+     * @brief       Find the key associated value and remove it from the available list.
+     * @param       ky : The key.
+     * @return      If function was successful an iterator to the key associated value is returned,
+     *              an end iterator is returned.
+     */
+    iterator find_and_lock(const key_type& ky) noexcept
+    {
+        iterator it = find(ky);
+
+        if (!it.end())
+        {
+            lock(it);
+        }
+
+        return it;
+    }
+
+    /**
+     * @brief       Insert a key value pair in the container.
+     * @param       ky : The key.
+     * @param       val : The value.
+     * @return      An iterator to the inserted element.
+     * @throw       speed::containers::insertion_exception : If the key is already in the
+     *              container.
+     * @throw       The exceptions thrown by the key and value assignments, in which case the
+     *              element that was going to be recycled stays evicted.
+     */
+    template<typename KeyT_, typename ValueT_>
+    iterator insert(KeyT_&& ky, ValueT_&& val)
+    {
+        const std::uint64_t mixed_hash = get_mixed_hash(ky);
+
+        if (find_slot(ky, mixed_hash) != TABLE_SIZE)
+        {
+            throw insertion_exception();
+        }
+
+        const index_type ent = get_least_recently_used_entry();
+
+        if (ents_[ent].flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER))
+        {
+            erase_from_table(ents_[ent].slt_idx_);
+        }
+
+        std::size_t cur_slot = get_home_slot(mixed_hash);
+        std::uint64_t empty_mask;
+
+        while ((empty_mask = match_empty(load_group(cur_slot))) == 0)
+        {
+            cur_slot = (cur_slot + GROUP_SIZE) & (TABLE_SIZE - 1);
+        }
+
+        cur_slot = (cur_slot + (std::countr_zero(empty_mask) >> 3)) & (TABLE_SIZE - 1);
+
+        // The slot and the entry are only published once the assignments are done, so if one of
+        // them throws the slot stays empty and the entry stays free in the available list.
+        slts_[cur_slot].ky_ = std::forward<KeyT_>(ky);
+        vals_[ent] = std::forward<ValueT_>(val);
+        set_fingerprint(cur_slot, get_fingerprint(mixed_hash));
+        slts_[cur_slot].ent_ = ent;
+        hshs_[ent] = mixed_hash;
+        ents_[ent].slt_idx_ = static_cast<index_type>(cur_slot);
+        ents_[ent].flgs_.set(scbf_t::INSERTED_IN_HASH_BUFFER);
+
+        set_most_recently_used_entry(ent);
+
+        return iterator(this, cur_slot);
+    }
+
+    /**
+     * @brief       Insert a key value pair in the container and erase it from the available list.
+     * @param       ky : The key.
+     * @param       val : The value.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename KeyT_, typename ValueT_>
+    iterator insert_and_lock(KeyT_&& ky, ValueT_&& val)
+    {
+        iterator it = insert(std::forward<KeyT_>(ky), std::forward<ValueT_>(val));
+        lock(it);
+
+        return it;
+    }
+
+    /**
+     * @brief       Check whether the least recently used element is free (never used).
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_least_recently_used_free() const
+    {
+        const index_type ent = get_least_recently_used_entry();
+
+        return !ents_[ent].flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER);
+    }
+
+    /**
+     * @brief       Get the least recently used element.
+     * @return      The least recently used element.
+     */
+    value_type& get_least_recently_used()
+    {
+        return vals_[get_least_recently_used_entry()];
+    }
+
+protected:
+    /** Index used to represent the absence of entry. */
+    static constexpr index_type NIL = std::numeric_limits<index_type>::max();
+
+    /** The number of bits used to index the probing table. */
+    static constexpr std::size_t TABLE_BITS = std::countr_zero(TABLE_SIZE);
+
+    /** The number of fingerprints scanned at once. */
+    static constexpr std::size_t GROUP_SIZE = sizeof(std::uint64_t);
+
+    static_assert(TABLE_BITS <= 32, "the fingerprint bits must not overlap the index bits");
+
+    /**
+     * @brief       Get the mixed hash of a key. The user hash is multiplied by the 64-bit golden
+     *              ratio, so identity hashes such as std::hash<int> spread over the whole table.
+     * @param       ky : The key.
+     * @return      The mixed hash of the key.
+     */
+    static std::uint64_t get_mixed_hash(const key_type& ky) noexcept
+    {
+        return static_cast<std::uint64_t>(hash_type()(ky)) * 0x9E3779B97F4A7C15ull;
+    }
+
+    /**
+     * @brief       Get the slot in which the probing of a hash starts.
+     * @param       mixed_hash : The mixed hash.
+     * @return      The slot in which the probing of the hash starts.
+     */
+    static std::size_t get_home_slot(std::uint64_t mixed_hash) noexcept
+    {
+        return static_cast<std::size_t>(mixed_hash >> (64 - TABLE_BITS));
+    }
+
+    /**
+     * @brief       Get the fingerprint of a hash. Zero is reserved for the empty slots.
+     * @param       mixed_hash : The mixed hash.
+     * @return      The fingerprint of the hash.
+     */
+    static std::uint8_t get_fingerprint(std::uint64_t mixed_hash) noexcept
+    {
+        auto fp = static_cast<std::uint8_t>(mixed_hash >> 24);
+
+        return fp == 0 ? 1 : fp;
+    }
+
+    /**
+     * @brief       Get the mask of the zero bytes of a word. The lowest flagged byte is always a
+     *              zero byte, the higher ones can be false positives due to the borrows.
+     * @param       wrd : The word.
+     * @return      A mask with the high bit of the zero bytes set.
+     */
+    static std::uint64_t match_zero_bytes(std::uint64_t wrd) noexcept
+    {
+        return (wrd - 0x0101010101010101ull) & ~wrd & 0x8080808080808080ull;
+    }
+
+    /**
+     * @brief       Get the mask of the empty slots of a group.
+     * @param       grp : The group of fingerprints.
+     * @return      A mask with the high bit of the empty slots set.
+     */
+    static std::uint64_t match_empty(std::uint64_t grp) noexcept
+    {
+        return match_zero_bytes(grp);
+    }
+
+    /**
+     * @brief       Get the mask of the slots of a group that hold a fingerprint.
+     * @param       grp : The group of fingerprints.
+     * @param       fp : The fingerprint.
+     * @return      A mask with the high bit of the matching slots set.
+     */
+    static std::uint64_t match_fingerprint(std::uint64_t grp, std::uint8_t fp) noexcept
+    {
+        return match_zero_bytes(grp ^ (0x0101010101010101ull * fp));
+    }
+
+    /**
+     * @brief       Load the group of fingerprints that starts in a slot. The first byte of the
+     *              word is the fingerprint of the slot.
+     * @param       cur_slot : The slot in which the group starts.
+     * @return      The group of fingerprints.
+     */
+    std::uint64_t load_group(std::size_t cur_slot) const noexcept
+    {
+        std::uint64_t grp;
+
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::memcpy(&grp, &fps_[cur_slot], sizeof(grp));
+        }
+        else
+        {
+            grp = 0;
+
+            for (std::size_t i = 0; i < GROUP_SIZE; ++i)
+            {
+                grp |= static_cast<std::uint64_t>(fps_[cur_slot + i]) << (i * 8);
+            }
+        }
+
+        return grp;
+    }
+
+    /**
+     * @brief       Set the fingerprint of a slot and of its mirrored bytes.
+     * @param       cur_slot : The slot.
+     * @param       fp : The fingerprint.
+     */
+    void set_fingerprint(std::size_t cur_slot, std::uint8_t fp) noexcept
+    {
+        fps_[cur_slot] = fp;
+
+        for (std::size_t i = cur_slot + TABLE_SIZE; i < TABLE_SIZE + GROUP_SIZE - 1;
+             i += TABLE_SIZE)
+        {
+            fps_[i] = fp;
+        }
+    }
+
+    /**
+     * @brief       Find the slot that holds a key.
+     * @param       ky : The key.
+     * @param       mixed_hash : The mixed hash of the key.
+     * @return      If function was successful the slot index is returned, otherwise TABLE_SIZE is
+     *              returned.
+     */
+    std::size_t find_slot(const key_type& ky, std::uint64_t mixed_hash) const noexcept
+    {
+        const std::uint8_t fp = get_fingerprint(mixed_hash);
+        std::size_t cur_slot = get_home_slot(mixed_hash);
+        std::size_t match_slot;
+        std::uint64_t grp;
+        std::uint64_t fp_mask;
+        std::uint64_t empty_mask;
+        pred_type equal_to;
+
+        for (;;)
+        {
+            grp = load_group(cur_slot);
+            fp_mask = match_fingerprint(grp, fp);
+            empty_mask = match_empty(grp);
+
+            if (empty_mask != 0)
+            {
+                fp_mask &= (empty_mask & (~empty_mask + 1)) - 1;
+            }
+
+            while (fp_mask != 0)
+            {
+                match_slot = (cur_slot + (std::countr_zero(fp_mask) >> 3)) & (TABLE_SIZE - 1);
+
+                if (equal_to(slts_[match_slot].ky_, ky))
+                {
+                    return match_slot;
+                }
+
+                fp_mask &= fp_mask - 1;
+            }
+
+            if (empty_mask != 0)
+            {
+                return TABLE_SIZE;
+            }
+
+            cur_slot = (cur_slot + GROUP_SIZE) & (TABLE_SIZE - 1);
+        }
+    }
+
+    /**
+     * @brief       Erase a slot from the probing table. The following slots of the cluster are
+     *              shifted backward when it doesn't move them before their home slot, so the
+     *              table never needs tombstones.
+     * @param       hole_slot : The slot to erase.
+     */
+    void erase_from_table(std::size_t hole_slot) noexcept
+    {
+        std::size_t cur_slot = hole_slot;
+        std::size_t home_slot;
+
+        ents_[slts_[hole_slot].ent_].flgs_.unset(scbf_t::INSERTED_IN_HASH_BUFFER);
+
+        for (;;)
+        {
+            cur_slot = (cur_slot + 1) & (TABLE_SIZE - 1);
+
+            if (fps_[cur_slot] == 0)
+            {
+                break;
+            }
+
+            home_slot = get_home_slot(hshs_[slts_[cur_slot].ent_]);
+
+            if (((cur_slot - home_slot) & (TABLE_SIZE - 1)) >=
+                ((cur_slot - hole_slot) & (TABLE_SIZE - 1)))
+            {
+                set_fingerprint(hole_slot, fps_[cur_slot]);
+                slts_[hole_slot].ky_ = std::move(slts_[cur_slot].ky_);
+                slts_[hole_slot].ent_ = slts_[cur_slot].ent_;
+                ents_[slts_[hole_slot].ent_].slt_idx_ = static_cast<index_type>(hole_slot);
+                hole_slot = cur_slot;
+            }
+        }
+
+        set_fingerprint(hole_slot, 0);
+    }
+
+    /**
+     * @brief       Insert an entry in the end of the available list.
+     * @param       ent : The entry to insert.
+     */
+    void insert_in_available_list(index_type ent) noexcept
+    {
+        if (av_list_ == NIL)
+        {
+            av_list_ = ent;
+            ents_[ent].av_nxt_ = ent;
+            ents_[ent].av_prev_ = ent;
+        }
+        else
+        {
+            ents_[ent].av_prev_ = ents_[av_list_].av_prev_;
+            ents_[ent].av_nxt_ = av_list_;
+            ents_[ents_[av_list_].av_prev_].av_nxt_ = ent;
+            ents_[av_list_].av_prev_ = ent;
+        }
+
+        ents_[ent].flgs_.set(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+    }
+
+    /**
+     * @brief       Erase the specified entry from the available list.
+     * @param       ent : The entry to erase.
+     */
+    void erase_from_available_list(index_type ent) noexcept
+    {
+        if (ents_[ent].av_nxt_ == ent)
+        {
+            av_list_ = NIL;
+        }
+        else
+        {
+            if (ent == av_list_)
+            {
+                av_list_ = ents_[av_list_].av_nxt_;
+            }
+
+            ents_[ents_[ent].av_prev_].av_nxt_ = ents_[ent].av_nxt_;
+            ents_[ents_[ent].av_nxt_].av_prev_ = ents_[ent].av_prev_;
+        }
+
+        ents_[ent].flgs_.unset(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+    }
+
+    /**
+     * @brief       Get the least recently used entry in the available list.
+     * @return      The least recently used entry in the available list.
+     */
+    index_type get_least_recently_used_entry() const
+    {
+        if (av_list_ == NIL)
+        {
+            throw exhausted_resources_exception();
+        }
+
+        return av_list_;
+    }
+
+    /**
+     * @brief       Set the specified entry as the most recetly used.
+     * @param       ent : The entry to set as the most recetly used.
+     */
+    void set_most_recently_used_entry(index_type ent) noexcept
+    {
+        if (ent == av_list_)
+        {
+            av_list_ = ents_[av_list_].av_nxt_;
+        }
+        else
+        {
+            erase_from_available_list(ent);
+            insert_in_available_list(ent);
+        }
+    }
+
+private:
+    /**
+     * The fingerprints of the probing table, zero marks an empty slot. The first bytes are
+     * mirrored after the end, so a group can be loaded from any slot without wrapping.
+     */
+    std::uint8_t fps_[TABLE_SIZE + GROUP_SIZE - 1] = {};
+
+    /** The slots of the probing table. */
+    slot slts_[TABLE_SIZE];
+
+    /** The values of the entries. */
+    value_type vals_[SIZE];
+
+    /** The metadata of the entries. */
+    entry ents_[SIZE];
+
+    /** The mixed hashes of the entries, only needed to shift slots on erasure. */
+    std::uint64_t hshs_[SIZE];
+
+    /** The available list. */
+    index_type av_list_;
+};
+
+}
+
+#endif
@@ -0,0 +1,852 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       intrusive_hash_table.hpp
+ * @brief      intrusive_hash_table class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_INTRUSIVE_HASH_TABLE_HPP
+#define SPEED_CONTAINERS_INTRUSIVE_HASH_TABLE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "exception.hpp"
+#include "iterator_base.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Struct that represents the links that an object needs to be in an
+ *              intrusive_hash_table. It also keeps the hash of the object key, so the table never
+ *              hashes a key again.
+ */
+template<typename ValueT>
+struct intrusive_hash_hook
+{
+    /** Pointer to the next object in the bucket. */
+    ValueT* nxt_ = nullptr;
+
+    /** Pointer to the previous object in the bucket. */
+    ValueT* prev_ = nullptr;
+
+    /** The hash of the object key. */
+    std::size_t hsh_ = 0;
+
+    /**
+     * @brief       Allows knowing whether the object is in a table.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_linked() const noexcept
+    {
+        return nxt_ != nullptr;
+    }
+};
+
+/**
+ * @brief       Class that represents a chained hash table of objects that hold their own links in
+ *              an intrusive_hash_hook member. The buckets are provided by the user, so the table
+ *              never allocates, and every bucket is a circular doubly linked list, so an object is
+ *              unlinked in constant time. The stored hashes are compared before the keys, so the
+ *              predicate is only called for the likely matches. The keys are unique.
+ */
+template<
+        typename ValueT,
+        intrusive_hash_hook<ValueT> ValueT::* HookPtr,
+        typename KeyOfT,
+        typename HashT = std::hash<
+                std::remove_cvref_t<std::invoke_result_t<KeyOfT, const ValueT&>>>,
+        typename PredT = std::equal_to<>
+>
+class intrusive_hash_table
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The key type. */
+    using key_type = std::remove_cvref_t<std::invoke_result_t<KeyOfT, const ValueT&>>;
+
+    /** The hook type. */
+    using hook_type = intrusive_hash_hook<value_type>;
+
+    /** The type of the function that gets the key of an object. */
+    using key_of_type = KeyOfT;
+
+    /** The hash function type. */
+    using hash_type = HashT;
+
+    /** The key equality predicate type. */
+    using pred_type = PredT;
+
+    /** The bucket type, the first object of the bucket list. */
+    using bucket_type = value_type*;
+
+    /** The size type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief       Class that represents const iterators.
+     */
+    class const_iterator : public const_iterator_base<value_type, const_iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_iterator_base<value_type, const_iterator>;
+
+        /** The node iteration type. */
+        using node_type = value_type;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        const_iterator() noexcept = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       tbl : The table in which iterate.
+         * @param       bkt_idx : The index of the current bucket.
+         * @param       cur : The current object, nullptr for the end.
+         */
+        const_iterator(
+                const intrusive_hash_table* tbl,
+                size_type bkt_idx,
+                value_type* cur
+        ) noexcept
+                : tbl_(tbl)
+                , bkt_idx_(bkt_idx)
+                , cur_(cur)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            if (cur_ != nullptr)
+            {
+                cur_ = get_hook(cur_).nxt_;
+
+                if (cur_ == tbl_->bkts_[bkt_idx_])
+                {
+                    *this = tbl_->get_first_from(bkt_idx_ + 1);
+                }
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node. Moving backward from the end gives the last
+         *              object.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            if (cur_ != nullptr && cur_ != tbl_->bkts_[bkt_idx_])
+            {
+                cur_ = get_hook(cur_).prev_;
+
+                return *this;
+            }
+
+            size_type idx = cur_ == nullptr ? tbl_->bkts_.size() : bkt_idx_;
+
+            while (idx > 0)
+            {
+                --idx;
+
+                if (tbl_->bkts_[idx] != nullptr)
+                {
+                    bkt_idx_ = idx;
+                    cur_ = get_hook(tbl_->bkts_[idx]).prev_;
+
+                    return *this;
+                }
+            }
+
+            bkt_idx_ = tbl_->bkts_.size();
+            cur_ = nullptr;
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return cur_ == rhs.cur_;
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return cur_ == nullptr;
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        const value_type& operator *() const noexcept
+        {
+            return *cur_;
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        const value_type* operator ->() const noexcept
+        {
+            return cur_;
+        }
+
+        friend class intrusive_hash_table;
+
+    protected:
+        /** The table in which iterate. */
+        const intrusive_hash_table* tbl_ = nullptr;
+
+        /** The index of the current bucket. */
+        size_type bkt_idx_ = 0;
+
+        /** The current object. */
+        value_type* cur_ = nullptr;
+    };
+
+    /**
+     * @brief       Class that represents mutable iterators.
+     */
+    class iterator : public const_mutable_iterator_base<value_type, const_iterator, iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = iterator;
+
+        /** The const iterator base. */
+        using const_self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_mutable_iterator_base<value_type, const_iterator, iterator>;
+
+        /** The node iteration type. */
+        using node_type = value_type;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        iterator() = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       tbl : The table in which iterate.
+         * @param       bkt_idx : The index of the current bucket.
+         * @param       cur : The current object, nullptr for the end.
+         */
+        iterator(const intrusive_hash_table* tbl, size_type bkt_idx, value_type* cur) noexcept
+                : base_type(tbl, bkt_idx, cur)
+        {
+        }
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       it : The const iterator pointing the same object.
+         */
+        explicit iterator(const const_iterator& it) noexcept
+                : base_type(it)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            const_self_type::operator ++();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            const_self_type::operator --();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return const_self_type::operator ==(rhs);
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return const_self_type::end();
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        value_type& operator *() const noexcept
+        {
+            return *const_self_type::cur_;
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        value_type* operator ->() const noexcept
+        {
+            return const_self_type::cur_;
+        }
+
+        friend class intrusive_hash_table;
+    };
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       bkts : The buckets, at least one. Only the largest power of two of them that
+     *              fits in the span is used. They must outlive the table or be replaced with
+     *              rehash.
+     * @param       hsh : The hash function.
+     * @param       equal_to : The key equality predicate.
+     * @param       key_of : The function that gets the key of an object.
+     */
+    explicit intrusive_hash_table(
+            std::span<bucket_type> bkts,
+            const hash_type& hsh = hash_type(),
+            const pred_type& equal_to = pred_type(),
+            const key_of_type& key_of = key_of_type()
+    )
+            : bkts_(bkts.first(bkts.empty() ? 0 : std::bit_floor(bkts.size())))
+            , hsh_(hsh)
+            , equal_to_(equal_to)
+            , key_of_(key_of)
+    {
+        std::fill(bkts_.begin(), bkts_.end(), nullptr);
+    }
+
+    /** @cond */
+    intrusive_hash_table(const intrusive_hash_table& rhs) = delete;
+
+    intrusive_hash_table(intrusive_hash_table&& rhs) = delete;
+
+    intrusive_hash_table& operator =(const intrusive_hash_table& rhs) = delete;
+
+    intrusive_hash_table& operator =(intrusive_hash_table&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Destructor. The objects left in the table are unlinked.
+     */
+    ~intrusive_hash_table()
+    {
+        clear();
+    }
+
+    /**
+     * @brief       Get an iterator to the first object.
+     * @return      An iterator to the first object.
+     */
+    iterator begin() noexcept
+    {
+        return iterator(get_first_from(0));
+    }
+
+    /**
+     * @brief       Get an iterator to the first object.
+     * @return      An iterator to the first object.
+     */
+    const_iterator begin() const noexcept
+    {
+        return get_first_from(0);
+    }
+
+    /**
+     * @brief       Get an iterator to the first object.
+     * @return      An iterator to the first object.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return get_first_from(0);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    iterator end() noexcept
+    {
+        return iterator(this, bkts_.size(), nullptr);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, bkts_.size(), nullptr);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, bkts_.size(), nullptr);
+    }
+
+    /**
+     * @brief       Get an iterator to an object of the table.
+     * @param       val : The object, which has to be in the table.
+     * @return      An iterator to the object.
+     */
+    iterator iterator_to(value_type& val) noexcept
+    {
+        return iterator(this, get_bucket_index(get_hook(&val).hsh_), &val);
+    }
+
+    /**
+     * @brief       Allows knowing whether the table is empty.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return sz_ == 0;
+    }
+
+    /**
+     * @brief       Get the number of objects in the table.
+     * @return      The number of objects in the table.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return sz_;
+    }
+
+    /**
+     * @brief       Get the number of buckets.
+     * @return      The number of buckets.
+     */
+    [[nodiscard]] size_type bucket_count() const noexcept
+    {
+        return bkts_.size();
+    }
+
+    /**
+     * @brief       Get the average number of objects per bucket.
+     * @return      The average number of objects per bucket.
+     */
+    [[nodiscard]] float load_factor() const noexcept
+    {
+        return bkts_.empty() ? 0.0f : static_cast<float>(sz_) / static_cast<float>(bkts_.size());
+    }
+
+    /**
+     * @brief       Find an object by its key.
+     * @param       ky : The key.
+     * @return      An iterator to the object if it was found, otherwise the end iterator.
+     */
+    iterator find(const key_type& ky)
+    {
+        return find(ky, get_hash(ky));
+    }
+
+    /**
+     * @brief       Find an object by its key once the key is hashed.
+     * @param       ky : The key.
+     * @param       hsh : The hash of the key.
+     * @return      An iterator to the object if it was found, otherwise the end iterator.
+     */
+    iterator find(const key_type& ky, size_type hsh)
+    {
+        const size_type bkt_idx = get_bucket_index(hsh);
+        value_type* const val = find_in_bucket(bkt_idx, ky, hsh);
+
+        return val == nullptr ? end() : iterator(this, bkt_idx, val);
+    }
+
+    /**
+     * @brief       Find an object by its key.
+     * @param       ky : The key.
+     * @return      An iterator to the object if it was found, otherwise the end iterator.
+     */
+    const_iterator find(const key_type& ky) const
+    {
+        const size_type hsh = get_hash(ky);
+        const size_type bkt_idx = get_bucket_index(hsh);
+        value_type* const val = find_in_bucket(bkt_idx, ky, hsh);
+
+        return val == nullptr ? end() : const_iterator(this, bkt_idx, val);
+    }
+
+    /**
+     * @brief       Allows knowing whether an object with a key is in the table.
+     * @param       ky : The key.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool contains(const key_type& ky) const
+    {
+        const size_type hsh = get_hash(ky);
+
+        return find_in_bucket(get_bucket_index(hsh), ky, hsh) != nullptr;
+    }
+
+    /**
+     * @brief       Link an object in the table if no object with the same key is in it.
+     * @param       val : The object, which can't be in the table.
+     * @return      An iterator to the object with the key, and whether the object was linked.
+     * @throw       speed::containers::exhausted_resources_exception : If the table has no bucket.
+     */
+    std::pair<iterator, bool> insert(value_type& val)
+    {
+        if (bkts_.empty())
+        {
+            throw exhausted_resources_exception();
+        }
+
+        const key_type& ky = key_of_(std::as_const(val));
+        const size_type hsh = get_hash(ky);
+        const size_type bkt_idx = get_bucket_index(hsh);
+
+        if (value_type* const prev_val = find_in_bucket(bkt_idx, ky, hsh); prev_val != nullptr)
+        {
+            return {iterator(this, bkt_idx, prev_val), false};
+        }
+
+        get_hook(&val).hsh_ = hsh;
+        link(bkt_idx, &val);
+
+        return {iterator(this, bkt_idx, &val), true};
+    }
+
+    /**
+     * @brief       Unlink an object.
+     * @param       val : The object, which has to be in the table.
+     */
+    void erase(value_type& val) noexcept
+    {
+        hook_type& hk = get_hook(&val);
+        bucket_type& bkt = bkts_[get_bucket_index(hk.hsh_)];
+
+        if (hk.nxt_ == &val)
+        {
+            bkt = nullptr;
+        }
+        else
+        {
+            if (bkt == &val)
+            {
+                bkt = hk.nxt_;
+            }
+
+            get_hook(hk.prev_).nxt_ = hk.nxt_;
+            get_hook(hk.nxt_).prev_ = hk.prev_;
+        }
+
+        hk.nxt_ = nullptr;
+        hk.prev_ = nullptr;
+        --sz_;
+    }
+
+    /**
+     * @brief       Unlink the object at a position.
+     * @param       pos : The position.
+     * @return      An iterator to the object that followed the unlinked one.
+     */
+    iterator erase(const_iterator pos) noexcept
+    {
+        iterator nxt(pos);
+
+        ++nxt;
+        erase(*pos.cur_);
+
+        return nxt;
+    }
+
+    /**
+     * @brief       Unlink the object with a key.
+     * @param       ky : The key.
+     * @return      The number of unlinked objects.
+     */
+    size_type erase(const key_type& ky)
+    {
+        const size_type hsh = get_hash(ky);
+        value_type* const val = find_in_bucket(get_bucket_index(hsh), ky, hsh);
+
+        if (val == nullptr)
+        {
+            return 0;
+        }
+
+        erase(*val);
+
+        return 1;
+    }
+
+    /**
+     * @brief       Unlink all the objects.
+     */
+    void clear() noexcept
+    {
+        for (bucket_type& bkt : bkts_)
+        {
+            if (bkt == nullptr)
+            {
+                continue;
+            }
+
+            value_type* cur = bkt;
+
+            do
+            {
+                hook_type& hk = get_hook(cur);
+
+                cur = hk.nxt_;
+                hk.nxt_ = nullptr;
+                hk.prev_ = nullptr;
+
+            } while (cur != bkt);
+
+            bkt = nullptr;
+        }
+
+        sz_ = 0;
+    }
+
+    /**
+     * @brief       Move the objects to other buckets. The objects are linked using their stored
+     *              hashes, so no key is hashed again.
+     * @param       bkts : The new buckets, at least one. Only the largest power of two of them that
+     *              fits in the span is used, and they can't be the current ones.
+     */
+    void rehash(std::span<bucket_type> bkts) noexcept
+    {
+        std::span<bucket_type> old_bkts = std::exchange(
+                bkts_, bkts.first(bkts.empty() ? 0 : std::bit_floor(bkts.size())));
+
+        std::fill(bkts_.begin(), bkts_.end(), nullptr);
+        sz_ = 0;
+
+        for (bucket_type bkt : old_bkts)
+        {
+            if (bkt == nullptr)
+            {
+                continue;
+            }
+
+            value_type* cur = bkt;
+            value_type* nxt;
+
+            do
+            {
+                nxt = get_hook(cur).nxt_;
+                link(get_bucket_index(get_hook(cur).hsh_), cur);
+                cur = nxt;
+
+            } while (cur != bkt);
+        }
+    }
+
+private:
+    /**
+     * @brief       Get the hook of an object.
+     * @param       val : The object.
+     * @return      The hook of the object.
+     */
+    static hook_type& get_hook(value_type* val) noexcept
+    {
+        return val->*HookPtr;
+    }
+
+    /**
+     * @brief       Get the hash of a key.
+     * @param       ky : The key.
+     * @return      The hash of the key.
+     */
+    [[nodiscard]] size_type get_hash(const key_type& ky) const
+    {
+        return static_cast<size_type>(hsh_(ky));
+    }
+
+    /**
+     * @brief       Get the bucket index associated with a hash. Hashes such as std::hash<int> and
+     *              std::hash<T*> are the identity, so the hash is multiplied by the 64-bit golden
+     *              ratio and the index is taken from the high bits of the product.
+     * @param       hsh : The hash.
+     * @return      The bucket index associated with the hash.
+     */
+    [[nodiscard]] size_type get_bucket_index(size_type hsh) const noexcept
+    {
+        const int bkt_bits = std::countr_zero(bkts_.size());
+        const std::uint64_t mixd_hsh = static_cast<std::uint64_t>(hsh) * 0x9E3779B97F4A7C15ull;
+
+        return bkts_.size() <= 1 ? 0 : static_cast<size_type>(mixd_hsh >> (64 - bkt_bits));
+    }
+
+    /**
+     * @brief       Get an iterator to the first object of the first non empty bucket starting from
+     *              an index.
+     * @param       bkt_idx : The index of the first bucket to look at.
+     * @return      An iterator to the object, or the end iterator if there is none.
+     */
+    [[nodiscard]] const_iterator get_first_from(size_type bkt_idx) const noexcept
+    {
+        for (; bkt_idx < bkts_.size(); ++bkt_idx)
+        {
+            if (bkts_[bkt_idx] != nullptr)
+            {
+                return const_iterator(this, bkt_idx, bkts_[bkt_idx]);
+            }
+        }
+
+        return end();
+    }
+
+    /**
+     * @brief       Find the object that holds a key in a bucket.
+     * @param       bkt_idx : The index of the bucket.
+     * @param       ky : The key.
+     * @param       hsh : The hash of the key.
+     * @return      If function was successful the object is returned, otherwise nullptr is
+     *              returned.
+     */
+    [[nodiscard]] value_type* find_in_bucket(
+            size_type bkt_idx,
+            const key_type& ky,
+            size_type hsh
+    ) const
+    {
+        if (bkts_.empty())
+        {
+            return nullptr;
+        }
+
+        value_type* const first = bkts_[bkt_idx];
+        value_type* cur = first;
+
+        if (first != nullptr)
+        {
+            do
+            {
+                if (get_hook(cur).hsh_ == hsh && equal_to_(key_of_(std::as_const(*cur)), ky))
+                {
+                    return cur;
+                }
+
+                cur = get_hook(cur).nxt_;
+
+            } while (cur != first);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief       Link an object at the end of a bucket.
+     * @param       bkt_idx : The index of the bucket.
+     * @param       val : The object.
+     */
+    void link(size_type bkt_idx, value_type* val) noexcept
+    {
+        bucket_type& bkt = bkts_[bkt_idx];
+        hook_type& hk = get_hook(val);
+
+        if (bkt == nullptr)
+        {
+            bkt = val;
+            hk.nxt_ = val;
+            hk.prev_ = val;
+        }
+        else
+        {
+            hk.prev_ = get_hook(bkt).prev_;
+            hk.nxt_ = bkt;
+            get_hook(hk.prev_).nxt_ = val;
+            get_hook(bkt).prev_ = val;
+        }
+
+        ++sz_;
+    }
+
+private:
+    /** The buckets. */
+    std::span<bucket_type> bkts_;
+
+    /** The number of objects in the table. */
+    size_type sz_ = 0;
+
+    /** The hash function. */
+    [[no_unique_address]] hash_type hsh_;
+
+    /** The key equality predicate. */
+    [[no_unique_address]] pred_type equal_to_;
+
+    /** The function that gets the key of an object. */
+    [[no_unique_address]] key_of_type key_of_;
+};
+
+}
+
+#endif
@@ -0,0 +1,695 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       intrusive_list.hpp
+ * @brief      intrusive_list class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_INTRUSIVE_LIST_HPP
+#define SPEED_CONTAINERS_INTRUSIVE_LIST_HPP
+
+#include <cstddef>
+
+#include "iterator_base.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Struct that represents the links that an object needs to be in an intrusive_list.
+ *              An object can be in as many lists at the same time as hooks it has.
+ */
+template<typename ValueT>
+struct intrusive_list_hook
+{
+    /** Pointer to the next object in the list. */
+    ValueT* nxt_ = nullptr;
+
+    /** Pointer to the previous object in the list. */
+    ValueT* prev_ = nullptr;
+
+    /**
+     * @brief       Allows knowing whether the object is in a list.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_linked() const noexcept
+    {
+        return nxt_ != nullptr;
+    }
+};
+
+/**
+ * @brief       Class that represents a circular doubly linked list of objects that hold their own
+ *              links in an intrusive_list_hook member. The list never allocates nor copies the
+ *              objects, it only links them, so the objects must outlive their membership. The
+ *              hook of an object that leaves the list is reset, so whether an object is in the
+ *              list can be known from its hook.
+ */
+template<typename ValueT, intrusive_list_hook<ValueT> ValueT::* HookPtr>
+class intrusive_list
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The hook type. */
+    using hook_type = intrusive_list_hook<value_type>;
+
+    /** The size type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief       Class that represents const iterators.
+     */
+    class const_iterator : public const_iterator_base<value_type, const_iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_iterator_base<value_type, const_iterator>;
+
+        /** The node iteration type. */
+        using node_type = value_type;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        const_iterator() noexcept = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       lst : The list in which iterate.
+         * @param       cur : The current object, nullptr for the end.
+         */
+        const_iterator(const intrusive_list* lst, value_type* cur) noexcept
+                : lst_(lst)
+                , cur_(cur)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            if (cur_ != nullptr)
+            {
+                cur_ = get_hook(cur_).nxt_;
+
+                if (cur_ == lst_->head_)
+                {
+                    cur_ = nullptr;
+                }
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node. Moving backward from the end gives the last
+         *              object.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            if (cur_ == nullptr)
+            {
+                cur_ = lst_->head_ == nullptr ? nullptr : get_hook(lst_->head_).prev_;
+            }
+            else
+            {
+                cur_ = cur_ == lst_->head_ ? nullptr : get_hook(cur_).prev_;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return cur_ == rhs.cur_;
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return cur_ == nullptr;
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        const value_type& operator *() const noexcept
+        {
+            return *cur_;
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        const value_type* operator ->() const noexcept
+        {
+            return cur_;
+        }
+
+        friend class intrusive_list;
+
+    protected:
+        /** The list in which iterate. */
+        const intrusive_list* lst_ = nullptr;
+
+        /** The current object. */
+        value_type* cur_ = nullptr;
+    };
+
+    /**
+     * @brief       Class that represents mutable iterators.
+     */
+    class iterator : public const_mutable_iterator_base<value_type, const_iterator, iterator>
+    {
+    public:
+        /** The class itself. */
+        using self_type = iterator;
+
+        /** The const iterator base. */
+        using const_self_type = const_iterator;
+
+        /** The base class. */
+        using base_type = const_mutable_iterator_base<value_type, const_iterator, iterator>;
+
+        /** The node iteration type. */
+        using node_type = value_type;
+
+        using base_type::operator ++;
+        using base_type::operator --;
+
+        /**
+         * @brief       Default constructor.
+         */
+        iterator() = default;
+
+        /**
+         * @brief       Constructor with parameters.
+         * @param       lst : The list in which iterate.
+         * @param       cur : The current object, nullptr for the end.
+         */
+        iterator(const intrusive_list* lst, value_type* cur) noexcept
+                : base_type(lst, cur)
+        {
+        }
+
+        /**
+         * @brief       Move to the forward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator ++() noexcept
+        {
+            const_self_type::operator ++();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Move to the backward node.
+         * @return      A reference to an iterator pointing the current node.
+         */
+        self_type& operator --() noexcept
+        {
+            const_self_type::operator --();
+
+            return *this;
+        }
+
+        /**
+         * @brief       Allows knowing whether the two iterators are the same.
+         * @param       rhs : The value to compare.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        bool operator ==(const self_type& rhs) const noexcept
+        {
+            return const_self_type::operator ==(rhs);
+        }
+
+        /**
+         * @brief       Allows knowing whether the iterator is past-the-end or not.
+         * @return      If function was successful true is returned, otherwise false is returned.
+         */
+        [[nodiscard]] bool end() const noexcept
+        {
+            return const_self_type::end();
+        }
+
+        /**
+         * @brief       Get the reference of the current node value.
+         * @return      The reference of the current node value.
+         */
+        value_type& operator *() const noexcept
+        {
+            return *const_self_type::cur_;
+        }
+
+        /**
+         * @brief       Get the address of the current node value.
+         * @return      The address of the current node value.
+         */
+        value_type* operator ->() const noexcept
+        {
+            return const_self_type::cur_;
+        }
+
+        friend class intrusive_list;
+    };
+
+    /**
+     * @brief       Default constructor.
+     */
+    intrusive_list() noexcept = default;
+
+    /** @cond */
+    intrusive_list(const intrusive_list& rhs) = delete;
+
+    intrusive_list& operator =(const intrusive_list& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Move constructor. The objects are moved to the new list, rhs is left empty.
+     * @param       rhs : Object to move.
+     */
+    intrusive_list(intrusive_list&& rhs) noexcept
+            : head_(rhs.head_)
+            , sz_(rhs.sz_)
+    {
+        rhs.head_ = nullptr;
+        rhs.sz_ = 0;
+    }
+
+    /**
+     * @brief       Destructor. The objects left in the list are unlinked.
+     */
+    ~intrusive_list()
+    {
+        clear();
+    }
+
+    /**
+     * @brief       Move assignment operator. The objects of the list are unlinked and the ones of
+     *              rhs are moved to it, rhs is left empty.
+     * @param       rhs : Object to move.
+     * @return      The object who call the method.
+     */
+    intrusive_list& operator =(intrusive_list&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            clear();
+            head_ = rhs.head_;
+            sz_ = rhs.sz_;
+            rhs.head_ = nullptr;
+            rhs.sz_ = 0;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief       Get an iterator to the first object.
+     * @return      An iterator to the first object.
+     */
+    iterator begin() noexcept
+    {
+        return iterator(this, head_);
+    }
+
+    /**
+     * @brief       Get an iterator to the first object.
+     * @return      An iterator to the first object.
+     */
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, head_);
+    }
+
+    /**
+     * @brief       Get an iterator to the first object.
+     * @return      An iterator to the first object.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, head_);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    iterator end() noexcept
+    {
+        return iterator(this, nullptr);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, nullptr);
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, nullptr);
+    }
+
+    /**
+     * @brief       Get an iterator to an object of the list.
+     * @param       val : The object, which has to be in the list.
+     * @return      An iterator to the object.
+     */
+    iterator iterator_to(value_type& val) noexcept
+    {
+        return iterator(this, &val);
+    }
+
+    /**
+     * @brief       Get an iterator to an object of the list.
+     * @param       val : The object, which has to be in the list.
+     * @return      An iterator to the object.
+     */
+    const_iterator iterator_to(const value_type& val) const noexcept
+    {
+        return const_iterator(this, const_cast<value_type*>(&val));
+    }
+
+    /**
+     * @brief       Get the first object.
+     * @return      The first object.
+     */
+    [[nodiscard]] value_type& front() const noexcept
+    {
+        return *head_;
+    }
+
+    /**
+     * @brief       Get the last object.
+     * @return      The last object.
+     */
+    [[nodiscard]] value_type& back() const noexcept
+    {
+        return *get_hook(head_).prev_;
+    }
+
+    /**
+     * @brief       Allows knowing whether the list is empty.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return head_ == nullptr;
+    }
+
+    /**
+     * @brief       Get the number of objects in the list.
+     * @return      The number of objects in the list.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return sz_;
+    }
+
+    /**
+     * @brief       Link an object at the end of the list.
+     * @param       val : The object, which can't be in the list.
+     */
+    void push_back(value_type& val) noexcept
+    {
+        link_before(head_, &val);
+    }
+
+    /**
+     * @brief       Link an object at the beginning of the list.
+     * @param       val : The object, which can't be in the list.
+     */
+    void push_front(value_type& val) noexcept
+    {
+        link_before(head_, &val);
+        head_ = &val;
+    }
+
+    /**
+     * @brief       Link an object before a position.
+     * @param       pos : The position.
+     * @param       val : The object, which can't be in the list.
+     * @return      An iterator to the linked object.
+     */
+    iterator insert(const_iterator pos, value_type& val) noexcept
+    {
+        if (pos.cur_ == nullptr)
+        {
+            push_back(val);
+        }
+        else
+        {
+            link_before(pos.cur_, &val);
+
+            if (pos.cur_ == head_)
+            {
+                head_ = &val;
+            }
+        }
+
+        return iterator(this, &val);
+    }
+
+    /**
+     * @brief       Unlink the first object.
+     */
+    void pop_front() noexcept
+    {
+        erase(*head_);
+    }
+
+    /**
+     * @brief       Unlink the last object.
+     */
+    void pop_back() noexcept
+    {
+        erase(back());
+    }
+
+    /**
+     * @brief       Unlink an object.
+     * @param       val : The object, which has to be in the list.
+     */
+    void erase(value_type& val) noexcept
+    {
+        hook_type& hk = get_hook(&val);
+
+        if (hk.nxt_ == &val)
+        {
+            head_ = nullptr;
+        }
+        else
+        {
+            if (&val == head_)
+            {
+                head_ = hk.nxt_;
+            }
+
+            get_hook(hk.prev_).nxt_ = hk.nxt_;
+            get_hook(hk.nxt_).prev_ = hk.prev_;
+        }
+
+        hk.nxt_ = nullptr;
+        hk.prev_ = nullptr;
+        --sz_;
+    }
+
+    /**
+     * @brief       Unlink the object at a position.
+     * @param       pos : The position.
+     * @return      An iterator to the object that followed the unlinked one.
+     */
+    iterator erase(const_iterator pos) noexcept
+    {
+        iterator nxt(this, pos.cur_);
+
+        ++nxt;
+        erase(*pos.cur_);
+
+        return nxt;
+    }
+
+    /**
+     * @brief       Move an object of the list to its end.
+     * @param       val : The object, which has to be in the list.
+     */
+    void move_to_back(value_type& val) noexcept
+    {
+        if (&val == head_)
+        {
+            head_ = get_hook(head_).nxt_;
+        }
+        else if (&val != get_hook(head_).prev_)
+        {
+            erase(val);
+            push_back(val);
+        }
+    }
+
+    /**
+     * @brief       Move an object of the list to its beginning.
+     * @param       val : The object, which has to be in the list.
+     */
+    void move_to_front(value_type& val) noexcept
+    {
+        if (&val == get_hook(head_).prev_)
+        {
+            head_ = &val;
+        }
+        else if (&val != head_)
+        {
+            erase(val);
+            push_front(val);
+        }
+    }
+
+    /**
+     * @brief       Move all the objects of another list to the end of this one, leaving it empty.
+     * @param       rhs : The other list.
+     */
+    void splice_back(intrusive_list& rhs) noexcept
+    {
+        if (rhs.head_ == nullptr || &rhs == this)
+        {
+            return;
+        }
+
+        if (head_ == nullptr)
+        {
+            head_ = rhs.head_;
+        }
+        else
+        {
+            value_type* const tl = get_hook(head_).prev_;
+            value_type* const rhs_tl = get_hook(rhs.head_).prev_;
+
+            get_hook(tl).nxt_ = rhs.head_;
+            get_hook(rhs.head_).prev_ = tl;
+            get_hook(rhs_tl).nxt_ = head_;
+            get_hook(head_).prev_ = rhs_tl;
+        }
+
+        sz_ += rhs.sz_;
+        rhs.head_ = nullptr;
+        rhs.sz_ = 0;
+    }
+
+    /**
+     * @brief       Unlink all the objects.
+     */
+    void clear() noexcept
+    {
+        value_type* cur = head_;
+
+        for (size_type i = 0; i < sz_; ++i)
+        {
+            hook_type& hk = get_hook(cur);
+
+            cur = hk.nxt_;
+            hk.nxt_ = nullptr;
+            hk.prev_ = nullptr;
+        }
+
+        head_ = nullptr;
+        sz_ = 0;
+    }
+
+private:
+    /**
+     * @brief       Get the hook of an object.
+     * @param       val : The object.
+     * @return      The hook of the object.
+     */
+    static hook_type& get_hook(value_type* val) noexcept
+    {
+        return val->*HookPtr;
+    }
+
+    /**
+     * @brief       Link an object before another one, or as the only object if the list is empty.
+     *              The head is only set when the list is empty.
+     * @param       pos : The object before which link, the head if the list isn't empty.
+     * @param       val : The object to link.
+     */
+    void link_before(value_type* pos, value_type* val) noexcept
+    {
+        hook_type& hk = get_hook(val);
+
+        if (head_ == nullptr)
+        {
+            head_ = val;
+            hk.nxt_ = val;
+            hk.prev_ = val;
+        }
+        else
+        {
+            hook_type& pos_hk = get_hook(pos);
+
+            hk.prev_ = pos_hk.prev_;
+            hk.nxt_ = pos;
+            get_hook(pos_hk.prev_).nxt_ = val;
+            pos_hk.prev_ = val;
+        }
+
+        ++sz_;
+    }
+
+private:
+    /** The first object of the list. */
+    value_type* head_ = nullptr;
+
+    /** The number of objects in the list. */
+    size_type sz_ = 0;
+};
+
+}
+
+#endif
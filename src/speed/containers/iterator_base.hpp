@@ -19,7 +19,7 @@
 
 /**
  * @file       iterator_base.hpp
- * @brief      iterator_base interface header.
+ * @brief      iterator_base class header.
  * @author     Killian Valverde
  * @date       2018/01/19
  */
@@ -27,12 +27,29 @@
 #ifndef SPEED_CONTAINERS_ITERATOR_BASE_HPP
 #define SPEED_CONTAINERS_ITERATOR_BASE_HPP
 
+#include <concepts>
 #include <cstddef>
+#include <utility>
 
 namespace speed::containers {
 
 /**
- * @brief       Class that represents the interface of the iterators base.
+ * @brief       Concept that represents the operations that an iterator has to provide so that the
+ *              iterators base can build the remaining operators on top of them.
+ */
+template<typename IteratorT>
+concept bidirectional_node_iterator = requires (IteratorT& it, const IteratorT& cit)
+{
+    { ++it } -> std::same_as<IteratorT&>;
+    { --it } -> std::same_as<IteratorT&>;
+    { cit == cit } -> std::convertible_to<bool>;
+    { cit.end() } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief       Class that represents the base of the iterators. The derived iterator is given as
+ *              template parameter, so every operator is resolved at compile time and can be
+ *              inlined in the loops that use it.
  */
 template<typename ValueT, typename IteratorT>
 class iterator_base
@@ -47,45 +64,15 @@ public:
     /** The class itself. */
     using self_type = iterator_base<value_type, iterator_type>;
     
-    /**
-     * @brief       Default destructor.
-     */
-    virtual ~iterator_base() = default;
-    
-    /**
-     * @brief       Move to the forward node.
-     * @return      A reference to an iterator pointing the current node.
-     */
-    virtual iterator_type& operator ++() = 0;
-    
-    /**
-     * @brief       Move to the backward node.
-     * @return      A reference to an iterator pointing the current node.
-     */
-    virtual iterator_type& operator --() = 0;
-    
-    /**
-     * @brief       Allows knowing whether the two iterators are the same.
-     * @param       rhs : The value to compare.
-     * @return      If function was successful true is returned, otherwise false is returned.
-     */
-    virtual bool operator ==(const iterator_type& rhs) const noexcept = 0;
-    
-    /**
-     * @brief       Allows knowing whether the iterator is past-the-end or not.
-     * @return      If function was successful true is returned, otherwise false is returned.
-     */
-    [[nodiscard]] virtual bool end() const noexcept = 0;
-    
     /**
      * @brief       Move to the forward node.
      * @return      A reference to the the iterator pointing the node before the operation.
      */
-    virtual const iterator_type operator ++(int)
+    const iterator_type operator ++(int)
     {
-        iterator_type old_it(dynamic_cast<iterator_type&>(*this));
-    
-        operator ++();
+        iterator_type old_it(derived());
+        
+        ++derived();
         
         return old_it;
     }
@@ -94,11 +81,11 @@ public:
      * @brief       Move to the backward node.
      * @return      A reference to the iterator pointing the node before the operation.
      */
-    virtual const iterator_type operator --(int)
+    const iterator_type operator --(int)
     {
-        iterator_type old_it(dynamic_cast<iterator_type&>(*this));
-    
-        operator --();
+        iterator_type old_it(derived());
+        
+        --derived();
         
         return old_it;
     }
@@ -108,9 +95,9 @@ public:
      * @param       n : The number of times to move.
      * @return      A reference to a iterator pointing the resulting node.
      */
-    virtual const iterator_type operator +(std::size_t n) const
+    const iterator_type operator +(std::size_t n) const
     {
-        iterator_type old_it(dynamic_cast<const iterator_type&>(*this));
+        iterator_type old_it(derived());
         
         for (std::size_t i = 0; i < n; i++)
         {
@@ -125,9 +112,9 @@ public:
      * @param       n : The number of times to move.
      * @return      A reference to a iterator pointing the resulting node.
      */
-    virtual const iterator_type operator -(std::size_t n) const
+    const iterator_type operator -(std::size_t n) const
     {
-        iterator_type old_it(dynamic_cast<const iterator_type&>(*this));
+        iterator_type old_it(derived());
         
         for (std::size_t i = 0; i < n; i++)
         {
@@ -142,14 +129,14 @@ public:
      * @param       n : The number of times to move.
      * @return      A reference to a iterator pointing the current node.
      */
-    virtual iterator_type& operator +=(std::size_t n)
+    iterator_type& operator +=(std::size_t n)
     {
         for (std::size_t i = 0; i < n; i++)
         {
-            operator ++();
+            ++derived();
         }
     
-        return dynamic_cast<iterator_type&>(*this);
+        return derived();
     }
     
     /**
@@ -157,14 +144,14 @@ public:
      * @param       n : The number of times to move.
      * @return      A reference to a iterator pointing the current node.
      */
-    virtual iterator_type& operator -=(std::size_t n)
+    iterator_type& operator -=(std::size_t n)
     {
         for (std::size_t i = 0; i < n; i++)
         {
-            operator --();
+            --derived();
         }
     
-        return dynamic_cast<iterator_type&>(*this);
+        return derived();
     }
     
     /**
@@ -172,9 +159,9 @@ public:
      * @param       rhs : The iterator to compare.
      * @return      If function was successful true is returned, otherwise false is returned.
      */
-    virtual bool operator !=(const iterator_type& rhs) const noexcept
+    bool operator !=(const iterator_type& rhs) const noexcept
     {
-        return !(*this == rhs);
+        return !(derived() == rhs);
     }
     
     /**
@@ -182,9 +169,9 @@ public:
      * @param       rhs : The iterator to compare.
      * @return      If function was successful true is returned, otherwise false is returned.
      */
-    virtual bool operator <(const iterator_type& rhs) const noexcept
+    bool operator <(const iterator_type& rhs) const noexcept
     {
-        iterator_type it(dynamic_cast<const iterator_type&>(*this));
+        iterator_type it(derived());
         
         while (!it.end())
         {
@@ -204,9 +191,9 @@ public:
      * @param       rhs : The iterator to compare.
      * @return      If function was successful true is returned, otherwise false is returned.
      */
-    virtual bool operator >(const iterator_type& rhs) const noexcept
+    bool operator >(const iterator_type& rhs) const noexcept
     {
-        iterator_type it(dynamic_cast<const iterator_type&>(*this));
+        iterator_type it(derived());
     
         while (!it.end())
         {
@@ -226,14 +213,14 @@ public:
      * @param       rhs : The iterator to compare.
      * @return      If function was successful true is returned, otherwise false is returned.
      */
-    virtual bool operator <=(const iterator_type& rhs) const noexcept
+    bool operator <=(const iterator_type& rhs) const noexcept
     {
-        if (*this == rhs)
+        if (derived() == rhs)
         {
             return true;
         }
     
-        return *this < rhs;
+        return derived() < rhs;
     }
     
     /**
@@ -242,22 +229,45 @@ public:
      * @param       rhs : The iterator to compare.
      * @return      If function was successful true is returned, otherwise false is returned.
      */
-    virtual bool operator >=(const iterator_type& rhs) const noexcept
+    bool operator >=(const iterator_type& rhs) const noexcept
     {
-        if (*this == rhs)
+        if (derived() == rhs)
         {
             return true;
         }
     
-        return *this > rhs;
+        return derived() > rhs;
+    }
+
+protected:
+    /**
+     * @brief       Get the derived iterator.
+     * @return      The derived iterator.
+     */
+    iterator_type& derived() noexcept
+    {
+        static_assert(bidirectional_node_iterator<iterator_type>);
+        
+        return static_cast<iterator_type&>(*this);
+    }
+    
+    /**
+     * @brief       Get the derived iterator.
+     * @return      The derived iterator.
+     */
+    const iterator_type& derived() const noexcept
+    {
+        static_assert(bidirectional_node_iterator<iterator_type>);
+        
+        return static_cast<const iterator_type&>(*this);
     }
 };
 
 /**
- * @brief       Class that represents the interface for a constant iterator.
+ * @brief       Class that represents the base for a constant iterator.
  */
 template<typename ValueT, typename IteratorT>
-class const_iterator_base : public virtual iterator_base<ValueT, IteratorT>
+class const_iterator_base : public iterator_base<ValueT, IteratorT>
 {
 public:
     /** The value encapsulated by the iterator. */
@@ -272,38 +282,22 @@ public:
     /** The base class. */
     using base_type = iterator_base<value_type, iterator_type>;
 
-    /**
-     * @brief       Get the reference of the current node value.
-     * @return      The reference of the current node value.
-     */
-    virtual const value_type& operator *() const = 0;
-
-    /**
-     * @brief       Get the address of the current node value.
-     * @return      The address of the current node value.
-     */
-    virtual const value_type* operator ->() const = 0;
-
     /**
      * @brief       Move to the forward node n times.
      * @param       n : The number of times to move.
-     * @return      A reference to the resulting node.
+     * @return      The value of the resulting node, as returned by the indirection operator.
      */
-    virtual const value_type& operator [](std::size_t n) const
+    decltype(auto) operator [](std::size_t n) const
     {
-        iterator_type old_it(dynamic_cast<const iterator_type&>(*this));
-
-        old_it.self_type::operator +=(n);
-
-        return *old_it;
+        return *(base_type::derived() + n);
     }
 };
 
 /**
- * @brief       Class that represents the interface for a mutable iterator.
+ * @brief       Class that represents the base for a mutable iterator.
  */
 template<typename ValueT, typename IteratorT>
-class mutable_iterator_base : public virtual iterator_base<ValueT, IteratorT>
+class mutable_iterator_base : public iterator_base<ValueT, IteratorT>
 {
 public:
     /** The value encapsulated by the iterator. */
@@ -318,35 +312,23 @@ public:
     /** The base class. */
     using base_type = iterator_base<value_type, iterator_type>;
 
-    /**
-     * @brief       Get the reference of the current node value.
-     * @return      The reference of the current node value.
-     */
-    virtual value_type& operator *() = 0;
-
-    /**
-     * @brief       Get the address of the current node value.
-     * @return      The address of the current node value.
-     */
-    virtual value_type* operator ->() = 0;
-
     /**
      * @brief       Move to the forward node n times.
      * @param       n : The number of times to move.
-     * @return      A reference to the resulting node.
+     * @return      The value of the resulting node, as returned by the indirection operator.
      */
-    virtual value_type& operator [](std::size_t n)
+    decltype(auto) operator [](std::size_t n)
     {
-        iterator_type old_it(dynamic_cast<const iterator_type&>(*this));
-
-        old_it.self_type::operator +=(n);
-
-        return *old_it;
+        iterator_type it(base_type::derived());
+        
+        it += n;
+        
+        return *it;
     }
 };
 
 /**
- * @brief       Class that represents the interface for a constant mutable iterator.
+ * @brief       Class that represents the base for a constant mutable iterator.
  */
 template<typename ValueT, typename ConstIteratorT, typename MutableIteratorT>
 class const_mutable_iterator_base
@@ -390,6 +372,7 @@ public:
     using base_type::operator >;
     using base_type::operator <=;
     using base_type::operator >=;
+    using base_type::operator [];
 };
 
 }
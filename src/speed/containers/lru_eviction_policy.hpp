@@ -0,0 +1,154 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       lru_eviction_policy.hpp
+ * @brief      lru_eviction_policy class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_LRU_EVICTION_POLICY_HPP
+#define SPEED_CONTAINERS_LRU_EVICTION_POLICY_HPP
+
+#include <cstddef>
+
+#include "detail/eviction_list.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a least recently used eviction policy. The available
+ *              nodes are kept in a circular doubly linked list whose first node is the least
+ *              recently used one, and every hit moves the node to the end of the list.
+ */
+template<typename NodeT>
+class lru_eviction_policy
+{
+public:
+    /** The node type. */
+    using node_type = NodeT;
+
+    /** Whether on_hit can be called by several readers at once. */
+    static constexpr bool CONCURRENT_HITS = false;
+
+    /**
+     * @brief       Struct that represents the state kept in every node.
+     */
+    struct hook_type
+    {
+        /** Pointer to the next node in the available list. */
+        node_type* av_nxt_;
+
+        /** Pointer to the previous node in the available list. */
+        node_type* av_prev_;
+    };
+
+    /**
+     * @brief       Make the specified nodes free and available.
+     * @param       nds : The first node.
+     * @param       n_nds : The number of nodes.
+     */
+    void initialize(node_type* nds, std::size_t n_nds) noexcept
+    {
+        av_list_.clear();
+
+        for (std::size_t i = 0; i < n_nds; i++)
+        {
+            av_list_.push_back(&nds[i]);
+        }
+    }
+
+    /**
+     * @brief       Get the least recently used node.
+     * @return      The least recently used node, or nullptr if there is no available node.
+     */
+    node_type* get_victim() const noexcept
+    {
+        return av_list_.front();
+    }
+
+    /**
+     * @brief       Notify that the victim holds a new key.
+     * @param       nd : The victim.
+     * @param       hsh : The hash of the new key.
+     */
+    void on_insert(node_type* nd, std::size_t hsh) noexcept
+    {
+        (void)hsh;
+        av_list_.move_to_back(nd);
+    }
+
+    /**
+     * @brief       Notify that an available node has been found.
+     * @param       nd : The node found.
+     */
+    void on_hit(node_type* nd) noexcept
+    {
+        av_list_.move_to_back(nd);
+    }
+
+    /**
+     * @brief       Notify that an available node has been locked.
+     * @param       nd : The node locked.
+     */
+    void on_lock(node_type* nd) noexcept
+    {
+        av_list_.erase(nd);
+    }
+
+    /**
+     * @brief       Notify that a locked node has been unlocked.
+     * @param       nd : The node unlocked.
+     */
+    void on_unlock(node_type* nd) noexcept
+    {
+        av_list_.push_back(nd);
+    }
+
+    /**
+     * @brief       Notify that an available node no longer holds a key. It becomes free, so it is
+     *              the next one to be recycled.
+     * @param       nd : The node erased.
+     */
+    void on_erase(node_type* nd) noexcept
+    {
+        av_list_.erase(nd);
+        av_list_.push_front(nd);
+    }
+
+    /**
+     * @brief       Call a function on every available node, from the least recently used to the
+     *              most recently used, without modifying the policy.
+     * @param       fnc : The function to call.
+     */
+    template<typename FunctionT_>
+    void for_each_in_eviction_order(FunctionT_&& fnc) const
+    {
+        av_list_.for_each(fnc);
+    }
+
+private:
+    /** The available list, its first node is the least recently used. */
+    detail::eviction_list<node_type> av_list_;
+};
+
+}
+
+#endif
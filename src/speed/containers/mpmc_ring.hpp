@@ -0,0 +1,483 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       mpmc_ring.hpp
+ * @brief      mpmc_ring class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_MPMC_RING_HPP
+#define SPEED_CONTAINERS_MPMC_RING_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a bounded lock-free queue for any number of producer and
+ *              consumer threads, in the manner of the Vyukov queue. Every slot has a sequence
+ *              number that tells in which lap it can be filled or emptied, so a thread claims a
+ *              slot with a single compare and swap on the tail or the head and then works on it
+ *              without blocking the other ones. The tail and the head live on their own cache
+ *              lines.
+ */
+template<typename ValueT, typename AllocatorT = std::allocator<ValueT>>
+class mpmc_ring
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The allocator type. */
+    using allocator_type = AllocatorT;
+
+    static_assert(std::is_nothrow_move_constructible_v<value_type>,
+                  "the elements are moved in the slots once claimed, which must not throw");
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       cap : The minimum number of elements, rounded up to a power of two.
+     * @param       alloc : The allocator used to obtain the slots.
+     */
+    explicit mpmc_ring(std::size_t cap, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
+            , cap_(std::bit_ceil(cap > 0 ? cap : 1))
+            , slts_(slot_allocator_traits::allocate(alloc_, cap_))
+    {
+        for (std::size_t i = 0; i < cap_; ++i)
+        {
+            ::new (static_cast<void*>(slts_ + i)) slot();
+            slts_[i].seq_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /** @cond */
+    mpmc_ring(const mpmc_ring& rhs) = delete;
+
+    mpmc_ring(mpmc_ring&& rhs) = delete;
+
+    mpmc_ring& operator =(const mpmc_ring& rhs) = delete;
+
+    mpmc_ring& operator =(mpmc_ring&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Destructor. The elements left in the ring are destroyed.
+     */
+    ~mpmc_ring()
+    {
+        const std::size_t tl = tl_.val_.load(std::memory_order_relaxed);
+
+        for (std::size_t hd = hd_.val_.load(std::memory_order_relaxed); hd != tl; ++hd)
+        {
+            std::destroy_at(slts_[hd & (cap_ - 1)].get_value());
+        }
+
+        std::destroy_n(slts_, cap_);
+        slot_allocator_traits::deallocate(alloc_, slts_, cap_);
+    }
+
+    /**
+     * @brief       Construct an element at the end of the ring. If the element constructor can
+     *              throw the element is built before claiming a slot and then moved in it, since
+     *              a claimed slot has to be filled.
+     * @param       args : The arguments to construct the element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename... Ts_>
+    bool try_emplace(Ts_&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible_v<value_type, Ts_&&...>)
+        {
+            std::size_t tl;
+            slot* const slt = claim_tail_slot(tl);
+
+            if (slt == nullptr)
+            {
+                return false;
+            }
+
+            ::new (static_cast<void*>(slt->get_value())) value_type(std::forward<Ts_>(args)...);
+            slt->seq_.store(tl + 1, std::memory_order_release);
+
+            return true;
+        }
+        else
+        {
+            value_type val(std::forward<Ts_>(args)...);
+
+            return try_emplace(std::move(val));
+        }
+    }
+
+    /**
+     * @brief       Copy an element at the end of the ring.
+     * @param       val : The element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool try_push(const value_type& val)
+    {
+        return try_emplace(val);
+    }
+
+    /**
+     * @brief       Move an element at the end of the ring.
+     * @param       val : The element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool try_push(value_type&& val)
+    {
+        return try_emplace(std::move(val));
+    }
+
+    /**
+     * @brief       Push as many elements of a span as there are consecutive free slots, claiming
+     *              them all with a single compare and swap. The elements of a mutable span are
+     *              moved, the other ones are copied. If that can throw they are pushed one by
+     *              one.
+     * @param       vals : The elements.
+     * @return      The number of pushed elements, taken from the front of the span.
+     */
+    template<typename ValueT_, std::size_t ExtentT_>
+    std::size_t try_push_bulk(std::span<ValueT_, ExtentT_> vals)
+    {
+        if constexpr (!std::is_nothrow_constructible_v<value_type, ValueT_&&>)
+        {
+            std::size_t n_vals = 0;
+
+            while (n_vals < vals.size() && try_emplace(std::forward<ValueT_>(vals[n_vals])))
+            {
+                ++n_vals;
+            }
+
+            return n_vals;
+        }
+
+        std::size_t tl = tl_.val_.load(std::memory_order_relaxed);
+        std::size_t n_vals;
+
+        do
+        {
+            n_vals = count_ready_slots(tl, 0, vals.size());
+
+            if (n_vals == 0)
+            {
+                const auto dif = static_cast<std::intptr_t>(
+                        slts_[tl & (cap_ - 1)].seq_.load(std::memory_order_acquire) - tl);
+
+                if (dif < 0 || vals.empty())
+                {
+                    return 0;
+                }
+
+                tl = tl_.val_.load(std::memory_order_relaxed);
+                continue;
+            }
+
+        } while (n_vals == 0 ||
+                 !tl_.val_.compare_exchange_weak(tl, tl + n_vals, std::memory_order_relaxed));
+
+        for (std::size_t i = 0; i < n_vals; ++i)
+        {
+            slot& slt = slts_[(tl + i) & (cap_ - 1)];
+
+            ::new (static_cast<void*>(slt.get_value())) value_type(
+                    std::forward<ValueT_>(vals[i]));
+            slt.seq_.store(tl + i + 1, std::memory_order_release);
+        }
+
+        return n_vals;
+    }
+
+    /**
+     * @brief       Move the first element of the ring out of it.
+     * @param       val : The object in which move the element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool try_pop(value_type& val)
+    {
+        std::size_t hd = hd_.val_.load(std::memory_order_relaxed);
+        slot* slt;
+
+        for (;;)
+        {
+            slt = &slts_[hd & (cap_ - 1)];
+            const auto dif = static_cast<std::intptr_t>(
+                    slt->seq_.load(std::memory_order_acquire) - (hd + 1));
+
+            if (dif == 0)
+            {
+                if (hd_.val_.compare_exchange_weak(hd, hd + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (dif < 0)
+            {
+                return false;
+            }
+            else
+            {
+                hd = hd_.val_.load(std::memory_order_relaxed);
+            }
+        }
+
+        release_slot(*slt, hd, val);
+
+        return true;
+    }
+
+    /**
+     * @brief       Move as many elements as there are in consecutive filled slots out of the
+     *              ring, claiming them all with a single compare and swap.
+     * @param       vals : The objects in which move the elements.
+     * @return      The number of popped elements, stored at the front of the span.
+     */
+    std::size_t try_pop_bulk(std::span<value_type> vals)
+    {
+        std::size_t hd = hd_.val_.load(std::memory_order_relaxed);
+        std::size_t n_vals;
+
+        do
+        {
+            n_vals = count_ready_slots(hd, 1, vals.size());
+
+            if (n_vals == 0)
+            {
+                const auto dif = static_cast<std::intptr_t>(
+                        slts_[hd & (cap_ - 1)].seq_.load(std::memory_order_acquire) - (hd + 1));
+
+                if (dif < 0 || vals.empty())
+                {
+                    return 0;
+                }
+
+                hd = hd_.val_.load(std::memory_order_relaxed);
+                continue;
+            }
+
+        } while (n_vals == 0 ||
+                 !hd_.val_.compare_exchange_weak(hd, hd + n_vals, std::memory_order_relaxed));
+
+        for (std::size_t i = 0; i < n_vals; ++i)
+        {
+            release_slot(slts_[(hd + i) & (cap_ - 1)], hd + i, vals[i]);
+        }
+
+        return n_vals;
+    }
+
+    /**
+     * @brief       Allows knowing whether the ring holds no element. The answer can be outdated
+     *              when other threads use the ring.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_empty() const noexcept
+    {
+        return get_count() == 0;
+    }
+
+    /**
+     * @brief       Get the number of elements in the ring, counting the ones being pushed or
+     *              popped. The answer can be outdated when other threads use the ring.
+     * @return      The number of elements in the ring.
+     */
+    [[nodiscard]] std::size_t get_count() const noexcept
+    {
+        const std::size_t hd = hd_.val_.load(std::memory_order_acquire);
+        const std::size_t tl = tl_.val_.load(std::memory_order_acquire);
+
+        return tl > hd ? tl - hd : 0;
+    }
+
+    /**
+     * @brief       Get the number of elements that the ring can hold.
+     * @return      The number of elements that the ring can hold.
+     */
+    [[nodiscard]] std::size_t get_capacity() const noexcept
+    {
+        return cap_;
+    }
+
+private:
+    /** Size of a cache line, used to keep the indexes from sharing lines. */
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @brief       Struct that represents a slot of the ring.
+     */
+    struct slot
+    {
+        /**
+         * The lap of the slot. It equals the tail index when the slot can be filled and the
+         * head index plus one when it can be emptied.
+         */
+        std::atomic<std::size_t> seq_;
+
+        /** The storage of the element. */
+        alignas(value_type) std::byte val_stg_[sizeof(value_type)];
+
+        /**
+         * @brief       Get the element address.
+         * @return      The element address.
+         */
+        value_type* get_value() noexcept
+        {
+            return std::launder(reinterpret_cast<value_type*>(val_stg_));
+        }
+    };
+
+    /**
+     * @brief       Struct that represents an index alone in its cache line.
+     */
+    struct alignas(CACHE_LINE_SIZE) ring_index
+    {
+        /** The index value. */
+        std::atomic<std::size_t> val_ = 0;
+    };
+
+    /** The allocator of the slots. */
+    using slot_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<slot>;
+
+    /** The slot allocator traits. */
+    using slot_allocator_traits = std::allocator_traits<slot_allocator_type>;
+
+    /**
+     * @brief       Claim the slot at the tail of the ring.
+     * @param       tl : The tail index of the claimed slot.
+     * @return      If function was successful the claimed slot is returned, otherwise nullptr is
+     *              returned.
+     */
+    slot* claim_tail_slot(std::size_t& tl) noexcept
+    {
+        slot* slt;
+
+        tl = tl_.val_.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            slt = &slts_[tl & (cap_ - 1)];
+            const auto dif = static_cast<std::intptr_t>(
+                    slt->seq_.load(std::memory_order_acquire) - tl);
+
+            if (dif == 0)
+            {
+                if (tl_.val_.compare_exchange_weak(tl, tl + 1, std::memory_order_relaxed))
+                {
+                    return slt;
+                }
+            }
+            else if (dif < 0)
+            {
+                return nullptr;
+            }
+            else
+            {
+                tl = tl_.val_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief       Count the slots that are ready, starting from an index, for a lap.
+     * @param       idx : The index of the first slot.
+     * @param       lap_offs : Zero to count the slots that can be filled, one to count the ones
+     *              that can be emptied.
+     * @param       max_n_slts : The greatest number of slots to count.
+     * @return      The number of consecutive ready slots.
+     */
+    std::size_t count_ready_slots(
+            std::size_t idx,
+            std::size_t lap_offs,
+            std::size_t max_n_slts
+    ) const noexcept
+    {
+        std::size_t n_slts = 0;
+
+        if (max_n_slts > cap_)
+        {
+            max_n_slts = cap_;
+        }
+
+        while (n_slts < max_n_slts &&
+               slts_[(idx + n_slts) & (cap_ - 1)].seq_.load(std::memory_order_acquire) ==
+                       idx + n_slts + lap_offs)
+        {
+            ++n_slts;
+        }
+
+        return n_slts;
+    }
+
+    /**
+     * @brief       Move the element of a claimed slot out of it and make the slot available for
+     *              the next lap.
+     * @param       slt : The slot.
+     * @param       hd : The head index of the slot.
+     * @param       val : The object in which move the element.
+     */
+    void release_slot(slot& slt, std::size_t hd, value_type& val)
+    {
+        value_type* const slt_val = slt.get_value();
+
+        try
+        {
+            val = std::move(*slt_val);
+        }
+        catch (...)
+        {
+            std::destroy_at(slt_val);
+            slt.seq_.store(hd + cap_, std::memory_order_release);
+            throw;
+        }
+
+        std::destroy_at(slt_val);
+        slt.seq_.store(hd + cap_, std::memory_order_release);
+    }
+
+    /** The allocator of the slots. */
+    [[no_unique_address]] slot_allocator_type alloc_;
+
+    /** The number of slots, a power of two. */
+    const std::size_t cap_;
+
+    /** The slots. */
+    slot* const slts_;
+
+    /** The index of the next slot to fill. */
+    ring_index tl_;
+
+    /** The index of the next slot to empty. */
+    ring_index hd_;
+};
+
+}
+
+#endif
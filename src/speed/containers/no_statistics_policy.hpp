@@ -0,0 +1,113 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       no_statistics_policy.hpp
+ * @brief      no_statistics_policy class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_NO_STATISTICS_POLICY_HPP
+#define SPEED_CONTAINERS_NO_STATISTICS_POLICY_HPP
+
+#include <cstddef>
+
+#include "statistics_policy.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents the statistics policy that records nothing. It is empty and
+ *              all its members do nothing, so a cache that uses it pays neither memory nor time.
+ */
+class no_statistics_policy
+{
+public:
+    /**
+     * @brief       Notify that a lookup found its key.
+     */
+    static constexpr void on_hit() noexcept
+    {
+    }
+
+    /**
+     * @brief       Notify that a lookup didn't find its key.
+     */
+    static constexpr void on_miss() noexcept
+    {
+    }
+
+    /**
+     * @brief       Notify that an element has been inserted.
+     */
+    static constexpr void on_insert() noexcept
+    {
+    }
+
+    /**
+     * @brief       Notify that an element has been evicted.
+     */
+    static constexpr void on_eviction() noexcept
+    {
+    }
+
+    /**
+     * @brief       Notify that an element has been locked.
+     */
+    static constexpr void on_lock() noexcept
+    {
+    }
+
+    /**
+     * @brief       Notify that an element has been unlocked.
+     */
+    static constexpr void on_unlock() noexcept
+    {
+    }
+
+    /**
+     * @brief       Notify that an operation failed because all the elements were locked.
+     */
+    static constexpr void on_exhausted() noexcept
+    {
+    }
+
+    /**
+     * @brief       Notify that a hash buffer list has been walked.
+     * @param       n_prbs : The number of keys compared.
+     */
+    static constexpr void on_probe(std::size_t n_prbs) noexcept
+    {
+        (void)n_prbs;
+    }
+
+    /**
+     * @brief       Get the statistics recorded.
+     * @return      Empty statistics.
+     */
+    [[nodiscard]] static constexpr cache_statistics snapshot() noexcept
+    {
+        return {};
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,317 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       s3_fifo_eviction_policy.hpp
+ * @brief      s3_fifo_eviction_policy class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_S3_FIFO_EVICTION_POLICY_HPP
+#define SPEED_CONTAINERS_S3_FIFO_EVICTION_POLICY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "detail/eviction_list.hpp"
+#include "detail/ghost_list.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents an S3-FIFO eviction policy. New keys enter a small FIFO
+ *              queue that holds 10% of the nodes, and the ones that get a hit before leaving it
+ *              move to the main FIFO queue instead of being evicted. The main queue reinserts the
+ *              nodes that got a hit since they were last considered. The hashes of the keys
+ *              evicted from the small queue are remembered in a ghost queue and those keys enter
+ *              the main queue directly when they come back. A hit only increments a small atomic
+ *              counter, so several readers can record hits at once. The victim is chosen when it
+ *              is requested, so a hit on it before the next insertion doesn't save it.
+ */
+template<typename NodeT>
+class s3_fifo_eviction_policy
+{
+public:
+    /** The node type. */
+    using node_type = NodeT;
+
+    /** Whether on_hit can be called by several readers at once. */
+    static constexpr bool CONCURRENT_HITS = true;
+
+    /** The greatest value of the hit counter of a node. */
+    static constexpr std::uint8_t MAX_FREQUENCY = 3;
+
+    /**
+     * @brief       Contains the queues in which a node can be.
+     */
+    enum class segment : std::uint8_t
+    {
+        /** The node doesn't hold any key. */
+        FREE,
+
+        /** The node is in the small queue. */
+        SMALL,
+
+        /** The node is in the main queue. */
+        MAIN
+    };
+
+    /**
+     * @brief       Struct that represents the state kept in every node.
+     */
+    struct hook_type
+    {
+        /** Pointer to the next node in the queue. */
+        node_type* av_nxt_;
+
+        /** Pointer to the previous node in the queue. */
+        node_type* av_prev_;
+
+        /** The hash of the node key. */
+        std::size_t hsh_;
+
+        /** The queue of the node. */
+        segment sgmt_;
+
+        /** The number of hits since the node was last considered for eviction. */
+        std::atomic<std::uint8_t> freq_ = 0;
+    };
+
+    /**
+     * @brief       Make the specified nodes free and available.
+     * @param       nds : The first node.
+     * @param       n_nds : The number of nodes.
+     */
+    void initialize(node_type* nds, std::size_t n_nds)
+    {
+        free_.clear();
+        small_.clear();
+        main_.clear();
+        small_max_ = n_nds / 10 > 0 ? n_nds / 10 : 1;
+        ghst_.initialize(n_nds > small_max_ ? n_nds - small_max_ : 1);
+        vctm_ = nullptr;
+
+        for (std::size_t i = 0; i < n_nds; i++)
+        {
+            nds[i].plcy_hk_.sgmt_ = segment::FREE;
+            nds[i].plcy_hk_.freq_.store(0, std::memory_order_relaxed);
+            free_.push_back(&nds[i]);
+        }
+    }
+
+    /**
+     * @brief       Get the node to recycle. The small queue is considered while it holds more
+     *              than its share of the nodes, and the main queue otherwise.
+     * @return      The node to recycle, or nullptr if there is no available node.
+     */
+    node_type* get_victim() noexcept
+    {
+        if (!free_.empty())
+        {
+            return free_.front();
+        }
+
+        while (vctm_ == nullptr && (!small_.empty() || !main_.empty()))
+        {
+            if (!small_.empty() && (small_.size() >= small_max_ || main_.empty()))
+            {
+                node_type* const nd = small_.front();
+
+                if (nd->plcy_hk_.freq_.load(std::memory_order_relaxed) > 0)
+                {
+                    small_.erase(nd);
+                    nd->plcy_hk_.freq_.store(0, std::memory_order_relaxed);
+                    nd->plcy_hk_.sgmt_ = segment::MAIN;
+                    main_.push_back(nd);
+                }
+                else
+                {
+                    vctm_ = nd;
+                }
+            }
+            else
+            {
+                node_type* const nd = main_.front();
+                const std::uint8_t freq = nd->plcy_hk_.freq_.load(std::memory_order_relaxed);
+
+                if (freq > 0)
+                {
+                    nd->plcy_hk_.freq_.store(freq - 1, std::memory_order_relaxed);
+                    main_.move_to_back(nd);
+                }
+                else
+                {
+                    vctm_ = nd;
+                }
+            }
+        }
+
+        return vctm_;
+    }
+
+    /**
+     * @brief       Notify that the victim holds a new key. The hash of a key evicted from the
+     *              small queue goes to the ghost queue. The new key enters the main queue if its
+     *              hash is in the ghost queue, and the small queue otherwise.
+     * @param       nd : The victim.
+     * @param       hsh : The hash of the new key.
+     */
+    void on_insert(node_type* nd, std::size_t hsh) noexcept
+    {
+        switch (nd->plcy_hk_.sgmt_)
+        {
+            case segment::SMALL:
+                small_.erase(nd);
+                ghst_.push_back(nd->plcy_hk_.hsh_);
+                break;
+
+            case segment::MAIN:
+                main_.erase(nd);
+                break;
+
+            default:
+                free_.erase(nd);
+                break;
+        }
+
+        vctm_ = nullptr;
+        nd->plcy_hk_.hsh_ = hsh;
+        nd->plcy_hk_.freq_.store(0, std::memory_order_relaxed);
+
+        if (ghst_.erase(hsh))
+        {
+            nd->plcy_hk_.sgmt_ = segment::MAIN;
+            main_.push_back(nd);
+        }
+        else
+        {
+            nd->plcy_hk_.sgmt_ = segment::SMALL;
+            small_.push_back(nd);
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been found.
+     * @param       nd : The node found.
+     */
+    void on_hit(node_type* nd) noexcept
+    {
+        const std::uint8_t freq = nd->plcy_hk_.freq_.load(std::memory_order_relaxed);
+
+        if (freq < MAX_FREQUENCY)
+        {
+            nd->plcy_hk_.freq_.store(freq + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been locked.
+     * @param       nd : The node locked.
+     */
+    void on_lock(node_type* nd) noexcept
+    {
+        vctm_ = nullptr;
+        get_segment_list(nd->plcy_hk_.sgmt_).erase(nd);
+    }
+
+    /**
+     * @brief       Notify that a locked node has been unlocked.
+     * @param       nd : The node unlocked.
+     */
+    void on_unlock(node_type* nd) noexcept
+    {
+        get_segment_list(nd->plcy_hk_.sgmt_).push_back(nd);
+    }
+
+    /**
+     * @brief       Notify that an available node no longer holds a key. It becomes free, so it is
+     *              the next one to be recycled.
+     * @param       nd : The node erased.
+     */
+    void on_erase(node_type* nd) noexcept
+    {
+        vctm_ = nullptr;
+        get_segment_list(nd->plcy_hk_.sgmt_).erase(nd);
+        nd->plcy_hk_.sgmt_ = segment::FREE;
+        free_.push_back(nd);
+    }
+
+    /**
+     * @brief       Call a function on every available node without modifying the policy. The free
+     *              nodes come first, followed by the small queue and the main queue, each one from
+     *              its oldest node.
+     * @param       fnc : The function to call.
+     */
+    template<typename FunctionT_>
+    void for_each_in_eviction_order(FunctionT_&& fnc) const
+    {
+        free_.for_each(fnc);
+        small_.for_each(fnc);
+        main_.for_each(fnc);
+    }
+
+protected:
+    /** The list type. */
+    using list_type = detail::eviction_list<node_type>;
+
+    /**
+     * @brief       Get the list of a segment.
+     * @param       sgmt : The segment.
+     * @return      The list of the segment.
+     */
+    list_type& get_segment_list(segment sgmt) noexcept
+    {
+        switch (sgmt)
+        {
+            case segment::SMALL:
+                return small_;
+
+            case segment::MAIN:
+                return main_;
+
+            default:
+                return free_;
+        }
+    }
+
+private:
+    /** The nodes that don't hold any key. */
+    list_type free_;
+
+    /** The small queue. */
+    list_type small_;
+
+    /** The main queue. */
+    list_type main_;
+
+    /** The hashes of the keys evicted from the small queue. */
+    detail::ghost_list ghst_;
+
+    /** The number of nodes above which the small queue is considered for eviction. */
+    std::size_t small_max_ = 1;
+
+    /** The victim chosen by the last call to get_victim. */
+    node_type* vctm_ = nullptr;
+};
+
+}
+
+#endif
@@ -0,0 +1,316 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       sharded_statistics_policy.hpp
+ * @brief      sharded_statistics_policy class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_SHARDED_STATISTICS_POLICY_HPP
+#define SPEED_CONTAINERS_SHARDED_STATISTICS_POLICY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "statistics_policy.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents the statistics policy that counts every event. The counters
+ *              are spread over shards that live in their own cache lines. Every thread claims a
+ *              shard of its own the first time it counts and keeps it until it exits, so it can
+ *              increment its counters with a plain load and store instead of a locked operation.
+ *              The threads that find no shard left share an overflow shard that is incremented
+ *              atomically. A snapshot sums all the shards, it is consistent per counter but not
+ *              across them.
+ */
+class sharded_statistics_policy
+{
+public:
+    /** The number of counter shards that threads can claim. */
+    static constexpr std::size_t N_SHARDS = 16;
+
+    /**
+     * @brief       Default constructor.
+     */
+    sharded_statistics_policy() noexcept = default;
+
+    /** @cond */
+    sharded_statistics_policy(const sharded_statistics_policy& rhs) = delete;
+
+    sharded_statistics_policy(sharded_statistics_policy&& rhs) = delete;
+
+    sharded_statistics_policy& operator =(const sharded_statistics_policy& rhs) = delete;
+
+    sharded_statistics_policy& operator =(sharded_statistics_policy&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Notify that a lookup found its key.
+     */
+    void on_hit() noexcept
+    {
+        increment(&shard::n_hits_);
+    }
+
+    /**
+     * @brief       Notify that a lookup didn't find its key.
+     */
+    void on_miss() noexcept
+    {
+        increment(&shard::n_misses_);
+    }
+
+    /**
+     * @brief       Notify that an element has been inserted.
+     */
+    void on_insert() noexcept
+    {
+        increment(&shard::n_inserts_);
+    }
+
+    /**
+     * @brief       Notify that an element has been evicted.
+     */
+    void on_eviction() noexcept
+    {
+        increment(&shard::n_evictions_);
+    }
+
+    /**
+     * @brief       Notify that an element has been locked.
+     */
+    void on_lock() noexcept
+    {
+        increment(&shard::n_locks_);
+    }
+
+    /**
+     * @brief       Notify that an element has been unlocked.
+     */
+    void on_unlock() noexcept
+    {
+        increment(&shard::n_unlocks_);
+    }
+
+    /**
+     * @brief       Notify that an operation failed because all the elements were locked.
+     */
+    void on_exhausted() noexcept
+    {
+        increment(&shard::n_exhausted_);
+    }
+
+    /**
+     * @brief       Notify that a hash buffer list has been walked.
+     * @param       n_prbs : The number of keys compared.
+     */
+    void on_probe(std::size_t n_prbs) noexcept
+    {
+        const std::size_t bckt = std::min(n_prbs, cache_statistics::N_PROBE_BUCKETS - 1);
+        const shard_claim& clm = get_shard_claim();
+
+        increment(shrds_[clm.idx_].prb_lens_[bckt], clm.exclsv_);
+    }
+
+    /**
+     * @brief       Get the statistics recorded.
+     * @return      The sum of the statistics recorded by all the shards.
+     */
+    [[nodiscard]] cache_statistics snapshot() const noexcept
+    {
+        cache_statistics stats;
+
+        for (const auto& shrd : shrds_)
+        {
+            stats.n_hits_ += shrd.n_hits_.load(std::memory_order_relaxed);
+            stats.n_misses_ += shrd.n_misses_.load(std::memory_order_relaxed);
+            stats.n_inserts_ += shrd.n_inserts_.load(std::memory_order_relaxed);
+            stats.n_evictions_ += shrd.n_evictions_.load(std::memory_order_relaxed);
+            stats.n_locks_ += shrd.n_locks_.load(std::memory_order_relaxed);
+            stats.n_unlocks_ += shrd.n_unlocks_.load(std::memory_order_relaxed);
+            stats.n_exhausted_ += shrd.n_exhausted_.load(std::memory_order_relaxed);
+
+            for (std::size_t i = 0; i < cache_statistics::N_PROBE_BUCKETS; ++i)
+            {
+                stats.prb_lens_[i] += shrd.prb_lens_[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        return stats;
+    }
+
+private:
+    /** Size of a cache line, used to keep the shards from sharing lines. */
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @brief       Struct that represents the counters of a shard.
+     */
+    struct alignas(CACHE_LINE_SIZE) shard
+    {
+        /** The number of hits. */
+        std::atomic<std::uint64_t> n_hits_ = 0;
+
+        /** The number of misses. */
+        std::atomic<std::uint64_t> n_misses_ = 0;
+
+        /** The number of inserts. */
+        std::atomic<std::uint64_t> n_inserts_ = 0;
+
+        /** The number of evictions. */
+        std::atomic<std::uint64_t> n_evictions_ = 0;
+
+        /** The number of locks. */
+        std::atomic<std::uint64_t> n_locks_ = 0;
+
+        /** The number of unlocks. */
+        std::atomic<std::uint64_t> n_unlocks_ = 0;
+
+        /** The number of exhausted resources failures. */
+        std::atomic<std::uint64_t> n_exhausted_ = 0;
+
+        /** The probe length histogram. */
+        std::atomic<std::uint64_t> prb_lens_[cache_statistics::N_PROBE_BUCKETS] = {};
+    };
+
+    /**
+     * @brief       Struct that represents the shard claimed by a thread. The claims are shared by
+     *              all the policies, a thread uses the same shard index in all of them.
+     */
+    struct shard_claim
+    {
+        /**
+         * @brief       Default constructor, it claims the first shard that isn't claimed, or the
+         *              overflow shard if there is none.
+         */
+        shard_claim() noexcept
+        {
+            std::uint64_t clmd = get_claimed_shards().load(std::memory_order_relaxed);
+
+            while (clmd != FULL_CLAIM_MASK)
+            {
+                const auto idx = static_cast<std::size_t>(std::countr_one(clmd));
+
+                if (get_claimed_shards().compare_exchange_weak(
+                        clmd, clmd | (std::uint64_t(1) << idx), std::memory_order_acquire,
+                        std::memory_order_relaxed))
+                {
+                    idx_ = idx;
+                    exclsv_ = true;
+                    return;
+                }
+            }
+        }
+
+        /** @cond */
+        shard_claim(const shard_claim& rhs) = delete;
+
+        shard_claim& operator =(const shard_claim& rhs) = delete;
+        /** @endcond */
+
+        /**
+         * @brief       Destructor, it releases the shard so another thread can claim it.
+         */
+        ~shard_claim()
+        {
+            if (exclsv_)
+            {
+                get_claimed_shards().fetch_and(
+                        ~(std::uint64_t(1) << idx_), std::memory_order_release);
+            }
+        }
+
+        /** The index of the shard. */
+        std::size_t idx_ = N_SHARDS;
+
+        /** Whether the shard belongs only to the thread. */
+        bool exclsv_ = false;
+    };
+
+    /** The mask in which all the shards are claimed. */
+    static constexpr std::uint64_t FULL_CLAIM_MASK = (std::uint64_t(1) << N_SHARDS) - 1;
+
+    static_assert(N_SHARDS < 64, "the claims have to fit in a mask");
+
+    /**
+     * @brief       Get the mask of the shards claimed by the threads.
+     * @return      The mask of the shards claimed by the threads.
+     */
+    static std::atomic<std::uint64_t>& get_claimed_shards() noexcept
+    {
+        static std::atomic<std::uint64_t> clmd = 0;
+
+        return clmd;
+    }
+
+    /**
+     * @brief       Get the shard claimed by the calling thread.
+     * @return      The shard claimed by the calling thread.
+     */
+    static const shard_claim& get_shard_claim() noexcept
+    {
+        thread_local const shard_claim clm;
+
+        return clm;
+    }
+
+    /**
+     * @brief       Increment a counter. A counter of a claimed shard is only written by its
+     *              thread, so it is incremented through a relaxed load and store that any thread
+     *              can read at any time, while the overflow shard needs an atomic increment.
+     * @param       cntr : The counter to increment.
+     * @param       exclsv : Whether the counter belongs only to the calling thread.
+     */
+    static void increment(std::atomic<std::uint64_t>& cntr, bool exclsv) noexcept
+    {
+        if (exclsv)
+        {
+            cntr.store(cntr.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        else
+        {
+            cntr.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief       Increment a counter of the shard claimed by the calling thread.
+     * @param       cntr : The counter to increment.
+     */
+    void increment(std::atomic<std::uint64_t> shard::* cntr) noexcept
+    {
+        const shard_claim& clm = get_shard_claim();
+
+        increment(shrds_[clm.idx_].*cntr, clm.exclsv_);
+    }
+
+    /** The counter shards that threads can claim followed by the overflow shard. */
+    shard shrds_[N_SHARDS + 1];
+};
+
+}
+
+#endif
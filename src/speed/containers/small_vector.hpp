@@ -0,0 +1,1167 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       small_vector.hpp
+ * @brief      small_vector class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_SMALL_VECTOR_HPP
+#define SPEED_CONTAINERS_SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "exception.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a vector that holds up to N elements in a buffer placed
+ *              inside the object, so short sequences don't allocate. When the buffer is exceeded
+ *              the elements are relocated to storage obtained from the allocator, and from then on
+ *              it behaves like a std::vector. Unlike std::vector, moving a vector whose elements
+ *              are held in its buffer moves the elements one by one, so it invalidates the
+ *              iterators.
+ */
+template<typename ValueT, std::size_t N, typename AllocatorT = std::allocator<ValueT>>
+class small_vector
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The allocator type. */
+    using allocator_type = typename std::allocator_traits<AllocatorT>::template rebind_alloc<
+            value_type>;
+
+    /** The size type. */
+    using size_type = std::size_t;
+
+    /** The difference type. */
+    using difference_type = std::ptrdiff_t;
+
+    /** The reference type. */
+    using reference = value_type&;
+
+    /** The const reference type. */
+    using const_reference = const value_type&;
+
+    /** The pointer type. */
+    using pointer = value_type*;
+
+    /** The const pointer type. */
+    using const_pointer = const value_type*;
+
+    /** The iterator type. */
+    using iterator = value_type*;
+
+    /** The const iterator type. */
+    using const_iterator = const value_type*;
+
+    /** The reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /** The const reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /** The number of elements that fit in the buffer placed inside the object. */
+    static constexpr size_type INLINE_CAPACITY = N;
+
+    /**
+     * @brief       Default constructor.
+     */
+    small_vector() noexcept(noexcept(allocator_type()))
+            : small_vector(allocator_type())
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       alloc : The allocator used when the elements don't fit in the object.
+     */
+    explicit small_vector(const allocator_type& alloc) noexcept
+            : alloc_(alloc)
+            , dat_(get_inline_data())
+            , sz_(0)
+            , cap_(N)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       n_elems : The number of value initialized elements.
+     * @param       alloc : The allocator used when the elements don't fit in the object.
+     */
+    explicit small_vector(size_type n_elems, const allocator_type& alloc = allocator_type())
+            : small_vector(alloc)
+    {
+        resize(n_elems);
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       n_elems : The number of elements.
+     * @param       val : The value copied in every element.
+     * @param       alloc : The allocator used when the elements don't fit in the object.
+     */
+    small_vector(
+            size_type n_elems,
+            const value_type& val,
+            const allocator_type& alloc = allocator_type()
+    )
+            : small_vector(alloc)
+    {
+        insert(end(), n_elems, val);
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       first : The first element of the range to copy.
+     * @param       last : The end of the range to copy.
+     * @param       alloc : The allocator used when the elements don't fit in the object.
+     */
+    template<std::input_iterator InputIteratorT_>
+    small_vector(
+            InputIteratorT_ first,
+            InputIteratorT_ last,
+            const allocator_type& alloc = allocator_type()
+    )
+            : small_vector(alloc)
+    {
+        insert(end(), first, last);
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       il : The elements to copy.
+     * @param       alloc : The allocator used when the elements don't fit in the object.
+     */
+    small_vector(
+            std::initializer_list<value_type> il,
+            const allocator_type& alloc = allocator_type()
+    )
+            : small_vector(alloc)
+    {
+        insert(end(), il.begin(), il.end());
+    }
+
+    /**
+     * @brief       Copy constructor.
+     * @param       rhs : Object to copy.
+     */
+    small_vector(const small_vector& rhs)
+            : small_vector(rhs, allocator_traits::select_on_container_copy_construction(
+                    rhs.alloc_))
+    {
+    }
+
+    /**
+     * @brief       Copy constructor with parameters.
+     * @param       rhs : Object to copy.
+     * @param       alloc : The allocator used when the elements don't fit in the object.
+     */
+    small_vector(const small_vector& rhs, const allocator_type& alloc)
+            : small_vector(alloc)
+    {
+        insert(end(), rhs.begin(), rhs.end());
+    }
+
+    /**
+     * @brief       Move constructor. The storage obtained from the allocator is taken over, while
+     *              the elements held inside rhs are moved one by one. rhs is left empty.
+     * @param       rhs : Object to move.
+     */
+    small_vector(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+            : small_vector(rhs.alloc_)
+    {
+        take_elements(rhs);
+    }
+
+    /**
+     * @brief       Move constructor with parameters. If the allocators are different the elements
+     *              are moved one by one. rhs is left empty.
+     * @param       rhs : Object to move.
+     * @param       alloc : The allocator used when the elements don't fit in the object.
+     */
+    small_vector(small_vector&& rhs, const allocator_type& alloc)
+            : small_vector(alloc)
+    {
+        if (alloc_ == rhs.alloc_)
+        {
+            take_elements(rhs);
+        }
+        else
+        {
+            insert(end(), std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+            rhs.clear();
+        }
+    }
+
+    /**
+     * @brief       Destructor.
+     */
+    ~small_vector()
+    {
+        clear();
+        release_storage();
+    }
+
+    /**
+     * @brief       Copy assignment operator.
+     * @param       rhs : Object to copy.
+     * @return      The object who call the method.
+     */
+    small_vector& operator =(const small_vector& rhs)
+    {
+        if (this == &rhs)
+        {
+            return *this;
+        }
+
+        if constexpr (allocator_traits::propagate_on_container_copy_assignment::value)
+        {
+            if (alloc_ != rhs.alloc_)
+            {
+                clear();
+                release_storage();
+            }
+
+            alloc_ = rhs.alloc_;
+        }
+
+        assign(rhs.begin(), rhs.end());
+
+        return *this;
+    }
+
+    /**
+     * @brief       Move assignment operator. The storage obtained from the allocator is taken over
+     *              when the allocators allow it, otherwise the elements are moved one by one. rhs
+     *              is left empty.
+     * @param       rhs : Object to move.
+     * @return      The object who call the method.
+     */
+    small_vector& operator =(small_vector&& rhs) noexcept(
+            std::is_nothrow_move_constructible_v<value_type> &&
+            (allocator_traits::propagate_on_container_move_assignment::value ||
+             allocator_traits::is_always_equal::value))
+    {
+        if (this == &rhs)
+        {
+            return *this;
+        }
+
+        clear();
+
+        if constexpr (allocator_traits::propagate_on_container_move_assignment::value)
+        {
+            release_storage();
+            alloc_ = std::move(rhs.alloc_);
+            take_elements(rhs);
+        }
+        else if (alloc_ == rhs.alloc_)
+        {
+            release_storage();
+            take_elements(rhs);
+        }
+        else
+        {
+            insert(end(), std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+            rhs.clear();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief       Assignment operator.
+     * @param       il : The elements to copy.
+     * @return      The object who call the method.
+     */
+    small_vector& operator =(std::initializer_list<value_type> il)
+    {
+        assign(il.begin(), il.end());
+
+        return *this;
+    }
+
+    /**
+     * @brief       Replace the elements with copies of a value.
+     * @param       n_elems : The number of elements.
+     * @param       val : The value copied in every element, which can't be one of the elements.
+     */
+    void assign(size_type n_elems, const value_type& val)
+    {
+        clear();
+        insert(end(), n_elems, val);
+    }
+
+    /**
+     * @brief       Replace the elements with the elements of a range.
+     * @param       first : The first element of the range, which can't be in the vector.
+     * @param       last : The end of the range.
+     */
+    template<std::input_iterator InputIteratorT_>
+    void assign(InputIteratorT_ first, InputIteratorT_ last)
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    /**
+     * @brief       Replace the elements with the elements of an initializer list.
+     * @param       il : The elements to copy.
+     */
+    void assign(std::initializer_list<value_type> il)
+    {
+        assign(il.begin(), il.end());
+    }
+
+    /**
+     * @brief       Get the allocator.
+     * @return      The allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return alloc_;
+    }
+
+    /**
+     * @brief       Get an element checking the bounds.
+     * @param       indx : The index of the element.
+     * @return      The element.
+     * @throw       out_of_range_exception : If the index is not smaller than the size.
+     */
+    [[nodiscard]] reference at(size_type indx)
+    {
+        if (indx >= sz_)
+        {
+            throw out_of_range_exception();
+        }
+
+        return dat_[indx];
+    }
+
+    /**
+     * @brief       Get an element checking the bounds.
+     * @param       indx : The index of the element.
+     * @return      The element.
+     * @throw       out_of_range_exception : If the index is not smaller than the size.
+     */
+    [[nodiscard]] const_reference at(size_type indx) const
+    {
+        if (indx >= sz_)
+        {
+            throw out_of_range_exception();
+        }
+
+        return dat_[indx];
+    }
+
+    /**
+     * @brief       Get an element.
+     * @param       indx : The index of the element.
+     * @return      The element.
+     */
+    [[nodiscard]] reference operator [](size_type indx) noexcept
+    {
+        return dat_[indx];
+    }
+
+    /**
+     * @brief       Get an element.
+     * @param       indx : The index of the element.
+     * @return      The element.
+     */
+    [[nodiscard]] const_reference operator [](size_type indx) const noexcept
+    {
+        return dat_[indx];
+    }
+
+    /**
+     * @brief       Get the first element.
+     * @return      The first element.
+     */
+    [[nodiscard]] reference front() noexcept
+    {
+        return dat_[0];
+    }
+
+    /**
+     * @brief       Get the first element.
+     * @return      The first element.
+     */
+    [[nodiscard]] const_reference front() const noexcept
+    {
+        return dat_[0];
+    }
+
+    /**
+     * @brief       Get the last element.
+     * @return      The last element.
+     */
+    [[nodiscard]] reference back() noexcept
+    {
+        return dat_[sz_ - 1];
+    }
+
+    /**
+     * @brief       Get the last element.
+     * @return      The last element.
+     */
+    [[nodiscard]] const_reference back() const noexcept
+    {
+        return dat_[sz_ - 1];
+    }
+
+    /**
+     * @brief       Get the contiguous storage of the elements.
+     * @return      The contiguous storage of the elements.
+     */
+    [[nodiscard]] pointer data() noexcept
+    {
+        return dat_;
+    }
+
+    /**
+     * @brief       Get the contiguous storage of the elements.
+     * @return      The contiguous storage of the elements.
+     */
+    [[nodiscard]] const_pointer data() const noexcept
+    {
+        return dat_;
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    iterator begin() noexcept
+    {
+        return dat_;
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    const_iterator begin() const noexcept
+    {
+        return dat_;
+    }
+
+    /**
+     * @brief       Get an iterator to the first element.
+     * @return      An iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept
+    {
+        return dat_;
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    iterator end() noexcept
+    {
+        return dat_ + sz_;
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator end() const noexcept
+    {
+        return dat_ + sz_;
+    }
+
+    /**
+     * @brief       Get an iterator to the end.
+     * @return      An iterator to the end.
+     */
+    const_iterator cend() const noexcept
+    {
+        return dat_ + sz_;
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the last element.
+     * @return      A reverse iterator to the last element.
+     */
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the last element.
+     * @return      A reverse iterator to the last element.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the last element.
+     * @return      A reverse iterator to the last element.
+     */
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the reverse end.
+     * @return      A reverse iterator to the reverse end.
+     */
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the reverse end.
+     * @return      A reverse iterator to the reverse end.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief       Get a reverse iterator to the reverse end.
+     * @return      A reverse iterator to the reverse end.
+     */
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief       Allows knowing whether the vector has no elements.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return sz_ == 0;
+    }
+
+    /**
+     * @brief       Get the number of elements.
+     * @return      The number of elements.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return sz_;
+    }
+
+    /**
+     * @brief       Get the maximum number of elements.
+     * @return      The maximum number of elements.
+     */
+    [[nodiscard]] size_type max_size() const noexcept
+    {
+        return allocator_traits::max_size(alloc_);
+    }
+
+    /**
+     * @brief       Get the number of elements that can be held without reallocating.
+     * @return      The number of elements that can be held without reallocating.
+     */
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return cap_;
+    }
+
+    /**
+     * @brief       Allows knowing whether the elements are held in the buffer placed inside the
+     *              object.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_inline() const noexcept
+    {
+        return dat_ == get_inline_data();
+    }
+
+    /**
+     * @brief       Make room for a number of elements without reallocating.
+     * @param       n_elems : The number of elements.
+     */
+    void reserve(size_type n_elems)
+    {
+        if (n_elems > cap_)
+        {
+            reallocate(n_elems, 0, [](value_type*) {});
+        }
+    }
+
+    /**
+     * @brief       Release the unused capacity, moving the elements back inside the object if
+     *              they fit in it.
+     */
+    void shrink_to_fit()
+    {
+        if (!is_inline() && sz_ < cap_)
+        {
+            reallocate(sz_, 0, [](value_type*) {});
+        }
+    }
+
+    /**
+     * @brief       Destroy all the elements. The capacity is kept.
+     */
+    void clear() noexcept
+    {
+        destroy(dat_, dat_ + sz_);
+        sz_ = 0;
+    }
+
+    /**
+     * @brief       Copy an element before a position.
+     * @param       pos : The position.
+     * @param       val : The element.
+     * @return      An iterator to the inserted element.
+     */
+    iterator insert(const_iterator pos, const value_type& val)
+    {
+        return emplace(pos, val);
+    }
+
+    /**
+     * @brief       Move an element before a position.
+     * @param       pos : The position.
+     * @param       val : The element.
+     * @return      An iterator to the inserted element.
+     */
+    iterator insert(const_iterator pos, value_type&& val)
+    {
+        return emplace(pos, std::move(val));
+    }
+
+    /**
+     * @brief       Insert copies of a value before a position.
+     * @param       pos : The position.
+     * @param       n_elems : The number of elements.
+     * @param       val : The value copied in every element.
+     * @return      An iterator to the first inserted element.
+     */
+    iterator insert(const_iterator pos, size_type n_elems, const value_type& val)
+    {
+        const auto indx = static_cast<size_type>(pos - dat_);
+
+        append_n(n_elems, [&](value_type* dest) { construct(dest, val); });
+
+        return rotate_back(indx, sz_ - n_elems);
+    }
+
+    /**
+     * @brief       Insert the elements of a range before a position.
+     * @param       pos : The position.
+     * @param       first : The first element of the range, which can't be in the vector.
+     * @param       last : The end of the range.
+     * @return      An iterator to the first inserted element.
+     */
+    template<std::input_iterator InputIteratorT_>
+    iterator insert(const_iterator pos, InputIteratorT_ first, InputIteratorT_ last)
+    {
+        const auto indx = static_cast<size_type>(pos - dat_);
+        const size_type old_sz = sz_;
+
+        if constexpr (std::forward_iterator<InputIteratorT_>)
+        {
+            append_n(static_cast<size_type>(std::distance(first, last)), [&](value_type* dest)
+            {
+                construct(dest, *first);
+                ++first;
+            });
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        return rotate_back(indx, old_sz);
+    }
+
+    /**
+     * @brief       Insert the elements of an initializer list before a position.
+     * @param       pos : The position.
+     * @param       il : The elements to copy.
+     * @return      An iterator to the first inserted element.
+     */
+    iterator insert(const_iterator pos, std::initializer_list<value_type> il)
+    {
+        return insert(pos, il.begin(), il.end());
+    }
+
+    /**
+     * @brief       Construct an element before a position.
+     * @param       pos : The position.
+     * @param       args : The arguments to construct the element.
+     * @return      An iterator to the inserted element.
+     */
+    template<typename... Ts_>
+    iterator emplace(const_iterator pos, Ts_&&... args)
+    {
+        const auto indx = static_cast<size_type>(pos - dat_);
+
+        emplace_back(std::forward<Ts_>(args)...);
+
+        return rotate_back(indx, sz_ - 1);
+    }
+
+    /**
+     * @brief       Erase an element.
+     * @param       pos : The element.
+     * @return      An iterator to the element that followed the erased one.
+     */
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    /**
+     * @brief       Erase a range of elements.
+     * @param       first : The first element to erase.
+     * @param       last : The end of the range to erase.
+     * @return      An iterator to the element that followed the erased ones.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        iterator it = dat_ + (first - dat_);
+
+        if (first != last)
+        {
+            iterator new_end = std::move(it + (last - first), end(), it);
+
+            destroy(new_end, end());
+            sz_ = static_cast<size_type>(new_end - dat_);
+        }
+
+        return it;
+    }
+
+    /**
+     * @brief       Copy an element at the end.
+     * @param       val : The element.
+     */
+    void push_back(const value_type& val)
+    {
+        emplace_back(val);
+    }
+
+    /**
+     * @brief       Move an element at the end.
+     * @param       val : The element.
+     */
+    void push_back(value_type&& val)
+    {
+        emplace_back(std::move(val));
+    }
+
+    /**
+     * @brief       Construct an element at the end. The arguments can refer to elements of the
+     *              vector.
+     * @param       args : The arguments to construct the element.
+     * @return      The inserted element.
+     */
+    template<typename... Ts_>
+    reference emplace_back(Ts_&&... args)
+    {
+        if (sz_ < cap_)
+        {
+            construct(dat_ + sz_, std::forward<Ts_>(args)...);
+            ++sz_;
+        }
+        else
+        {
+            reallocate(get_next_capacity(sz_ + 1), 1, [&](value_type* dest)
+            {
+                construct(dest, std::forward<Ts_>(args)...);
+            });
+        }
+
+        return back();
+    }
+
+    /**
+     * @brief       Destroy the last element.
+     */
+    void pop_back() noexcept
+    {
+        --sz_;
+        destroy(dat_ + sz_, dat_ + sz_ + 1);
+    }
+
+    /**
+     * @brief       Change the number of elements, value initializing the new ones.
+     * @param       n_elems : The number of elements.
+     */
+    void resize(size_type n_elems)
+    {
+        if (n_elems < sz_)
+        {
+            destroy(dat_ + n_elems, dat_ + sz_);
+            sz_ = n_elems;
+        }
+        else
+        {
+            append_n(n_elems - sz_, [&](value_type* dest) { construct(dest); });
+        }
+    }
+
+    /**
+     * @brief       Change the number of elements, copying a value in the new ones.
+     * @param       n_elems : The number of elements.
+     * @param       val : The value copied in the new elements.
+     */
+    void resize(size_type n_elems, const value_type& val)
+    {
+        if (n_elems < sz_)
+        {
+            destroy(dat_ + n_elems, dat_ + sz_);
+            sz_ = n_elems;
+        }
+        else
+        {
+            append_n(n_elems - sz_, [&](value_type* dest) { construct(dest, val); });
+        }
+    }
+
+    /**
+     * @brief       Swap the elements with another vector. The storages obtained from the
+     *              allocators are exchanged when both vectors have one and the allocators allow
+     *              it, otherwise the elements are moved.
+     * @param       rhs : The other vector.
+     */
+    void swap(small_vector& rhs)
+    {
+        if (this == &rhs)
+        {
+            return;
+        }
+
+        if (!is_inline() && !rhs.is_inline() &&
+            (allocator_traits::propagate_on_container_swap::value || alloc_ == rhs.alloc_))
+        {
+            if constexpr (allocator_traits::propagate_on_container_swap::value)
+            {
+                std::swap(alloc_, rhs.alloc_);
+            }
+
+            std::swap(dat_, rhs.dat_);
+            std::swap(sz_, rhs.sz_);
+            std::swap(cap_, rhs.cap_);
+
+            return;
+        }
+
+        small_vector tmp(std::move(rhs));
+
+        rhs = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    /**
+     * @brief       Swap the elements of two vectors.
+     * @param       lhs : The first vector.
+     * @param       rhs : The second vector.
+     */
+    friend void swap(small_vector& lhs, small_vector& rhs)
+    {
+        lhs.swap(rhs);
+    }
+
+    /**
+     * @brief       Equal operator.
+     * @param       lhs : The first vector.
+     * @param       rhs : The second vector.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] friend bool operator ==(const small_vector& lhs, const small_vector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /**
+     * @brief       Three-way comparison operator, comparing the elements lexicographically.
+     * @param       lhs : The first vector.
+     * @param       rhs : The second vector.
+     * @return      The ordering of the vectors.
+     */
+    [[nodiscard]] friend auto operator <=>(const small_vector& lhs, const small_vector& rhs)
+            requires std::three_way_comparable<value_type>
+    {
+        return std::lexicographical_compare_three_way(
+                lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    /** The allocator traits. */
+    using allocator_traits = std::allocator_traits<allocator_type>;
+
+    /**
+     * @brief       Get the buffer placed inside the object.
+     * @return      The buffer placed inside the object.
+     */
+    [[nodiscard]] value_type* get_inline_data() noexcept
+    {
+        return reinterpret_cast<value_type*>(inln_buf_);
+    }
+
+    /**
+     * @brief       Get the buffer placed inside the object.
+     * @return      The buffer placed inside the object.
+     */
+    [[nodiscard]] const value_type* get_inline_data() const noexcept
+    {
+        return reinterpret_cast<const value_type*>(inln_buf_);
+    }
+
+    /**
+     * @brief       Get the capacity to allocate when growing.
+     * @param       min_cap : The minimum capacity needed.
+     * @return      The capacity to allocate.
+     */
+    [[nodiscard]] size_type get_next_capacity(size_type min_cap) const noexcept
+    {
+        return std::max(cap_ * 2, min_cap);
+    }
+
+    /**
+     * @brief       Construct an element with the allocator.
+     * @param       dest : Where to construct the element.
+     * @param       args : The arguments to construct the element.
+     */
+    template<typename... Ts_>
+    void construct(value_type* dest, Ts_&&... args)
+    {
+        allocator_traits::construct(alloc_, dest, std::forward<Ts_>(args)...);
+    }
+
+    /**
+     * @brief       Destroy a range of elements with the allocator.
+     * @param       first : The first element to destroy.
+     * @param       last : The end of the range to destroy.
+     */
+    void destroy(value_type* first, value_type* last) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            allocator_traits::destroy(alloc_, first);
+        }
+    }
+
+    /**
+     * @brief       Construct a number of contiguous elements, destroying the constructed ones if
+     *              an exception is thrown.
+     * @param       dest : Where to construct the first element.
+     * @param       n_elems : The number of elements.
+     * @param       constr : Function that constructs an element at the given address.
+     */
+    template<typename ConstructorT_>
+    void construct_n(value_type* dest, size_type n_elems, ConstructorT_& constr)
+    {
+        size_type i = 0;
+
+        try
+        {
+            for (; i < n_elems; ++i)
+            {
+                constr(dest + i);
+            }
+        }
+        catch (...)
+        {
+            destroy(dest, dest + i);
+            throw;
+        }
+    }
+
+    /**
+     * @brief       Construct a number of elements at the end, reallocating if they don't fit.
+     * @param       n_elems : The number of elements.
+     * @param       constr : Function that constructs an element at the given address.
+     */
+    template<typename ConstructorT_>
+    void append_n(size_type n_elems, ConstructorT_&& constr)
+    {
+        if (sz_ + n_elems <= cap_)
+        {
+            construct_n(dat_ + sz_, n_elems, constr);
+            sz_ += n_elems;
+        }
+        else
+        {
+            reallocate(get_next_capacity(sz_ + n_elems), n_elems, constr);
+        }
+    }
+
+    /**
+     * @brief       Move the storage to a new one, constructing new elements after the current
+     *              ones. The new elements are constructed before the current ones are relocated,
+     *              so they can be built from them. The current elements are moved if that can't
+     *              throw or if they can't be copied, otherwise they are copied, so that the vector
+     *              is left unchanged if an exception is thrown. If the new capacity fits in the
+     *              object, its buffer is used.
+     * @param       new_cap : The new capacity, not smaller than the new number of elements.
+     * @param       n_new_elems : The number of new elements.
+     * @param       constr : Function that constructs a new element at the given address.
+     */
+    template<typename ConstructorT_>
+    void reallocate(size_type new_cap, size_type n_new_elems, ConstructorT_&& constr)
+    {
+        value_type* new_dat;
+        value_type* src = dat_;
+
+        if (new_cap <= N)
+        {
+            new_dat = get_inline_data();
+            new_cap = N;
+        }
+        else
+        {
+            new_dat = allocator_traits::allocate(alloc_, new_cap);
+        }
+
+        try
+        {
+            construct_n(new_dat + sz_, n_new_elems, constr);
+
+            try
+            {
+                auto relocte = [&](value_type* dest)
+                {
+                    construct(dest, std::move_if_noexcept(*src++));
+                };
+
+                construct_n(new_dat, sz_, relocte);
+            }
+            catch (...)
+            {
+                destroy(new_dat + sz_, new_dat + sz_ + n_new_elems);
+                throw;
+            }
+        }
+        catch (...)
+        {
+            if (new_dat != get_inline_data())
+            {
+                allocator_traits::deallocate(alloc_, new_dat, new_cap);
+            }
+
+            throw;
+        }
+
+        destroy(dat_, dat_ + sz_);
+        release_storage();
+        dat_ = new_dat;
+        cap_ = new_cap;
+        sz_ += n_new_elems;
+    }
+
+    /**
+     * @brief       Give back the storage obtained from the allocator, if any, and use the buffer
+     *              placed inside the object. The elements must have been destroyed.
+     */
+    void release_storage() noexcept
+    {
+        if (!is_inline())
+        {
+            allocator_traits::deallocate(alloc_, dat_, cap_);
+            dat_ = get_inline_data();
+            cap_ = N;
+        }
+    }
+
+    /**
+     * @brief       Take the elements of another vector, that uses an equal allocator, leaving it
+     *              empty. This vector must be empty and hold no storage from the allocator.
+     * @param       rhs : The other vector.
+     */
+    void take_elements(small_vector& rhs)
+    {
+        if (rhs.is_inline())
+        {
+            auto mve = [&, src = rhs.dat_](value_type* dest) mutable
+            {
+                construct(dest, std::move(*src++));
+            };
+
+            construct_n(dat_, rhs.sz_, mve);
+            sz_ = rhs.sz_;
+            rhs.clear();
+        }
+        else
+        {
+            dat_ = std::exchange(rhs.dat_, rhs.get_inline_data());
+            sz_ = std::exchange(rhs.sz_, 0);
+            cap_ = std::exchange(rhs.cap_, N);
+        }
+    }
+
+    /**
+     * @brief       Move the elements appended from an index to a position, shifting the ones that
+     *              were there.
+     * @param       indx : The position where the appended elements go.
+     * @param       old_sz : The number of elements before appending.
+     * @return      An iterator to the first moved element.
+     */
+    iterator rotate_back(size_type indx, size_type old_sz)
+    {
+        std::rotate(dat_ + indx, dat_ + old_sz, dat_ + sz_);
+
+        return dat_ + indx;
+    }
+
+private:
+    /** The allocator. */
+    [[no_unique_address]] allocator_type alloc_;
+
+    /** The elements, either the buffer placed inside the object or allocated storage. */
+    value_type* dat_;
+
+    /** The number of elements. */
+    size_type sz_;
+
+    /** The number of elements that fit in the current storage. */
+    size_type cap_;
+
+    /** The buffer placed inside the object. */
+    alignas(value_type) std::byte inln_buf_[N > 0 ? sizeof(value_type) * N : 1];
+};
+
+}
+
+#endif
@@ -0,0 +1,341 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       spsc_ring.hpp
+ * @brief      spsc_ring class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_SPSC_RING_HPP
+#define SPEED_CONTAINERS_SPSC_RING_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a bounded lock-free queue for a single producer thread and a
+ *              single consumer thread. The producer only writes the tail and the consumer only
+ *              writes the head, each on its own cache line. Both sides keep a copy of the index
+ *              of the other one and only read the shared index when the copy tells that the ring
+ *              is full or empty, so the cache lines mostly stay where they are written.
+ */
+template<typename ValueT, typename AllocatorT = std::allocator<ValueT>>
+class spsc_ring
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The allocator type. */
+    using allocator_type = AllocatorT;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       cap : The minimum number of elements, rounded up to a power of two.
+     * @param       alloc : The allocator used to obtain the slots.
+     */
+    explicit spsc_ring(std::size_t cap, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc)
+            , cap_(std::bit_ceil(cap > 0 ? cap : 1))
+            , slts_(slot_allocator_traits::allocate(alloc_, cap_))
+    {
+    }
+
+    /** @cond */
+    spsc_ring(const spsc_ring& rhs) = delete;
+
+    spsc_ring(spsc_ring&& rhs) = delete;
+
+    spsc_ring& operator =(const spsc_ring& rhs) = delete;
+
+    spsc_ring& operator =(spsc_ring&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Destructor. The elements left in the ring are destroyed.
+     */
+    ~spsc_ring()
+    {
+        const std::size_t tl = prod_.tl_.load(std::memory_order_relaxed);
+
+        for (std::size_t hd = cons_.hd_.load(std::memory_order_relaxed); hd != tl; ++hd)
+        {
+            slot_allocator_traits::destroy(alloc_, slts_ + (hd & (cap_ - 1)));
+        }
+
+        slot_allocator_traits::deallocate(alloc_, slts_, cap_);
+    }
+
+    /**
+     * @brief       Construct an element at the end of the ring. Only the producer thread can call
+     *              it.
+     * @param       args : The arguments to construct the element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename... Ts_>
+    bool try_emplace(Ts_&&... args)
+    {
+        const std::size_t tl = prod_.tl_.load(std::memory_order_relaxed);
+
+        if (tl - prod_.hd_cpy_ == cap_)
+        {
+            prod_.hd_cpy_ = cons_.hd_.load(std::memory_order_acquire);
+
+            if (tl - prod_.hd_cpy_ == cap_)
+            {
+                return false;
+            }
+        }
+
+        slot_allocator_traits::construct(
+                alloc_, slts_ + (tl & (cap_ - 1)), std::forward<Ts_>(args)...);
+        prod_.tl_.store(tl + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief       Copy an element at the end of the ring. Only the producer thread can call it.
+     * @param       val : The element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool try_push(const value_type& val)
+    {
+        return try_emplace(val);
+    }
+
+    /**
+     * @brief       Move an element at the end of the ring. Only the producer thread can call it.
+     * @param       val : The element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool try_push(value_type&& val)
+    {
+        return try_emplace(std::move(val));
+    }
+
+    /**
+     * @brief       Push as many elements of a span as fit in the ring, publishing them all at
+     *              once. The elements of a mutable span are moved, the other ones are copied.
+     *              Only the producer thread can call it.
+     * @param       vals : The elements.
+     * @return      The number of pushed elements, taken from the front of the span.
+     */
+    template<typename ValueT_, std::size_t ExtentT_>
+    std::size_t try_push_bulk(std::span<ValueT_, ExtentT_> vals)
+    {
+        const std::size_t tl = prod_.tl_.load(std::memory_order_relaxed);
+        std::size_t n_vals = cap_ - (tl - prod_.hd_cpy_);
+
+        if (n_vals < vals.size())
+        {
+            prod_.hd_cpy_ = cons_.hd_.load(std::memory_order_acquire);
+            n_vals = cap_ - (tl - prod_.hd_cpy_);
+        }
+
+        if (n_vals > vals.size())
+        {
+            n_vals = vals.size();
+        }
+
+        for (std::size_t i = 0; i < n_vals; ++i)
+        {
+            try
+            {
+                slot_allocator_traits::construct(
+                        alloc_, slts_ + ((tl + i) & (cap_ - 1)), std::forward<ValueT_>(vals[i]));
+            }
+            catch (...)
+            {
+                prod_.tl_.store(tl + i, std::memory_order_release);
+                throw;
+            }
+        }
+
+        prod_.tl_.store(tl + n_vals, std::memory_order_release);
+
+        return n_vals;
+    }
+
+    /**
+     * @brief       Move the first element of the ring out of it. Only the consumer thread can
+     *              call it.
+     * @param       val : The object in which move the element.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    bool try_pop(value_type& val)
+    {
+        const std::size_t hd = cons_.hd_.load(std::memory_order_relaxed);
+
+        if (hd == cons_.tl_cpy_)
+        {
+            cons_.tl_cpy_ = prod_.tl_.load(std::memory_order_acquire);
+
+            if (hd == cons_.tl_cpy_)
+            {
+                return false;
+            }
+        }
+
+        value_type* const slt = slts_ + (hd & (cap_ - 1));
+
+        val = std::move(*slt);
+        slot_allocator_traits::destroy(alloc_, slt);
+        cons_.hd_.store(hd + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * @brief       Move as many elements as available out of the ring, releasing their slots all
+     *              at once. Only the consumer thread can call it.
+     * @param       vals : The objects in which move the elements.
+     * @return      The number of popped elements, stored at the front of the span.
+     */
+    std::size_t try_pop_bulk(std::span<value_type> vals)
+    {
+        const std::size_t hd = cons_.hd_.load(std::memory_order_relaxed);
+        std::size_t n_vals = cons_.tl_cpy_ - hd;
+
+        if (n_vals < vals.size())
+        {
+            cons_.tl_cpy_ = prod_.tl_.load(std::memory_order_acquire);
+            n_vals = cons_.tl_cpy_ - hd;
+        }
+
+        if (n_vals > vals.size())
+        {
+            n_vals = vals.size();
+        }
+
+        for (std::size_t i = 0; i < n_vals; ++i)
+        {
+            value_type* const slt = slts_ + ((hd + i) & (cap_ - 1));
+
+            try
+            {
+                vals[i] = std::move(*slt);
+            }
+            catch (...)
+            {
+                cons_.hd_.store(hd + i, std::memory_order_release);
+                throw;
+            }
+
+            slot_allocator_traits::destroy(alloc_, slt);
+        }
+
+        cons_.hd_.store(hd + n_vals, std::memory_order_release);
+
+        return n_vals;
+    }
+
+    /**
+     * @brief       Allows knowing whether the ring holds no element. The answer can be outdated
+     *              when the other thread uses the ring.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_empty() const noexcept
+    {
+        return get_count() == 0;
+    }
+
+    /**
+     * @brief       Get the number of elements in the ring. The answer can be outdated when the
+     *              other thread uses the ring.
+     * @return      The number of elements in the ring.
+     */
+    [[nodiscard]] std::size_t get_count() const noexcept
+    {
+        const std::size_t hd = cons_.hd_.load(std::memory_order_acquire);
+
+        return prod_.tl_.load(std::memory_order_acquire) - hd;
+    }
+
+    /**
+     * @brief       Get the number of elements that the ring can hold.
+     * @return      The number of elements that the ring can hold.
+     */
+    [[nodiscard]] std::size_t get_capacity() const noexcept
+    {
+        return cap_;
+    }
+
+private:
+    /** Size of a cache line, used to keep the indexes from sharing lines. */
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /** The allocator of the slots. */
+    using slot_allocator_type =
+            typename std::allocator_traits<allocator_type>::template rebind_alloc<value_type>;
+
+    /** The slot allocator traits. */
+    using slot_allocator_traits = std::allocator_traits<slot_allocator_type>;
+
+    /**
+     * @brief       Struct that represents the state written by the producer.
+     */
+    struct alignas(CACHE_LINE_SIZE) producer
+    {
+        /** The index of the next slot to fill. */
+        std::atomic<std::size_t> tl_ = 0;
+
+        /** The last head read by the producer. */
+        std::size_t hd_cpy_ = 0;
+    };
+
+    /**
+     * @brief       Struct that represents the state written by the consumer.
+     */
+    struct alignas(CACHE_LINE_SIZE) consumer
+    {
+        /** The index of the next slot to empty. */
+        std::atomic<std::size_t> hd_ = 0;
+
+        /** The last tail read by the consumer. */
+        std::size_t tl_cpy_ = 0;
+    };
+
+    /** The allocator of the slots. */
+    [[no_unique_address]] slot_allocator_type alloc_;
+
+    /** The number of slots, a power of two. */
+    const std::size_t cap_;
+
+    /** The slots. */
+    value_type* const slts_;
+
+    /** The producer state. */
+    producer prod_;
+
+    /** The consumer state. */
+    consumer cons_;
+};
+
+}
+
+#endif
@@ -0,0 +1,126 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       statistics_policy.hpp
+ * @brief      statistics_policy concept header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_STATISTICS_POLICY_HPP
+#define SPEED_CONTAINERS_STATISTICS_POLICY_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace speed::containers {
+
+/**
+ * @brief       Struct that represents the statistics of a cache at a given moment.
+ */
+struct cache_statistics
+{
+    /** The number of buckets of the probe length histogram. */
+    static constexpr std::size_t N_PROBE_BUCKETS = 8;
+    
+    /** The number of lookups that found their key. */
+    std::uint64_t n_hits_ = 0;
+    
+    /** The number of lookups that didn't find their key. */
+    std::uint64_t n_misses_ = 0;
+    
+    /** The number of elements inserted. */
+    std::uint64_t n_inserts_ = 0;
+    
+    /** The number of elements evicted to make room for others. */
+    std::uint64_t n_evictions_ = 0;
+    
+    /** The number of elements locked. */
+    std::uint64_t n_locks_ = 0;
+    
+    /** The number of elements unlocked. */
+    std::uint64_t n_unlocks_ = 0;
+    
+    /** The number of operations that failed because all the elements were locked. */
+    std::uint64_t n_exhausted_ = 0;
+    
+    /**
+     * The number of hash buffer list walks by number of keys compared, the last bucket also
+     * counting the longer walks.
+     */
+    std::array<std::uint64_t, N_PROBE_BUCKETS> prb_lens_ = {};
+    
+    /**
+     * @brief       Add the statistics of another cache to these ones.
+     * @param       rhs : The statistics to add.
+     * @return      The object who call the method.
+     */
+    cache_statistics& operator +=(const cache_statistics& rhs) noexcept
+    {
+        n_hits_ += rhs.n_hits_;
+        n_misses_ += rhs.n_misses_;
+        n_inserts_ += rhs.n_inserts_;
+        n_evictions_ += rhs.n_evictions_;
+        n_locks_ += rhs.n_locks_;
+        n_unlocks_ += rhs.n_unlocks_;
+        n_exhausted_ += rhs.n_exhausted_;
+        
+        for (std::size_t i = 0; i < N_PROBE_BUCKETS; ++i)
+        {
+            prb_lens_[i] += rhs.prb_lens_[i];
+        }
+        
+        return *this;
+    }
+};
+
+/**
+ * @brief       Concept that represents the policy that records the statistics of a cache. The
+ *              cache may notify the policy from several readers at once, so a policy that counts
+ *              has to do it atomically. The policy is notified through the following members:
+ *              - on_hit() : A lookup found its key.
+ *              - on_miss() : A lookup didn't find its key.
+ *              - on_insert() : An element has been inserted.
+ *              - on_eviction() : An element has been evicted to make room for another.
+ *              - on_lock() : An available element has been locked.
+ *              - on_unlock() : A locked element has been unlocked.
+ *              - on_exhausted() : An operation failed because all the elements were locked.
+ *              - on_probe(n) : A hash buffer list has been walked comparing n keys.
+ *              The statistics are read through snapshot().
+ */
+template<typename PolicyT>
+concept statistics_policy = requires(PolicyT plcy, const PolicyT cplcy, std::size_t n)
+{
+    plcy.on_hit();
+    plcy.on_miss();
+    plcy.on_insert();
+    plcy.on_eviction();
+    plcy.on_lock();
+    plcy.on_unlock();
+    plcy.on_exhausted();
+    plcy.on_probe(n);
+    { cplcy.snapshot() } -> std::same_as<cache_statistics>;
+};
+
+}
+
+#endif
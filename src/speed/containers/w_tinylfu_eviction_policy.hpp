@@ -0,0 +1,334 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       w_tinylfu_eviction_policy.hpp
+ * @brief      w_tinylfu_eviction_policy class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_CONTAINERS_W_TINYLFU_EVICTION_POLICY_HPP
+#define SPEED_CONTAINERS_W_TINYLFU_EVICTION_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "detail/eviction_list.hpp"
+#include "detail/frequency_sketch.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a W-TinyLFU eviction policy. New keys enter a small window
+ *              LRU that holds 1% of the nodes. The rest is a segmented LRU made of a probation
+ *              segment and a protected segment that holds up to 80% of it, a hit in probation
+ *              promoting the node to protected. When the window is full its least recently used
+ *              node only enters the main segments if a frequency sketch estimates it has been
+ *              seen more often than the probation victim, otherwise it is the one recycled. A
+ *              scan therefore churns the window without flushing the frequently used keys.
+ */
+template<typename NodeT>
+class w_tinylfu_eviction_policy
+{
+public:
+    /** The node type. */
+    using node_type = NodeT;
+
+    /** Whether on_hit can be called by several readers at once. */
+    static constexpr bool CONCURRENT_HITS = false;
+
+    /**
+     * @brief       Contains the segments in which a node can be.
+     */
+    enum class segment : std::uint8_t
+    {
+        /** The node doesn't hold any key. */
+        FREE,
+
+        /** The node is in the window. */
+        WINDOW,
+
+        /** The node is in the probation segment. */
+        PROBATION,
+
+        /** The node is in the protected segment. */
+        PROTECTED
+    };
+
+    /**
+     * @brief       Struct that represents the state kept in every node.
+     */
+    struct hook_type
+    {
+        /** Pointer to the next node in the segment. */
+        node_type* av_nxt_;
+
+        /** Pointer to the previous node in the segment. */
+        node_type* av_prev_;
+
+        /** The hash of the node key. */
+        std::size_t hsh_;
+
+        /** The segment of the node. */
+        segment sgmt_;
+    };
+
+    /**
+     * @brief       Make the specified nodes free and available.
+     * @param       nds : The first node.
+     * @param       n_nds : The number of nodes.
+     */
+    void initialize(node_type* nds, std::size_t n_nds)
+    {
+        free_.clear();
+        win_.clear();
+        prob_.clear();
+        prot_.clear();
+        win_max_ = n_nds / 100 > 0 ? n_nds / 100 : 1;
+        prot_max_ = (n_nds - win_max_) * 4 / 5;
+        sktch_.initialize(n_nds);
+
+        for (std::size_t i = 0; i < n_nds; i++)
+        {
+            nds[i].plcy_hk_.sgmt_ = segment::FREE;
+            free_.push_back(&nds[i]);
+        }
+    }
+
+    /**
+     * @brief       Get the node to recycle. If the window is full its least recently used node
+     *              competes with the least recently used node of the main segments and the one
+     *              seen less often is recycled.
+     * @return      The node to recycle, or nullptr if there is no available node.
+     */
+    node_type* get_victim() const noexcept
+    {
+        if (!free_.empty())
+        {
+            return free_.front();
+        }
+
+        node_type* const main_vctm = !prob_.empty() ? prob_.front() : prot_.front();
+
+        if (win_.size() < win_max_ && main_vctm != nullptr)
+        {
+            return main_vctm;
+        }
+
+        node_type* const cand = win_.front();
+
+        if (cand == nullptr)
+        {
+            return main_vctm;
+        }
+
+        if (main_vctm == nullptr ||
+            sktch_.get_frequency(cand->plcy_hk_.hsh_) <=
+                    sktch_.get_frequency(main_vctm->plcy_hk_.hsh_))
+        {
+            return cand;
+        }
+
+        return main_vctm;
+    }
+
+    /**
+     * @brief       Notify that the victim holds a new key. The key enters the window, and if the
+     *              window overflows its least recently used node moves to probation.
+     * @param       nd : The victim.
+     * @param       hsh : The hash of the new key.
+     */
+    void on_insert(node_type* nd, std::size_t hsh) noexcept
+    {
+        get_segment_list(nd->plcy_hk_.sgmt_).erase(nd);
+        sktch_.increment(hsh);
+        nd->plcy_hk_.hsh_ = hsh;
+        nd->plcy_hk_.sgmt_ = segment::WINDOW;
+        win_.push_back(nd);
+
+        if (win_.size() > win_max_)
+        {
+            node_type* const cand = win_.front();
+
+            win_.erase(cand);
+            cand->plcy_hk_.sgmt_ = segment::PROBATION;
+            prob_.push_back(cand);
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been found.
+     * @param       nd : The node found.
+     */
+    void on_hit(node_type* nd) noexcept
+    {
+        sktch_.increment(nd->plcy_hk_.hsh_);
+
+        switch (nd->plcy_hk_.sgmt_)
+        {
+            case segment::WINDOW:
+                win_.move_to_back(nd);
+                break;
+
+            case segment::PROBATION:
+                prob_.erase(nd);
+                push_back_protected(nd);
+                break;
+
+            case segment::PROTECTED:
+                prot_.move_to_back(nd);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node has been locked.
+     * @param       nd : The node locked.
+     */
+    void on_lock(node_type* nd) noexcept
+    {
+        get_segment_list(nd->plcy_hk_.sgmt_).erase(nd);
+    }
+
+    /**
+     * @brief       Notify that a locked node has been unlocked. It goes back to its segment, or
+     *              to probation if it was in the window and the window is full.
+     * @param       nd : The node unlocked.
+     */
+    void on_unlock(node_type* nd) noexcept
+    {
+        if (nd->plcy_hk_.sgmt_ == segment::WINDOW && win_.size() >= win_max_)
+        {
+            nd->plcy_hk_.sgmt_ = segment::PROBATION;
+        }
+
+        if (nd->plcy_hk_.sgmt_ == segment::PROTECTED)
+        {
+            push_back_protected(nd);
+        }
+        else
+        {
+            get_segment_list(nd->plcy_hk_.sgmt_).push_back(nd);
+        }
+    }
+
+    /**
+     * @brief       Notify that an available node no longer holds a key. It becomes free, so it is
+     *              the next one to be recycled.
+     * @param       nd : The node erased.
+     */
+    void on_erase(node_type* nd) noexcept
+    {
+        get_segment_list(nd->plcy_hk_.sgmt_).erase(nd);
+        nd->plcy_hk_.sgmt_ = segment::FREE;
+        free_.push_back(nd);
+    }
+
+    /**
+     * @brief       Call a function on every available node without modifying the policy. The free
+     *              nodes come first, followed by the probation segment, the window and the
+     *              protected segment, each one from its least recently used node.
+     * @param       fnc : The function to call.
+     */
+    template<typename FunctionT_>
+    void for_each_in_eviction_order(FunctionT_&& fnc) const
+    {
+        free_.for_each(fnc);
+        prob_.for_each(fnc);
+        win_.for_each(fnc);
+        prot_.for_each(fnc);
+    }
+
+protected:
+    /** The list type. */
+    using list_type = detail::eviction_list<node_type>;
+
+    /**
+     * @brief       Get the list of a segment.
+     * @param       sgmt : The segment.
+     * @return      The list of the segment.
+     */
+    list_type& get_segment_list(segment sgmt) noexcept
+    {
+        switch (sgmt)
+        {
+            case segment::WINDOW:
+                return win_;
+
+            case segment::PROBATION:
+                return prob_;
+
+            case segment::PROTECTED:
+                return prot_;
+
+            default:
+                return free_;
+        }
+    }
+
+    /**
+     * @brief       Insert a node in the end of the protected segment, demoting the least recently
+     *              used protected node to probation if the segment overflows.
+     * @param       nd : The node to insert.
+     */
+    void push_back_protected(node_type* nd) noexcept
+    {
+        nd->plcy_hk_.sgmt_ = segment::PROTECTED;
+        prot_.push_back(nd);
+
+        if (prot_.size() > prot_max_)
+        {
+            node_type* const dmtd = prot_.front();
+
+            prot_.erase(dmtd);
+            dmtd->plcy_hk_.sgmt_ = segment::PROBATION;
+            prob_.push_back(dmtd);
+        }
+    }
+
+private:
+    /** The nodes that don't hold any key. */
+    list_type free_;
+
+    /** The window. */
+    list_type win_;
+
+    /** The probation segment. */
+    list_type prob_;
+
+    /** The protected segment. */
+    list_type prot_;
+
+    /** The maximum number of nodes in the window. */
+    std::size_t win_max_ = 1;
+
+    /** The maximum number of nodes in the protected segment. */
+    std::size_t prot_max_ = 0;
+
+    /** The frequency sketch. */
+    detail::frequency_sketch sktch_;
+};
+
+}
+
+#endif
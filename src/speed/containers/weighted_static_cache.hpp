@@ -0,0 +1,323 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       weighted_static_cache.hpp
+ * @brief      weighted_static_cache class header.
+ * @author     Killian Valverde
+ * @date       2026/10/16
+ */
+
+#ifndef SPEED_CONTAINERS_WEIGHTED_STATIC_CACHE_HPP
+#define SPEED_CONTAINERS_WEIGHTED_STATIC_CACHE_HPP
+
+#include <bit>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "cache_base.hpp"
+#include "exception.hpp"
+#include "lru_eviction_policy.hpp"
+#include "no_statistics_policy.hpp"
+
+namespace speed::containers {
+
+/**
+ * @brief       Class that represents a generic static cache bounded by the total weight of its
+ *              elements. WeigherT is called with the key and the value of every inserted element
+ *              and gives its weight, for instance its size in bytes. Inserting an element evicts
+ *              the elements the eviction policy chooses until the total weight, the new element
+ *              included, fits the maximum weight. The weight of an element is taken once when it
+ *              is inserted. SIZE bounds the number of elements as well. The free buffers are kept
+ *              apart from the eviction policy, so the policy only chooses among the elements.
+ */
+template<
+        typename KeyT,
+        typename ValueT,
+        std::size_t SIZE,
+        typename WeigherT,
+        typename HashT = std::hash<KeyT>,
+        typename PredT = std::equal_to<KeyT>,
+        template<typename> class EvictionPolicyT = lru_eviction_policy,
+        typename StatisticsT = no_statistics_policy
+>
+class weighted_static_cache
+        : public cache_base<
+                weighted_static_cache<
+                        KeyT, ValueT, SIZE, WeigherT, HashT, PredT, EvictionPolicyT, StatisticsT>,
+                KeyT,
+                ValueT,
+                HashT,
+                PredT,
+                EvictionPolicyT,
+                StatisticsT
+        >
+{
+public:
+    /** The base class. */
+    using base_type = cache_base<
+            weighted_static_cache, KeyT, ValueT, HashT, PredT, EvictionPolicyT, StatisticsT>;
+    
+    /** The weigher type. */
+    using weigher_type = WeigherT;
+    
+    /** The buffer type. */
+    using typename base_type::buffer;
+    
+    /** The hash buffer type. */
+    using typename base_type::hash_buffer;
+    
+    /** The value type. */
+    using typename base_type::value_type;
+    
+    /** The iterator type. */
+    using typename base_type::iterator;
+    
+    /** The number of lists in the hash buffer, a power of two so it can be indexed by mask. */
+    static constexpr std::size_t HASH_BUFFER_SIZE = std::bit_ceil(SIZE * 2);
+    
+    /**
+     * @brief       Constructor with parameters.
+     * @param       max_wght : The maximum total weight of the elements.
+     */
+    explicit weighted_static_cache(std::size_t max_wght) noexcept(noexcept(
+            std::declval<typename base_type::policy_type&>().initialize(nullptr, SIZE)))
+            : max_wght_(max_wght)
+    {
+        base_type::initialize(buffers_, SIZE);
+        
+        for (std::size_t i = 0; i < SIZE; i++)
+        {
+            park_buffer(&buffers_[i]);
+        }
+    }
+    
+    /** @cond */
+    weighted_static_cache(const weighted_static_cache& rhs) = delete;
+    
+    weighted_static_cache(weighted_static_cache&& rhs) = delete;
+    
+    weighted_static_cache& operator =(const weighted_static_cache& rhs) = delete;
+    
+    weighted_static_cache& operator =(weighted_static_cache&& rhs) = delete;
+    /** @endcond */
+    
+    /**
+     * @brief       Destructor.
+     */
+    ~weighted_static_cache()
+    {
+        base_type::destroy_elements(buffers_, SIZE);
+    }
+    
+    /**
+     * @brief       Check whether the least recently used element is free (never used), that is
+     *              whether an element can be inserted without evicting another to get a buffer.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool is_least_recently_used_free() const noexcept
+    {
+        return free_list_ != nullptr;
+    }
+    
+    /**
+     * @brief       Get the total weight of the elements.
+     * @return      The total weight of the elements.
+     */
+    [[nodiscard]] std::size_t get_total_weight() const noexcept
+    {
+        return tot_wght_;
+    }
+    
+    /**
+     * @brief       Get the maximum total weight of the elements.
+     * @return      The maximum total weight of the elements.
+     */
+    [[nodiscard]] std::size_t get_max_weight() const noexcept
+    {
+        return max_wght_;
+    }
+
+protected:
+    /**
+     * @brief       Get the hash buffer.
+     * @return      The hash buffer.
+     */
+    [[nodiscard]] hash_buffer* get_hash_buffer() const noexcept
+    {
+        return const_cast<hash_buffer*>(hbuf_);
+    }
+    
+    /**
+     * @brief       Get the hash buffer size.
+     * @return      The hash buffer size.
+     */
+    [[nodiscard]] static constexpr std::size_t get_hash_buffer_size() noexcept
+    {
+        return HASH_BUFFER_SIZE;
+    }
+    
+    /**
+     * @brief       Insert a key whose value is constructed from the specified arguments, knowing
+     *              that the key isn't in the container, evicting elements until its weight fits.
+     *              The weight depends on the value, so unless a value is passed it is constructed
+     *              before evicting and then moved into its buffer.
+     * @param       hsh : The hash of the key.
+     * @param       ky : The key.
+     * @param       args : The arguments to forward to the value constructor.
+     * @return      An iterator to the inserted element.
+     * @throw       speed::containers::exhausted_resources_exception : If the weight can't fit
+     *              because of the locked elements or because it exceeds the maximum weight. The
+     *              elements evicted before an exception is thrown stay evicted.
+     */
+    template<typename KeyT_, typename... Ts_>
+    iterator insert_unique(std::size_t hsh, KeyT_&& ky, Ts_&&... args)
+    {
+        if constexpr (sizeof...(Ts_) == 1 &&
+                      (std::is_same_v<std::remove_cvref_t<Ts_>, value_type> && ...))
+        {
+            const std::size_t wght = weigher_type()(std::as_const(ky), std::as_const(args)...);
+            
+            make_room(wght);
+            
+            if (free_list_ != nullptr)
+            {
+                unpark_buffer();
+            }
+            
+            iterator it;
+            
+            try
+            {
+                it = base_type::emplace_in_victim(
+                        hsh, std::forward<KeyT_>(ky), std::forward<Ts_>(args)...);
+            }
+            catch (...)
+            {
+                // The buffer left free is the next one the eviction policy recycles, and free
+                // buffers have to stay in the free list for make_room() to only release elements.
+                buffer* const buf = base_type::plcy_.get_victim();
+                
+                if (buf != nullptr && !buf->flgs_.is_set(scbf_t::INSERTED_IN_HASH_BUFFER))
+                {
+                    park_buffer(buf);
+                }
+                
+                throw;
+            }
+            
+            wghts_[base_type::get_buffer(it) - buffers_] = wght;
+            tot_wght_ += wght;
+            
+            return it;
+        }
+        else
+        {
+            value_type val(std::forward<Ts_>(args)...);
+            
+            return insert_unique(hsh, std::forward<KeyT_>(ky), std::move(val));
+        }
+    }
+    
+    /**
+     * @brief       Notify that a buffer has been erased from the hash buffer.
+     * @param       buf : The buffer erased.
+     */
+    void on_buffer_erased(buffer* buf) noexcept
+    {
+        std::size_t& wght = wghts_[buf - buffers_];
+        
+        tot_wght_ -= wght;
+        wght = 0;
+    }
+    
+    /**
+     * @brief       Evict elements until a weight fits.
+     * @param       wght : The weight that has to fit.
+     */
+    void make_room(std::size_t wght)
+    {
+        if (wght > max_wght_)
+        {
+            base_type::stats_.on_exhausted();
+            throw exhausted_resources_exception();
+        }
+        
+        while (tot_wght_ > max_wght_ - wght)
+        {
+            buffer* const buf = base_type::get_least_recently_used_buffer();
+            
+            base_type::release_buffer(buf);
+            base_type::stats_.on_eviction();
+            park_buffer(buf);
+        }
+    }
+    
+    /**
+     * @brief       Take a free buffer from the eviction policy and push it in the free list.
+     * @param       buf : The free buffer.
+     */
+    void park_buffer(buffer* buf) noexcept
+    {
+        base_type::plcy_.on_lock(buf);
+        buf->flgs_.unset(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+        buf->b_nxt_ = free_list_;
+        free_list_ = buf;
+    }
+    
+    /**
+     * @brief       Pop a buffer from the free list and give it back to the eviction policy as the
+     *              next one to recycle.
+     */
+    void unpark_buffer() noexcept
+    {
+        buffer* const buf = free_list_;
+        
+        free_list_ = buf->b_nxt_;
+        buf->flgs_.set(scbf_t::INSERTED_IN_AVAILABLE_LIST);
+        base_type::plcy_.on_unlock(buf);
+        base_type::plcy_.on_erase(buf);
+    }
+    
+    friend base_type;
+    
+private:
+    /** All the buffers. */
+    buffer buffers_[SIZE];
+    
+    /** The hash buffer. */
+    hash_buffer hbuf_[HASH_BUFFER_SIZE];
+    
+    /** The weight of the element held by every buffer, indexed as the buffers. */
+    std::size_t wghts_[SIZE] = {};
+    
+    /** The free buffers, linked through their next pointer. */
+    buffer* free_list_ = nullptr;
+    
+    /** The total weight of the elements. */
+    std::size_t tot_wght_ = 0;
+    
+    /** The maximum total weight of the elements. */
+    std::size_t max_wght_;
+};
+
+}
+
+#endif
@@ -53,7 +53,7 @@ inline std::uint64_t city_hash_64(const StringT& str)
     using string_view_type = type_traits::string_view_of_t<StringT>;
     string_view_type strv = str;
     
-    return city_hash_64(strv.data(), strv.size() * sizeof(string_view_type::value_type));
+    return city_hash_64(strv.data(), strv.size() * sizeof(typename string_view_type::value_type));
 }
 
 }
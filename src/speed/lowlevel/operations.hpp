@@ -54,6 +54,20 @@ constexpr std::uint8_t onehot_to_binary(IntegralT val)
     return 0;
 }
 
+/**
+ * @brief       Hint the processor to bring into the cache the line that holds an address, so a
+ *              later access to it doesn't stall. It never faults, even on an invalid address.
+ * @param       addr : The address to prefetch.
+ */
+inline void prefetch(const void* addr) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr);
+#else
+    (void)addr;
+#endif
+}
+
 }
 
 #endif
@@ -0,0 +1,152 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        allocator_delete.hpp
+ * @brief       allocator_delete class header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_ALLOCATOR_DELETE_HPP
+#define SPEED_MEMORY_ALLOCATOR_DELETE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace speed::memory {
+
+/**
+ * @brief       Class that represents a unique_ptr deleter that destroys and deallocates an
+ *              object through the allocator it was obtained from. A stateless allocator takes no
+ *              space, so the deleter holds a single function pointer, which remembers the type
+ *              that was allocated. That allows converting a pointer to a derived type into a
+ *              pointer to a base with a virtual destructor while still deallocating the right
+ *              number of bytes.
+ */
+template<typename ValueT, typename AllocatorT>
+class allocator_delete
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /** The allocator type. */
+    using allocator_type =
+            typename std::allocator_traits<AllocatorT>::template rebind_alloc<value_type>;
+
+    /**
+     * @brief       Default constructor.
+     */
+    allocator_delete() noexcept(std::is_nothrow_default_constructible_v<allocator_type>)
+            : alloc_()
+            , destroy_fn_(&destroy_as<value_type>)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       alloc : The allocator that allocated the objects.
+     */
+    explicit allocator_delete(const allocator_type& alloc) noexcept
+            : alloc_(alloc)
+            , destroy_fn_(&destroy_as<value_type>)
+    {
+    }
+
+    /**
+     * @brief       Copy constructor from the deleter of a derived type. The value type must have
+     *              a virtual destructor, just like when deleting through a base pointer.
+     * @param       rhs : The deleter to copy.
+     */
+    template<typename ValueT_, typename AllocatorT_>
+    requires std::is_convertible_v<ValueT_*, ValueT*> && std::has_virtual_destructor_v<ValueT>
+    allocator_delete(const allocator_delete<ValueT_, AllocatorT_>& rhs) noexcept
+            : alloc_(rhs.alloc_)
+            , destroy_fn_(rhs.destroy_fn_)
+    {
+    }
+
+    /**
+     * @brief       Destroy and deallocate an object.
+     * @param       ptr : The object to destroy and deallocate.
+     */
+    void operator ()(value_type* ptr) const noexcept
+    {
+        // The object may be a derived one, whose address is only known at run time.
+        if constexpr (std::is_polymorphic_v<value_type>)
+        {
+            destroy_fn_(alloc_, dynamic_cast<void*>(ptr));
+        }
+        else
+        {
+            destroy_fn_(alloc_, static_cast<void*>(ptr));
+        }
+    }
+
+    /**
+     * @brief       Get the allocator.
+     * @return      The allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept
+    {
+        return allocator_type(alloc_);
+    }
+
+private:
+    /** The allocator type kept, which doesn't depend on the value type. */
+    using byte_allocator_type =
+            typename std::allocator_traits<AllocatorT>::template rebind_alloc<std::byte>;
+
+    /** The type of the function that destroys and deallocates an object. */
+    using destroy_function_type = void (*)(const byte_allocator_type&, void*);
+
+    /**
+     * @brief       Destroy and deallocate an object whose allocated type is known.
+     * @param       alloc : The allocator that allocated the object.
+     * @param       obj : The object to destroy and deallocate.
+     */
+    template<typename AllocatedT>
+    static void destroy_as(const byte_allocator_type& alloc, void* obj) noexcept
+    {
+        using allocated_allocator_type =
+                typename std::allocator_traits<AllocatorT>::template rebind_alloc<AllocatedT>;
+        using allocated_allocator_traits = std::allocator_traits<allocated_allocator_type>;
+
+        allocated_allocator_type allocd_alloc(alloc);
+        auto* allocd_ptr = static_cast<AllocatedT*>(obj);
+
+        allocated_allocator_traits::destroy(allocd_alloc, allocd_ptr);
+        allocated_allocator_traits::deallocate(allocd_alloc, allocd_ptr, 1);
+    }
+
+    /** The allocator. */
+    [[no_unique_address]] byte_allocator_type alloc_;
+
+    /** The function that destroys and deallocates the objects. */
+    destroy_function_type destroy_fn_;
+
+    template<typename ValueT_, typename AllocatorT_>
+    friend class allocator_delete;
+};
+
+}
+
+#endif
@@ -0,0 +1,370 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        fixed_block_pool.hpp
+ * @brief       fixed_block_pool class header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_FIXED_BLOCK_POOL_HPP
+#define SPEED_MEMORY_FIXED_BLOCK_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "operations.hpp"
+#include "resource_scope.hpp"
+
+namespace speed::memory {
+
+/**
+ * @brief       Class that represents a pool of blocks of a single size. The blocks are carved
+ *              from chunks requested as needed, and the free blocks are linked through their own
+ *              storage, so allocating and deallocating a block are a couple of pointer moves.
+ *              The chunks are only returned when the pool is released or destroyed. It isn't
+ *              thread-safe.
+ */
+class fixed_block_pool
+{
+public:
+    /** The default number of blocks of a chunk. */
+    static constexpr std::size_t DEFAULT_BLOCKS_PER_CHUNK = 256;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       blk_sz : The size of the blocks.
+     * @param       blks_per_chnk : The number of blocks of a chunk.
+     * @param       algn : The alignment of the blocks, a power of two.
+     */
+    explicit fixed_block_pool(
+            std::size_t blk_sz,
+            std::size_t blks_per_chnk = DEFAULT_BLOCKS_PER_CHUNK,
+            std::size_t algn = alignof(std::max_align_t)
+    ) noexcept
+            : algn_(std::max(algn, alignof(free_block)))
+            , blk_sz_(round_up(std::max(blk_sz, sizeof(free_block)), algn_))
+            , blks_per_chnk_(std::max<std::size_t>(blks_per_chnk, 1))
+    {
+    }
+
+    /** @cond */
+    fixed_block_pool(const fixed_block_pool& rhs) = delete;
+
+    fixed_block_pool(fixed_block_pool&& rhs) = delete;
+
+    fixed_block_pool& operator =(const fixed_block_pool& rhs) = delete;
+
+    fixed_block_pool& operator =(fixed_block_pool&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Destructor.
+     */
+    ~fixed_block_pool()
+    {
+        release();
+    }
+
+    /**
+     * @brief       Allocate a block.
+     * @return      The address of the block.
+     * @throw       std::bad_alloc : If a new chunk can't be obtained.
+     */
+    [[nodiscard]] void* allocate()
+    {
+        if (free_ == nullptr)
+        {
+            add_chunk();
+        }
+
+        free_block* blk = free_;
+
+        free_ = blk->nxt_;
+
+        return blk;
+    }
+
+    /**
+     * @brief       Deallocate a block.
+     * @param       ptr : The address of the block.
+     */
+    void deallocate(void* ptr) noexcept
+    {
+        free_ = ::new (ptr) free_block{free_};
+    }
+
+    /**
+     * @brief       Release all the chunks. All the blocks handed out become invalid.
+     */
+    void release() noexcept
+    {
+        while (chnks_ != nullptr)
+        {
+            chunk_header* prev = chnks_->prev_;
+
+            deallocate_bytes(chnks_, get_chunk_size(), algn_);
+            chnks_ = prev;
+        }
+
+        free_ = nullptr;
+        n_chnks_ = 0;
+    }
+
+    /**
+     * @brief       Allows knowing whether a number of bytes with an alignment fit in a block.
+     * @param       sz : The number of bytes.
+     * @param       algn : The alignment.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool fits(std::size_t sz, std::size_t algn) const noexcept
+    {
+        return sz <= blk_sz_ && algn <= algn_;
+    }
+
+    /**
+     * @brief       Get the size of the blocks.
+     * @return      The size of the blocks.
+     */
+    [[nodiscard]] std::size_t get_block_size() const noexcept
+    {
+        return blk_sz_;
+    }
+
+    /**
+     * @brief       Get the number of chunks requested since the last release.
+     * @return      The number of chunks requested since the last release.
+     */
+    [[nodiscard]] std::size_t get_chunk_count() const noexcept
+    {
+        return n_chnks_;
+    }
+
+private:
+    /**
+     * @brief       Struct that represents a free block.
+     */
+    struct free_block
+    {
+        /** The next free block. */
+        free_block* nxt_;
+    };
+
+    /**
+     * @brief       Struct that represents the header at the start of each chunk.
+     */
+    struct chunk_header
+    {
+        /** The previous chunk. */
+        chunk_header* prev_;
+    };
+
+    /**
+     * @brief       Round a size up to a multiple of an alignment.
+     * @param       sz : The size.
+     * @param       algn : The alignment, a power of two.
+     * @return      The rounded size.
+     */
+    static constexpr std::size_t round_up(std::size_t sz, std::size_t algn) noexcept
+    {
+        return (sz + algn - 1) & ~(algn - 1);
+    }
+
+    /**
+     * @brief       Get the size of the header of a chunk, which keeps the blocks aligned.
+     * @return      The size of the header of a chunk.
+     */
+    [[nodiscard]] std::size_t get_header_size() const noexcept
+    {
+        return round_up(sizeof(chunk_header), algn_);
+    }
+
+    /**
+     * @brief       Get the size of a chunk.
+     * @return      The size of a chunk.
+     */
+    [[nodiscard]] std::size_t get_chunk_size() const noexcept
+    {
+        return get_header_size() + blk_sz_ * blks_per_chnk_;
+    }
+
+    /**
+     * @brief       Request a chunk and link its blocks in the free list, in address order.
+     * @throw       std::bad_alloc : If the chunk can't be obtained.
+     */
+    void add_chunk()
+    {
+        auto* chnk = static_cast<chunk_header*>(allocate_bytes(get_chunk_size(), algn_));
+        std::byte* blks = reinterpret_cast<std::byte*>(chnk) + get_header_size();
+
+        chnk->prev_ = chnks_;
+        chnks_ = chnk;
+        ++n_chnks_;
+
+        for (std::size_t i = blks_per_chnk_; i-- > 0;)
+        {
+            free_ = ::new (blks + i * blk_sz_) free_block{free_};
+        }
+    }
+
+private:
+    /** The alignment of the blocks. */
+    std::size_t algn_;
+
+    /** The size of the blocks. */
+    std::size_t blk_sz_;
+
+    /** The number of blocks of a chunk. */
+    std::size_t blks_per_chnk_;
+
+    /** The first free block. */
+    free_block* free_ = nullptr;
+
+    /** The last chunk requested. */
+    chunk_header* chnks_ = nullptr;
+
+    /** The number of chunks requested since the last release. */
+    std::size_t n_chnks_ = 0;
+};
+
+/**
+ * @brief       Class that represents a standard allocator that gets single values from a fixed
+ *              block pool, which suits the nodes of lists, maps and sets. The allocations that
+ *              don't fit in a block, like the arrays of a vector, use the global operator new. A
+ *              default constructed allocator uses the current pool of the thread, set with a
+ *              resource_scope, or the global operator new if there is none. The pool must outlive
+ *              the allocator and everything allocated with it.
+ */
+template<typename ValueT>
+class pool_allocator
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /**
+     * @brief       Default constructor.
+     */
+    pool_allocator() noexcept
+            : pool_(resource_scope<fixed_block_pool>::get_current())
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       pool : The pool.
+     */
+    pool_allocator(fixed_block_pool& pool) noexcept
+            : pool_(&pool)
+    {
+    }
+
+    /**
+     * @brief       Copy constructor from an allocator of another type.
+     * @param       rhs : The allocator to copy.
+     */
+    template<typename ValueT_>
+    pool_allocator(const pool_allocator<ValueT_>& rhs) noexcept
+            : pool_(rhs.get_pool())
+    {
+    }
+
+    /**
+     * @brief       Allocate memory for a number of values.
+     * @param       n : The number of values.
+     * @return      The address of the allocated memory.
+     * @throw       std::bad_alloc : If the memory can't be obtained.
+     */
+    [[nodiscard]] value_type* allocate(std::size_t n)
+    {
+        if (n > SIZE_MAX / sizeof(value_type))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        if (uses_pool(n))
+        {
+            return static_cast<value_type*>(pool_->allocate());
+        }
+
+        return static_cast<value_type*>(
+                allocate_bytes(n * sizeof(value_type), alignof(value_type)));
+    }
+
+    /**
+     * @brief       Deallocate memory.
+     * @param       ptr : The address of the memory.
+     * @param       n : The number of values.
+     */
+    void deallocate(value_type* ptr, std::size_t n) noexcept
+    {
+        if (uses_pool(n))
+        {
+            pool_->deallocate(ptr);
+        }
+        else
+        {
+            deallocate_bytes(ptr, n * sizeof(value_type), alignof(value_type));
+        }
+    }
+
+    /**
+     * @brief       Get the pool.
+     * @return      The pool, or nullptr if the global operator new is used.
+     */
+    [[nodiscard]] fixed_block_pool* get_pool() const noexcept
+    {
+        return pool_;
+    }
+
+    /**
+     * @brief       Allows knowing whether two allocators use the same pool.
+     * @param       lhs : The first allocator.
+     * @param       rhs : The second allocator.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename ValueT_>
+    friend bool operator ==(const pool_allocator& lhs, const pool_allocator<ValueT_>& rhs)
+            noexcept
+    {
+        return lhs.pool_ == rhs.get_pool();
+    }
+
+private:
+    /**
+     * @brief       Allows knowing whether an allocation of a number of values uses the pool.
+     * @param       n : The number of values.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool uses_pool(std::size_t n) const noexcept
+    {
+        return pool_ != nullptr && pool_->fits(n * sizeof(value_type), alignof(value_type));
+    }
+
+private:
+    /** The pool. */
+    fixed_block_pool* pool_;
+};
+
+}
+
+#endif
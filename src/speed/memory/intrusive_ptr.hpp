@@ -0,0 +1,344 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        intrusive_ptr.hpp
+ * @brief       intrusive_ptr class header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_INTRUSIVE_PTR_HPP
+#define SPEED_MEMORY_INTRUSIVE_PTR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "operations.hpp"
+
+namespace speed::memory {
+
+/**
+ * @brief       Class that represents a smart pointer to an object that holds its own reference
+ *              count, which is the case of the objects that inherit from ref_counted. Unlike a
+ *              shared_ptr, the pointer is as small as a raw pointer and the count never needs an
+ *              allocation of its own.
+ */
+template<typename ValueT>
+class intrusive_ptr
+{
+public:
+    /** The value type. */
+    using element_type = ValueT;
+
+    /**
+     * @brief       Default constructor.
+     */
+    constexpr intrusive_ptr() noexcept = default;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       ptr : The object to point to.
+     * @param       add_ref : Whether a reference has to be added. If false, the pointer takes
+     *              over a reference that was already counted.
+     */
+    explicit intrusive_ptr(element_type* ptr, bool add_ref = true) noexcept
+            : ptr_(ptr)
+    {
+        if (ptr_ != nullptr && add_ref)
+        {
+            ptr_->add_reference();
+        }
+    }
+
+    /**
+     * @brief       Copy constructor.
+     * @param       rhs : The pointer to copy.
+     */
+    intrusive_ptr(const intrusive_ptr& rhs) noexcept
+            : intrusive_ptr(rhs.ptr_)
+    {
+    }
+
+    /**
+     * @brief       Copy constructor from a pointer to a type that converts to the value type.
+     * @param       rhs : The pointer to copy.
+     */
+    template<typename ValueT_>
+    requires std::is_convertible_v<ValueT_*, ValueT*>
+    intrusive_ptr(const intrusive_ptr<ValueT_>& rhs) noexcept
+            : intrusive_ptr(rhs.get())
+    {
+    }
+
+    /**
+     * @brief       Move constructor.
+     * @param       rhs : The pointer to move.
+     */
+    intrusive_ptr(intrusive_ptr&& rhs) noexcept
+            : ptr_(std::exchange(rhs.ptr_, nullptr))
+    {
+    }
+
+    /**
+     * @brief       Move constructor from a pointer to a type that converts to the value type.
+     * @param       rhs : The pointer to move.
+     */
+    template<typename ValueT_>
+    requires std::is_convertible_v<ValueT_*, ValueT*>
+    intrusive_ptr(intrusive_ptr<ValueT_>&& rhs) noexcept
+            : ptr_(rhs.detach())
+    {
+    }
+
+    /**
+     * @brief       Destructor.
+     */
+    ~intrusive_ptr()
+    {
+        if (ptr_ != nullptr)
+        {
+            ptr_->release_reference();
+        }
+    }
+
+    /**
+     * @brief       Copy assignment operator.
+     * @param       rhs : The pointer to copy.
+     * @return      The object who call the method.
+     */
+    intrusive_ptr& operator =(const intrusive_ptr& rhs) noexcept
+    {
+        intrusive_ptr(rhs).swap(*this);
+        return *this;
+    }
+
+    /**
+     * @brief       Move assignment operator.
+     * @param       rhs : The pointer to move.
+     * @return      The object who call the method.
+     */
+    intrusive_ptr& operator =(intrusive_ptr&& rhs) noexcept
+    {
+        intrusive_ptr(std::move(rhs)).swap(*this);
+        return *this;
+    }
+
+    /**
+     * @brief       Dereference operator.
+     * @return      The pointed object.
+     */
+    [[nodiscard]] element_type& operator *() const noexcept
+    {
+        return *ptr_;
+    }
+
+    /**
+     * @brief       Member access operator.
+     * @return      The pointed object.
+     */
+    [[nodiscard]] element_type* operator ->() const noexcept
+    {
+        return ptr_;
+    }
+
+    /**
+     * @brief       Allows knowing whether the pointer points to an object.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    explicit operator bool() const noexcept
+    {
+        return ptr_ != nullptr;
+    }
+
+    /**
+     * @brief       Get the pointed object.
+     * @return      The pointed object, or nullptr if there is none.
+     */
+    [[nodiscard]] element_type* get() const noexcept
+    {
+        return ptr_;
+    }
+
+    /**
+     * @brief       Stop pointing to the object without releasing the reference, which the caller
+     *              takes over.
+     * @return      The pointed object, or nullptr if there is none.
+     */
+    element_type* detach() noexcept
+    {
+        return std::exchange(ptr_, nullptr);
+    }
+
+    /**
+     * @brief       Release the reference to the pointed object, if any, and point to another one.
+     * @param       ptr : The object to point to.
+     */
+    void reset(element_type* ptr = nullptr) noexcept
+    {
+        intrusive_ptr(ptr).swap(*this);
+    }
+
+    /**
+     * @brief       Swap the pointed objects of two pointers.
+     * @param       rhs : The other pointer.
+     */
+    void swap(intrusive_ptr& rhs) noexcept
+    {
+        std::swap(ptr_, rhs.ptr_);
+    }
+
+    /**
+     * @brief       Allows knowing whether two pointers point to the same object.
+     * @param       lhs : The first pointer.
+     * @param       rhs : The second pointer.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename ValueT_>
+    friend bool operator ==(const intrusive_ptr& lhs, const intrusive_ptr<ValueT_>& rhs) noexcept
+    {
+        return lhs.get() == rhs.get();
+    }
+
+private:
+    /** The pointed object. */
+    element_type* ptr_ = nullptr;
+};
+
+/**
+ * @brief       Class that holds the reference count of the objects of a derived class, which are
+ *              pointed by intrusive_ptr and created by make_intrusive. The object is destroyed
+ *              and deallocated through the allocator that created it when its last reference is
+ *              released. The count is atomic, so the objects can be shared between threads.
+ */
+template<typename DerivedT, typename AllocatorT = std::allocator<DerivedT>>
+class ref_counted
+{
+public:
+    /** The type of the derived class. */
+    using derived_type = DerivedT;
+
+    /** The type of the class holding the reference count. */
+    using ref_counted_type = ref_counted;
+
+    /** The allocator type. */
+    using allocator_type =
+            typename std::allocator_traits<AllocatorT>::template rebind_alloc<DerivedT>;
+
+    /**
+     * @brief       Add a reference to the object.
+     */
+    void add_reference() const noexcept
+    {
+        n_refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief       Release a reference to the object, destroying and deallocating it if it was
+     *              the last one.
+     */
+    void release_reference() const noexcept
+    {
+        if (n_refs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            allocator_type alloc = alloc_;
+
+            destroy_and_deallocate(alloc, static_cast<derived_type*>(
+                    const_cast<ref_counted*>(this)));
+        }
+    }
+
+    /**
+     * @brief       Get the number of references to the object.
+     * @return      The number of references to the object.
+     */
+    [[nodiscard]] std::size_t get_reference_count() const noexcept
+    {
+        return n_refs_.load(std::memory_order_relaxed);
+    }
+
+protected:
+    /**
+     * @brief       Default constructor.
+     */
+    ref_counted() noexcept = default;
+
+    /**
+     * @brief       Copy constructor. The copy starts without references.
+     */
+    ref_counted(const ref_counted&) noexcept
+            : ref_counted()
+    {
+    }
+
+    /**
+     * @brief       Copy assignment operator. The references are not copied.
+     * @return      The object who call the method.
+     */
+    ref_counted& operator =(const ref_counted&) noexcept
+    {
+        return *this;
+    }
+
+    /**
+     * @brief       Destructor.
+     */
+    ~ref_counted() = default;
+
+private:
+    /** The number of references to the object. */
+    mutable std::atomic<std::size_t> n_refs_ = 0;
+
+    /** The allocator that created the object. */
+    [[no_unique_address]] allocator_type alloc_;
+
+    template<typename ValueT_, typename AllocatorT_, typename... Ts_>
+    friend intrusive_ptr<ValueT_> make_intrusive(const AllocatorT_& alloc, Ts_&&... args);
+};
+
+/**
+ * @brief       Allocates and constructs an object that inherits from ref_counted using a custom
+ *              allocator, so that the object and its reference count take a single allocation.
+ * @param       alloc : The allocator instance to use for allocating and constructing the object.
+ * @param       args : The arguments to forward to the constructor of `T`.
+ * @return      An intrusive_ptr holding the only reference to the object.
+ */
+template<typename ValueT, typename AllocatorT, typename... Ts>
+intrusive_ptr<ValueT> make_intrusive(const AllocatorT& alloc, Ts&&... args)
+{
+    using ref_counted_type = typename ValueT::ref_counted_type;
+
+    static_assert(std::is_same_v<typename ref_counted_type::derived_type, ValueT>,
+                  "The type must be the one given to ref_counted.");
+
+    ValueT* ptr;
+    typename ref_counted_type::allocator_type value_alloc(alloc);
+
+    allocate_and_construct(value_alloc, ptr, std::forward<Ts>(args)...);
+    static_cast<ref_counted_type*>(ptr)->alloc_ = value_alloc;
+
+    return intrusive_ptr<ValueT>(ptr);
+}
+
+}
+
+#endif
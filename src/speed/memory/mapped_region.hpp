@@ -0,0 +1,555 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        mapped_region.hpp
+ * @brief       mapped_region class header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_MAPPED_REGION_HPP
+#define SPEED_MEMORY_MAPPED_REGION_HPP
+
+#include "../system/platform/compatibility.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <utility>
+
+#ifdef SPEED_GLIBC
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "mapping_flags.hpp"
+#include "operations.hpp"
+
+namespace speed::memory {
+
+/**
+ * @brief       Class that represents a region of memory mapped directly from the operating
+ *              system, which suits large tables. The region can be backed by huge pages, which
+ *              cut the TLB misses of the random accesses, either transparently or from the pages
+ *              reserved by the system, and can be faulted in up front to keep the first touch
+ *              latency out of the hot path. A region asking for transparent huge pages that is at
+ *              least one huge page long is aligned and sized to whole huge pages.
+ */
+class mapped_region
+{
+public:
+    /**
+     * @brief       Default constructor. The region is empty.
+     */
+    mapped_region() noexcept = default;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       sz : The number of bytes.
+     * @param       flgs : The mapping flags.
+     * @throw       std::bad_alloc : If the region can't be mapped.
+     */
+    explicit mapped_region(std::size_t sz, mapping_flags flgs = mf_t::DEFAULT_MAPPING_FLAGS)
+            : sz_(sz)
+            , flgs_(flgs)
+    {
+        data_ = map(sz_, flgs_, &pg_sz_, &thp_);
+    }
+
+    /** @cond */
+    mapped_region(const mapped_region& rhs) = delete;
+
+    mapped_region& operator =(const mapped_region& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Move constructor.
+     * @param       rhs : The region to move.
+     */
+    mapped_region(mapped_region&& rhs) noexcept
+            : data_(std::exchange(rhs.data_, nullptr))
+            , sz_(std::exchange(rhs.sz_, 0))
+            , pg_sz_(std::exchange(rhs.pg_sz_, 0))
+            , flgs_(std::exchange(rhs.flgs_, mf_t::NIL))
+            , thp_(std::exchange(rhs.thp_, false))
+    {
+    }
+
+    /**
+     * @brief       Destructor.
+     */
+    ~mapped_region()
+    {
+        if (data_ != nullptr)
+        {
+            unmap(data_, sz_, flgs_);
+        }
+    }
+
+    /**
+     * @brief       Move assignment operator.
+     * @param       rhs : The region to move.
+     * @return      The object who call the method.
+     */
+    mapped_region& operator =(mapped_region&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            mapped_region tmp(std::move(rhs));
+
+            std::swap(data_, tmp.data_);
+            std::swap(sz_, tmp.sz_);
+            std::swap(pg_sz_, tmp.pg_sz_);
+            std::swap(flgs_, tmp.flgs_);
+            std::swap(thp_, tmp.thp_);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief       Get the address of the region.
+     * @return      The address of the region, or nullptr if the region is empty.
+     */
+    [[nodiscard]] void* get_data() const noexcept
+    {
+        return data_;
+    }
+
+    /**
+     * @brief       Get the number of bytes mapped, which is the requested one rounded up to whole
+     *              pages.
+     * @return      The number of bytes mapped.
+     */
+    [[nodiscard]] std::size_t get_size() const noexcept
+    {
+        return data_ != nullptr ? get_mapping_size(sz_, flgs_) : 0;
+    }
+
+    /**
+     * @brief       Get the size of the pages that were actually obtained, which is the huge page
+     *              size if the region was mapped on reserved huge pages, and the base page size
+     *              otherwise. The transparent huge pages are granted by the kernel as the memory
+     *              is faulted in and don't change the value returned.
+     * @return      The size of the pages obtained, or 0 if the region is empty.
+     */
+    [[nodiscard]] std::size_t get_page_size() const noexcept
+    {
+        return pg_sz_;
+    }
+
+    /**
+     * @brief       Allows knowing whether the kernel accepted to back the region with transparent
+     *              huge pages.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] bool has_transparent_huge_pages() const noexcept
+    {
+        return thp_;
+    }
+
+    /**
+     * @brief       Map a region.
+     * @param       sz : The number of bytes.
+     * @param       flgs : The mapping flags.
+     * @param       pg_sz : If not nullptr, it receives the size of the pages obtained.
+     * @param       thp : If not nullptr, it receives whether the kernel accepted to back the
+     *              region with transparent huge pages.
+     * @return      The address of the region.
+     * @throw       std::bad_alloc : If the region can't be mapped.
+     */
+    [[nodiscard]] static void* map(
+            std::size_t sz,
+            mapping_flags flgs,
+            std::size_t* pg_sz = nullptr,
+            bool* thp = nullptr
+    )
+    {
+        const std::size_t map_sz = get_mapping_size(sz, flgs);
+        const bool popul = (flgs & mf_t::POPULATE) != mf_t::NIL;
+        std::size_t obtnd_pg_sz = get_base_page_size();
+        bool obtnd_thp = false;
+        void* ptr = nullptr;
+
+#ifdef SPEED_GLIBC
+        const int mmap_flgs = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_HUGETLB
+        if ((flgs & mf_t::EXPLICIT_HUGE_PAGES) != mf_t::NIL)
+        {
+            ptr = ::mmap(nullptr, map_sz, PROT_READ | PROT_WRITE,
+                         mmap_flgs | MAP_HUGETLB | (popul ? MAP_POPULATE : 0), -1, 0);
+
+            if (ptr != MAP_FAILED)
+            {
+                obtnd_pg_sz = get_huge_page_size();
+            }
+            else
+            {
+                ptr = nullptr;
+            }
+        }
+#endif
+
+        if (ptr == nullptr)
+        {
+            const std::size_t hpg_sz = get_huge_page_size();
+            const bool thp_req = (flgs & mf_t::TRANSPARENT_HUGE_PAGES) != mf_t::NIL;
+            const bool algn = thp_req && map_sz % hpg_sz == 0;
+            const std::size_t ovr_sz = algn ? map_sz + hpg_sz : map_sz;
+
+            // Populating here would fault small pages in before the advice is given.
+            ptr = ::mmap(nullptr, ovr_sz, PROT_READ | PROT_WRITE,
+                         mmap_flgs | (popul && !thp_req ? MAP_POPULATE : 0), -1, 0);
+
+            if (ptr == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+
+            if (algn)
+            {
+                auto* first = static_cast<std::byte*>(ptr);
+                auto* algnd = reinterpret_cast<std::byte*>(
+                        round_up(reinterpret_cast<std::uintptr_t>(first), hpg_sz));
+                const auto head_sz = static_cast<std::size_t>(algnd - first);
+
+                if (head_sz > 0)
+                {
+                    ::munmap(first, head_sz);
+                }
+
+                if (ovr_sz - head_sz > map_sz)
+                {
+                    ::munmap(algnd + map_sz, ovr_sz - head_sz - map_sz);
+                }
+
+                ptr = algnd;
+            }
+
+#ifdef MADV_HUGEPAGE
+            if (thp_req)
+            {
+                obtnd_thp = ::madvise(ptr, map_sz, MADV_HUGEPAGE) == 0;
+            }
+#endif
+
+            if (popul && thp_req)
+            {
+                populate(ptr, map_sz);
+            }
+        }
+#elif defined(SPEED_WINAPI)
+        if ((flgs & mf_t::EXPLICIT_HUGE_PAGES) != mf_t::NIL)
+        {
+            ptr = ::VirtualAlloc(nullptr, map_sz, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                                 PAGE_READWRITE);
+
+            if (ptr != nullptr)
+            {
+                obtnd_pg_sz = get_huge_page_size();
+            }
+        }
+
+        if (ptr == nullptr)
+        {
+            ptr = ::VirtualAlloc(nullptr, map_sz, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+            if (ptr == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+        }
+
+        if (popul)
+        {
+            populate(ptr, map_sz);
+        }
+#else
+        ptr = allocate_bytes(map_sz, obtnd_pg_sz);
+
+        if (popul)
+        {
+            populate(ptr, map_sz);
+        }
+#endif
+
+        if (pg_sz != nullptr)
+        {
+            *pg_sz = obtnd_pg_sz;
+        }
+
+        if (thp != nullptr)
+        {
+            *thp = obtnd_thp;
+        }
+
+        return ptr;
+    }
+
+    /**
+     * @brief       Unmap a region.
+     * @param       ptr : The address of the region.
+     * @param       sz : The number of bytes given when the region was mapped.
+     * @param       flgs : The mapping flags given when the region was mapped.
+     */
+    static void unmap(
+            void* ptr,
+            [[maybe_unused]] std::size_t sz,
+            [[maybe_unused]] mapping_flags flgs
+    ) noexcept
+    {
+#ifdef SPEED_GLIBC
+        ::munmap(ptr, get_mapping_size(sz, flgs));
+#elif defined(SPEED_WINAPI)
+        ::VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+        deallocate_bytes(ptr, get_mapping_size(sz, flgs), get_base_page_size());
+#endif
+    }
+
+    /**
+     * @brief       Get the number of bytes mapped for a region. It only depends on the requested
+     *              size and the flags, so it's the same whether the huge pages were obtained or
+     *              not, which allows unmapping the region without knowing it.
+     * @param       sz : The number of bytes.
+     * @param       flgs : The mapping flags.
+     * @return      The number of bytes mapped for the region.
+     */
+    [[nodiscard]] static std::size_t get_mapping_size(
+            std::size_t sz,
+            mapping_flags flgs
+    ) noexcept
+    {
+        const std::size_t hpg_sz = get_huge_page_size();
+
+        sz = std::max<std::size_t>(sz, 1);
+
+        if ((flgs & mf_t::EXPLICIT_HUGE_PAGES) != mf_t::NIL ||
+            ((flgs & mf_t::TRANSPARENT_HUGE_PAGES) != mf_t::NIL && sz >= hpg_sz))
+        {
+            return round_up(sz, hpg_sz);
+        }
+
+        return round_up(sz, get_base_page_size());
+    }
+
+    /**
+     * @brief       Get the size of the base pages of the system.
+     * @return      The size of the base pages of the system.
+     */
+    [[nodiscard]] static std::size_t get_base_page_size() noexcept
+    {
+        static const std::size_t pg_sz = []() -> std::size_t {
+#ifdef SPEED_GLIBC
+            const long sys_pg_sz = ::sysconf(_SC_PAGESIZE);
+
+            return sys_pg_sz > 0 ? static_cast<std::size_t>(sys_pg_sz) : DEFAULT_PAGE_SIZE;
+#elif defined(SPEED_WINAPI)
+            SYSTEM_INFO sys_inf;
+
+            ::GetSystemInfo(&sys_inf);
+
+            return sys_inf.dwPageSize;
+#else
+            return DEFAULT_PAGE_SIZE;
+#endif
+        }();
+
+        return pg_sz;
+    }
+
+    /**
+     * @brief       Get the size of the huge pages of the system.
+     * @return      The size of the huge pages of the system.
+     */
+    [[nodiscard]] static std::size_t get_huge_page_size() noexcept
+    {
+        static const std::size_t hpg_sz = []() -> std::size_t {
+#ifdef SPEED_GLIBC
+            std::FILE* meminf = std::fopen("/proc/meminfo", "r");
+            std::size_t sz_kb = 0;
+            char ln[128];
+
+            if (meminf != nullptr)
+            {
+                while (std::fgets(ln, sizeof(ln), meminf) != nullptr)
+                {
+                    if (std::sscanf(ln, "Hugepagesize: %zu kB", &sz_kb) == 1)
+                    {
+                        break;
+                    }
+                }
+
+                std::fclose(meminf);
+            }
+
+            return sz_kb > 0 ? sz_kb * 1024 : DEFAULT_HUGE_PAGE_SIZE;
+#elif defined(SPEED_WINAPI)
+            const std::size_t lrg_pg_sz = ::GetLargePageMinimum();
+
+            return lrg_pg_sz > 0 ? lrg_pg_sz : DEFAULT_HUGE_PAGE_SIZE;
+#else
+            return DEFAULT_HUGE_PAGE_SIZE;
+#endif
+        }();
+
+        return hpg_sz;
+    }
+
+private:
+    /** The page size used when the system one can't be obtained. */
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 4096;
+
+    /** The huge page size used when the system one can't be obtained. */
+    static constexpr std::size_t DEFAULT_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /**
+     * @brief       Round a value up to a multiple of a power of two.
+     * @param       val : The value.
+     * @param       algn : The power of two.
+     * @return      The rounded value.
+     */
+    [[nodiscard]] static constexpr std::size_t round_up(std::size_t val, std::size_t algn) noexcept
+    {
+        return (val + algn - 1) & ~(algn - 1);
+    }
+
+    /**
+     * @brief       Fault all the pages of a region in by writing to each of them.
+     * @param       ptr : The address of the region.
+     * @param       sz : The number of bytes of the region.
+     */
+    static void populate(void* ptr, std::size_t sz) noexcept
+    {
+        auto* first = static_cast<volatile std::byte*>(ptr);
+
+        for (std::size_t i = 0; i < sz; i += get_base_page_size())
+        {
+            first[i] = std::byte{0};
+        }
+    }
+
+    /** The address of the region. */
+    void* data_ = nullptr;
+
+    /** The number of bytes requested. */
+    std::size_t sz_ = 0;
+
+    /** The size of the pages obtained. */
+    std::size_t pg_sz_ = 0;
+
+    /** The mapping flags. */
+    mapping_flags flgs_ = mf_t::NIL;
+
+    /** Whether the kernel accepted to back the region with transparent huge pages. */
+    bool thp_ = false;
+};
+
+/**
+ * @brief       Class that represents a standard allocator that maps each allocation as its own
+ *              region, which suits the large tables, like the arena of a big cache, a big hash
+ *              map or a sort buffer, but is wasteful for anything smaller than a few pages.
+ *              Allocators with different flags aren't interchangeable.
+ */
+template<typename ValueT>
+class large_allocator
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       flgs : The mapping flags.
+     */
+    large_allocator(mapping_flags flgs = mf_t::DEFAULT_MAPPING_FLAGS) noexcept
+            : flgs_(flgs)
+    {
+    }
+
+    /**
+     * @brief       Copy constructor from an allocator of another type.
+     * @param       rhs : The allocator to copy.
+     */
+    template<typename ValueT_>
+    large_allocator(const large_allocator<ValueT_>& rhs) noexcept
+            : flgs_(rhs.get_flags())
+    {
+    }
+
+    /**
+     * @brief       Allocate memory for a number of values.
+     * @param       n : The number of values.
+     * @return      The address of the allocated memory.
+     * @throw       std::bad_alloc : If the memory can't be mapped.
+     */
+    [[nodiscard]] value_type* allocate(std::size_t n)
+    {
+        if (n > SIZE_MAX / sizeof(value_type))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        return static_cast<value_type*>(mapped_region::map(n * sizeof(value_type), flgs_));
+    }
+
+    /**
+     * @brief       Deallocate memory.
+     * @param       ptr : The address of the memory.
+     * @param       n : The number of values.
+     */
+    void deallocate(value_type* ptr, std::size_t n) noexcept
+    {
+        mapped_region::unmap(ptr, n * sizeof(value_type), flgs_);
+    }
+
+    /**
+     * @brief       Get the mapping flags.
+     * @return      The mapping flags.
+     */
+    [[nodiscard]] mapping_flags get_flags() const noexcept
+    {
+        return flgs_;
+    }
+
+    /**
+     * @brief       Allows knowing whether two allocators map their regions the same way.
+     * @param       lhs : The first allocator.
+     * @param       rhs : The second allocator.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename ValueT_>
+    friend bool operator ==(const large_allocator& lhs, const large_allocator<ValueT_>& rhs)
+            noexcept
+    {
+        return lhs.flgs_ == rhs.get_flags();
+    }
+
+private:
+    /** The mapping flags. */
+    mapping_flags flgs_;
+};
+
+}
+
+#endif
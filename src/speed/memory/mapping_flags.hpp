@@ -0,0 +1,71 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        mapping_flags.hpp
+ * @brief       mapping_flags enum header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_MAPPING_FLAGS_HPP
+#define SPEED_MEMORY_MAPPING_FLAGS_HPP
+
+#include <cstdint>
+
+#include "../scalars/scalars.hpp"
+
+namespace speed::memory {
+
+/**
+ * @brief       Contains all the mapped region flags constants.
+ */
+enum class mapping_flags : std::uint8_t
+{
+    /** Null flag. */
+    NIL = 0x0,
+    
+    /** Advise the kernel to back the region with transparent huge pages. */
+    TRANSPARENT_HUGE_PAGES = 0x1,
+    
+    /** Try to map the region on reserved huge pages, falling back to normal pages. */
+    EXPLICIT_HUGE_PAGES = 0x2,
+    
+    /** Fault all the pages in when the region is mapped instead of on first touch. */
+    POPULATE = 0x4,
+    
+    /** All mapped region flags. */
+    ALL = 0x7,
+    
+    /** The default flags used by the mapped regions. */
+    DEFAULT_MAPPING_FLAGS = TRANSPARENT_HUGE_PAGES,
+};
+
+/** Contains all the mapped region flags constants. Alias of 'mapping_flags' enumeration. */
+using mf_t = mapping_flags;
+
+}
+
+/** @cond */
+template<>
+struct speed::scalars::is_flag_enum<speed::memory::mapping_flags>
+        : std::true_type {};
+/** @endcond */
+
+#endif
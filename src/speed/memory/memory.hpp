@@ -27,7 +27,15 @@
 #ifndef SPEED_MEMORY_MEMORY_HPP
 #define SPEED_MEMORY_MEMORY_HPP
 
+#include "allocator_delete.hpp"
+#include "fixed_block_pool.hpp"
+#include "intrusive_ptr.hpp"
+#include "mapped_region.hpp"
+#include "mapping_flags.hpp"
+#include "monotonic_arena.hpp"
 #include "operations.hpp"
+#include "resource_scope.hpp"
+#include "thread_caching_heap.hpp"
 
 namespace speed {
 
@@ -0,0 +1,374 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        monotonic_arena.hpp
+ * @brief       monotonic_arena class header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_MONOTONIC_ARENA_HPP
+#define SPEED_MEMORY_MONOTONIC_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "operations.hpp"
+#include "resource_scope.hpp"
+
+namespace speed::memory {
+
+/**
+ * @brief       Class that represents a memory arena that hands out memory by bumping a pointer
+ *              through a chain of blocks, each twice as large as the previous one. Deallocating
+ *              only reclaims the memory of the last allocation, everything else is released at
+ *              once when the arena is released or destroyed, which makes it fit for a working set
+ *              that dies all together. The arena can start with a buffer provided by the caller,
+ *              typically on the stack, and only requests blocks once it is exhausted. It isn't
+ *              thread-safe.
+ */
+class monotonic_arena
+{
+public:
+    /** The default size of the first block. */
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4096;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       blk_sz : The size of the first block.
+     */
+    explicit monotonic_arena(std::size_t blk_sz = DEFAULT_BLOCK_SIZE) noexcept
+            : frst_blk_sz_(std::max(blk_sz, MIN_BLOCK_SIZE))
+            , nxt_blk_sz_(frst_blk_sz_)
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       buf : The buffer used before requesting any block.
+     * @param       buf_sz : The size of the buffer.
+     * @param       blk_sz : The size of the first block.
+     */
+    monotonic_arena(void* buf, std::size_t buf_sz, std::size_t blk_sz = DEFAULT_BLOCK_SIZE)
+            noexcept
+            : buf_(static_cast<std::byte*>(buf))
+            , buf_sz_(buf_sz)
+            , cur_(buf_)
+            , end_(buf_ + buf_sz)
+            , frst_blk_sz_(std::max(blk_sz, MIN_BLOCK_SIZE))
+            , nxt_blk_sz_(frst_blk_sz_)
+    {
+    }
+
+    /** @cond */
+    monotonic_arena(const monotonic_arena& rhs) = delete;
+
+    monotonic_arena(monotonic_arena&& rhs) = delete;
+
+    monotonic_arena& operator =(const monotonic_arena& rhs) = delete;
+
+    monotonic_arena& operator =(monotonic_arena&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Destructor.
+     */
+    ~monotonic_arena()
+    {
+        release();
+    }
+
+    /**
+     * @brief       Allocate memory.
+     * @param       sz : The number of bytes.
+     * @param       algn : The alignment, a power of two.
+     * @return      The address of the allocated memory.
+     * @throw       std::bad_alloc : If a new block can't be obtained.
+     */
+    [[nodiscard]] void* allocate(std::size_t sz, std::size_t algn = alignof(std::max_align_t))
+    {
+        const auto remng_sz = static_cast<std::size_t>(end_ - cur_);
+        std::size_t pad = get_padding(cur_, algn);
+
+        if (cur_ == nullptr || pad > remng_sz || sz > remng_sz - pad)
+        {
+            add_block(sz, algn);
+            pad = get_padding(cur_, algn);
+        }
+
+        std::byte* const ptr = cur_ + pad;
+
+        cur_ = ptr + sz;
+
+        return ptr;
+    }
+
+    /**
+     * @brief       Deallocate memory. The memory is only reclaimed if it was the last allocation.
+     * @param       ptr : The address of the memory.
+     * @param       sz : The number of bytes.
+     */
+    void deallocate(void* ptr, std::size_t sz) noexcept
+    {
+        if (static_cast<std::byte*>(ptr) + sz == cur_)
+        {
+            cur_ = static_cast<std::byte*>(ptr);
+        }
+    }
+
+    /**
+     * @brief       Release all the blocks and start again from the buffer provided at
+     *              construction. All the memory handed out becomes invalid.
+     */
+    void release() noexcept
+    {
+        while (blks_ != nullptr)
+        {
+            block_header* prev = blks_->prev_;
+
+            deallocate_bytes(blks_, blks_->sz_, alignof(block_header));
+            blks_ = prev;
+        }
+
+        cur_ = buf_;
+        end_ = buf_ + buf_sz_;
+        nxt_blk_sz_ = frst_blk_sz_;
+        n_blks_ = 0;
+    }
+
+    /**
+     * @brief       Get the number of blocks requested since the last release.
+     * @return      The number of blocks requested since the last release.
+     */
+    [[nodiscard]] std::size_t get_block_count() const noexcept
+    {
+        return n_blks_;
+    }
+
+    /**
+     * @brief       Get the number of bytes that can still be allocated without requesting a block.
+     * @return      The number of bytes that can still be allocated without requesting a block.
+     */
+    [[nodiscard]] std::size_t get_remaining_size() const noexcept
+    {
+        return static_cast<std::size_t>(end_ - cur_);
+    }
+
+private:
+    /**
+     * @brief       Struct that represents the header at the start of each block.
+     */
+    struct block_header
+    {
+        /** The previous block. */
+        block_header* prev_;
+
+        /** The size of the block, header included. */
+        std::size_t sz_;
+    };
+
+    /** The minimum size of a block. */
+    static constexpr std::size_t MIN_BLOCK_SIZE = 64;
+
+    /**
+     * @brief       Get the number of bytes to skip to align a pointer up. It is computed apart from
+     *              the pointer, so it can be checked against the space left before forming an
+     *              address that could be past the end of the block.
+     * @param       ptr : The pointer.
+     * @param       algn : The alignment, a power of two.
+     * @return      The number of bytes to skip.
+     */
+    static std::size_t get_padding(const std::byte* ptr, std::size_t algn) noexcept
+    {
+        const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+
+        return (algn - (addr & (algn - 1))) & (algn - 1);
+    }
+
+    /**
+     * @brief       Request a block large enough for an allocation.
+     * @param       sz : The number of bytes of the allocation.
+     * @param       algn : The alignment of the allocation.
+     * @throw       std::bad_alloc : If the block can't be obtained.
+     */
+    void add_block(std::size_t sz, std::size_t algn)
+    {
+        constexpr std::size_t max_algn = alignof(std::max_align_t);
+
+        if (sz > SIZE_MAX - sizeof(block_header) - algn - max_algn)
+        {
+            throw std::bad_alloc();
+        }
+
+        // The block sizes are kept a multiple of the maximum alignment, so the end of every block
+        // is aligned for any fundamental type.
+        const std::size_t blk_sz = (std::max(nxt_blk_sz_, sizeof(block_header) + sz + algn) +
+                max_algn - 1) & ~(max_algn - 1);
+        auto* blk = static_cast<block_header*>(allocate_bytes(blk_sz, alignof(block_header)));
+
+        blk->prev_ = blks_;
+        blk->sz_ = blk_sz;
+        blks_ = blk;
+        cur_ = reinterpret_cast<std::byte*>(blk + 1);
+        end_ = reinterpret_cast<std::byte*>(blk) + blk_sz;
+        nxt_blk_sz_ = blk_sz * 2;
+        ++n_blks_;
+    }
+
+private:
+    /** The buffer provided at construction. */
+    std::byte* buf_ = nullptr;
+
+    /** The size of the buffer provided at construction. */
+    std::size_t buf_sz_ = 0;
+
+    /** The next byte to hand out. */
+    std::byte* cur_ = nullptr;
+
+    /** The end of the current block. */
+    std::byte* end_ = nullptr;
+
+    /** The last block requested. */
+    block_header* blks_ = nullptr;
+
+    /** The size of the first block. */
+    std::size_t frst_blk_sz_;
+
+    /** The size of the next block. */
+    std::size_t nxt_blk_sz_;
+
+    /** The number of blocks requested since the last release. */
+    std::size_t n_blks_ = 0;
+};
+
+/**
+ * @brief       Class that represents a standard allocator that gets its memory from a monotonic
+ *              arena. A default constructed allocator uses the current arena of the thread, set
+ *              with a resource_scope, or the global operator new if there is none. The arena must
+ *              outlive the allocator and everything allocated with it.
+ */
+template<typename ValueT>
+class monotonic_allocator
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /**
+     * @brief       Default constructor.
+     */
+    monotonic_allocator() noexcept
+            : arna_(resource_scope<monotonic_arena>::get_current())
+    {
+    }
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       arna : The arena.
+     */
+    monotonic_allocator(monotonic_arena& arna) noexcept
+            : arna_(&arna)
+    {
+    }
+
+    /**
+     * @brief       Copy constructor from an allocator of another type.
+     * @param       rhs : The allocator to copy.
+     */
+    template<typename ValueT_>
+    monotonic_allocator(const monotonic_allocator<ValueT_>& rhs) noexcept
+            : arna_(rhs.get_arena())
+    {
+    }
+
+    /**
+     * @brief       Allocate memory for a number of values.
+     * @param       n : The number of values.
+     * @return      The address of the allocated memory.
+     * @throw       std::bad_alloc : If the memory can't be obtained.
+     */
+    [[nodiscard]] value_type* allocate(std::size_t n)
+    {
+        if (n > SIZE_MAX / sizeof(value_type))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        if (arna_ == nullptr)
+        {
+            return static_cast<value_type*>(
+                    allocate_bytes(n * sizeof(value_type), alignof(value_type)));
+        }
+
+        return static_cast<value_type*>(arna_->allocate(n * sizeof(value_type),
+                                                        alignof(value_type)));
+    }
+
+    /**
+     * @brief       Deallocate memory.
+     * @param       ptr : The address of the memory.
+     * @param       n : The number of values.
+     */
+    void deallocate(value_type* ptr, std::size_t n) noexcept
+    {
+        if (arna_ == nullptr)
+        {
+            deallocate_bytes(ptr, n * sizeof(value_type), alignof(value_type));
+        }
+        else
+        {
+            arna_->deallocate(ptr, n * sizeof(value_type));
+        }
+    }
+
+    /**
+     * @brief       Get the arena.
+     * @return      The arena, or nullptr if the global operator new is used.
+     */
+    [[nodiscard]] monotonic_arena* get_arena() const noexcept
+    {
+        return arna_;
+    }
+
+    /**
+     * @brief       Allows knowing whether two allocators use the same arena.
+     * @param       lhs : The first allocator.
+     * @param       rhs : The second allocator.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename ValueT_>
+    friend bool operator ==(
+            const monotonic_allocator& lhs,
+            const monotonic_allocator<ValueT_>& rhs
+    ) noexcept
+    {
+        return lhs.arna_ == rhs.get_arena();
+    }
+
+private:
+    /** The arena. */
+    monotonic_arena* arna_;
+};
+
+}
+
+#endif
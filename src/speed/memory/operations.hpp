@@ -27,9 +27,13 @@
 #ifndef SPEED_MEMORY_OPERATIONS_HPP
 #define SPEED_MEMORY_OPERATIONS_HPP
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <utility>
 
+#include "allocator_delete.hpp"
+
 namespace speed::memory {
 
 /**
@@ -42,19 +46,20 @@ namespace speed::memory {
 template<typename ValueT, typename AllocatorT, typename... Ts>
 ValueT* allocate_and_construct(const AllocatorT& alloc, ValueT*& ptr, Ts&&... args)
 {
-    using allocator_traits_type = std::allocator_traits<AllocatorT>;
-    using value_allocator_type = typename allocator_traits_type::template rebind_alloc<ValueT>;
+    using value_allocator_type =
+            typename std::allocator_traits<AllocatorT>::template rebind_alloc<ValueT>;
+    using value_allocator_traits_type = std::allocator_traits<value_allocator_type>;
     
     value_allocator_type value_alloc(alloc);
-    ptr = allocator_traits_type::allocate(value_alloc, 1);
+    ptr = value_allocator_traits_type::allocate(value_alloc, 1);
     
     try
     {
-        allocator_traits_type::construct(value_alloc, ptr, std::forward<Ts>(args)...);
+        value_allocator_traits_type::construct(value_alloc, ptr, std::forward<Ts>(args)...);
     }
     catch (...)
     {
-        allocator_traits_type::deallocate(value_alloc, ptr, 1);
+        value_allocator_traits_type::deallocate(value_alloc, ptr, 1);
         throw;
     }
 
@@ -65,29 +70,81 @@ ValueT* allocate_and_construct(const AllocatorT& alloc, ValueT*& ptr, Ts&&... ar
  * @brief       Allocates and constructs an object using a custom allocator.
  * @param       alloc : The allocator instance to use for allocating and constructing the object.
  * @param       args : The arguments to forward to the constructor of `T`.
- * @return      A `std::unique_ptr<T, std::function<void(T*)>>` that owns the allocated and
- *              constructed object,
+ * @return      A `std::unique_ptr` that owns the allocated and constructed object, and whose
+ *              deleter destroys and deallocates it through the allocator.
  */
 template <typename ValueT, typename AllocatorT, typename... Ts>
-std::unique_ptr<ValueT> allocate_unique(
+std::unique_ptr<ValueT, allocator_delete<ValueT,
+        typename std::allocator_traits<AllocatorT>::template rebind_alloc<ValueT>>>
+allocate_unique(
         const AllocatorT& alloc,
         Ts&&... args
 )
 {
     using allocator_traits_type = std::allocator_traits<AllocatorT>;
     using value_allocator_type = typename allocator_traits_type::template rebind_alloc<ValueT>;
+    using deleter_type = allocator_delete<ValueT, value_allocator_type>;
     
     ValueT* ptr;
     value_allocator_type value_alloc(alloc);
     
-    allocate_and_construct(alloc, ptr, std::forward<Ts>(args)...);
+    allocate_and_construct(value_alloc, ptr, std::forward<Ts>(args)...);
+
+    return std::unique_ptr<ValueT, deleter_type>(ptr, deleter_type(value_alloc));
+}
+
+/**
+ * @brief       Allocates and constructs an object using a custom allocator, placing the object
+ *              and its reference counts in a single allocation.
+ * @param       alloc : The allocator instance to use for allocating and constructing the object.
+ * @param       args : The arguments to forward to the constructor of `T`.
+ * @return      A `std::shared_ptr` that owns the allocated and constructed object.
+ */
+template <typename ValueT, typename AllocatorT, typename... Ts>
+std::shared_ptr<ValueT> allocate_shared(
+        const AllocatorT& alloc,
+        Ts&&... args
+)
+{
+    using allocator_traits_type = std::allocator_traits<AllocatorT>;
+    using value_allocator_type = typename allocator_traits_type::template rebind_alloc<ValueT>;
+    
+    return std::allocate_shared<ValueT>(value_allocator_type(alloc), std::forward<Ts>(args)...);
+}
 
-    // auto deleter = [value_alloc](ValueT* p) mutable {
-    //     std::allocator_traits<value_allocator_type>::destroy(value_alloc, p);
-    //     std::allocator_traits<value_allocator_type>::deallocate(value_alloc, p, 1);
-    // };
+/**
+ * @brief       Allocate raw memory with the global operator new, using its aligned overload when
+ *              the alignment exceeds the default one.
+ * @param       sz : The number of bytes.
+ * @param       algn : The alignment, a power of two.
+ * @return      The address of the allocated memory.
+ */
+inline void* allocate_bytes(std::size_t sz, std::size_t algn)
+{
+    if (algn > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        return ::operator new(sz, std::align_val_t(algn));
+    }
+    
+    return ::operator new(sz);
+}
 
-    return std::unique_ptr<ValueT>(ptr);
+/**
+ * @brief       Deallocate raw memory obtained with allocate_bytes.
+ * @param       ptr : The address of the memory.
+ * @param       sz : The number of bytes.
+ * @param       algn : The alignment, a power of two.
+ */
+inline void deallocate_bytes(void* ptr, std::size_t sz, std::size_t algn) noexcept
+{
+    if (algn > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        ::operator delete(ptr, sz, std::align_val_t(algn));
+    }
+    else
+    {
+        ::operator delete(ptr, sz);
+    }
 }
 
 /**
@@ -123,13 +180,14 @@ void destroy_at(ValueT* ptr)
 template<typename ValueT, typename AllocatorT>
 void destroy_and_deallocate(const AllocatorT& alloc, ValueT* ptr)
 {
-    using allocator_traits_type = std::allocator_traits<AllocatorT>;
-    using value_allocator_type = typename allocator_traits_type::template rebind_alloc<ValueT>;
+    using value_allocator_type =
+            typename std::allocator_traits<AllocatorT>::template rebind_alloc<ValueT>;
+    using value_allocator_traits_type = std::allocator_traits<value_allocator_type>;
     
     value_allocator_type value_alloc(alloc);
     
-    allocator_traits_type::destroy(value_alloc, ptr);
-    allocator_traits_type::deallocate(value_alloc, ptr, 1);
+    value_allocator_traits_type::destroy(value_alloc, ptr);
+    value_allocator_traits_type::deallocate(value_alloc, ptr, 1);
 }
 
 }
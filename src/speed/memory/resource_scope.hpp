@@ -0,0 +1,95 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        resource_scope.hpp
+ * @brief       resource_scope class header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_RESOURCE_SCOPE_HPP
+#define SPEED_MEMORY_RESOURCE_SCOPE_HPP
+
+#include <utility>
+
+namespace speed::memory {
+
+/**
+ * @brief       Class that makes a memory resource the current one of the calling thread while it
+ *              lives. The library default constructs its allocators, so the allocators of the
+ *              memory resources bind to the current resource when they are default constructed;
+ *              for instance an arg parser built inside the scope of an arena gets all of its
+ *              memory from it. The scopes can be nested, and the previous resource becomes the
+ *              current one again when a scope is destroyed.
+ */
+template<typename ResourceT>
+class resource_scope
+{
+public:
+    /** The resource type. */
+    using resource_type = ResourceT;
+
+    /**
+     * @brief       Constructor with parameters.
+     * @param       res : The resource that becomes the current one.
+     */
+    explicit resource_scope(resource_type& res) noexcept
+            : prev_(std::exchange(cur_, &res))
+    {
+    }
+
+    /** @cond */
+    resource_scope(const resource_scope& rhs) = delete;
+
+    resource_scope(resource_scope&& rhs) = delete;
+
+    resource_scope& operator =(const resource_scope& rhs) = delete;
+
+    resource_scope& operator =(resource_scope&& rhs) = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Destructor.
+     */
+    ~resource_scope()
+    {
+        cur_ = prev_;
+    }
+
+    /**
+     * @brief       Get the current resource of the calling thread.
+     * @return      The current resource, or nullptr if there is none.
+     */
+    [[nodiscard]] static resource_type* get_current() noexcept
+    {
+        return cur_;
+    }
+
+private:
+    /** The current resource of each thread. */
+    inline static thread_local resource_type* cur_ = nullptr;
+
+    /** The resource that was the current one when the scope was created. */
+    resource_type* prev_;
+};
+
+}
+
+#endif
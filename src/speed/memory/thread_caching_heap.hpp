@@ -0,0 +1,588 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        thread_caching_heap.hpp
+ * @brief       thread_caching_heap class header.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#ifndef SPEED_MEMORY_THREAD_CACHING_HEAP_HPP
+#define SPEED_MEMORY_THREAD_CACHING_HEAP_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "operations.hpp"
+
+namespace speed::memory {
+
+/**
+ * @brief       Class that represents a process wide heap of small blocks, grouped in size classes
+ *              of 16 bytes up to 256 bytes. Each thread allocates and deallocates from its own
+ *              cache without any synchronization. The caches exchange batches of blocks with a
+ *              lock-free central free list of each size class: a cache takes batches when it
+ *              runs out of blocks, and gives a batch back when it holds too many, which is how
+ *              the blocks deallocated by a thread other than the one that allocated them return
+ *              to the rest of the threads. A cache gives all of its blocks back when its thread
+ *              exits. The chunks the blocks are carved from are kept for the lifetime of the
+ *              process.
+ */
+class thread_caching_heap
+{
+public:
+    /** The size of the largest block. */
+    static constexpr std::size_t MAX_BLOCK_SIZE = 256;
+
+    /** The alignment of the blocks, which is also the size difference between size classes. */
+    static constexpr std::size_t BLOCK_ALIGNMENT = 16;
+
+    /** The number of blocks exchanged at once between a thread cache and a central free list. */
+    static constexpr std::size_t BATCH_SIZE = 32;
+
+    /** @cond */
+    thread_caching_heap() = delete;
+    /** @endcond */
+
+    /**
+     * @brief       Allocate a block.
+     * @param       sz : The number of bytes, which can't exceed MAX_BLOCK_SIZE.
+     * @return      The address of the block.
+     * @throw       std::bad_alloc : If a new chunk can't be obtained.
+     */
+    [[nodiscard]] static void* allocate(std::size_t sz)
+    {
+        const std::size_t cls = get_size_class(sz);
+        thread_cache* cache = get_thread_cache();
+
+        if (cache == nullptr)
+        {
+            return allocate_bytes(get_block_size(cls), BLOCK_ALIGNMENT);
+        }
+
+        return cache->allocate(cls);
+    }
+
+    /**
+     * @brief       Deallocate a block, which may have been allocated by another thread.
+     * @param       ptr : The address of the block.
+     * @param       sz : The number of bytes given when the block was allocated.
+     */
+    static void deallocate(void* ptr, std::size_t sz) noexcept
+    {
+        const std::size_t cls = get_size_class(sz);
+        thread_cache* cache = get_thread_cache();
+
+        if (cache == nullptr)
+        {
+            push_batches(cls, ::new (ptr) free_block{nullptr, nullptr});
+        }
+        else
+        {
+            cache->deallocate(ptr, cls);
+        }
+    }
+
+    /**
+     * @brief       Allows knowing whether a number of bytes with an alignment fit in a block.
+     * @param       sz : The number of bytes.
+     * @param       algn : The alignment.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    [[nodiscard]] static constexpr bool fits(std::size_t sz, std::size_t algn) noexcept
+    {
+        return sz <= MAX_BLOCK_SIZE && algn <= BLOCK_ALIGNMENT;
+    }
+
+    /**
+     * @brief       Get the number of chunks requested by the heap.
+     * @return      The number of chunks requested by the heap.
+     */
+    [[nodiscard]] static std::size_t get_chunk_count() noexcept
+    {
+        return n_chnks_.load(std::memory_order_relaxed);
+    }
+
+private:
+    /** The number of size classes. */
+    static constexpr std::size_t N_CLASSES = MAX_BLOCK_SIZE / BLOCK_ALIGNMENT;
+
+    /** The size of a chunk. */
+    static constexpr std::size_t CHUNK_SIZE = 1 << 16;
+
+    /** The largest number of batches a thread cache keeps aside for a size class. */
+    static constexpr std::size_t MAX_SPARE_BATCHES = 8;
+
+    /** The size of a cache line. */
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @brief       Struct that represents a free block. The first block of a batch links the
+     *              next batch.
+     */
+    struct free_block
+    {
+        /** The next block of the batch. */
+        free_block* nxt_;
+
+        /** The next batch. */
+        free_block* nxt_btch_;
+    };
+
+    static_assert(sizeof(free_block) <= BLOCK_ALIGNMENT);
+
+    /**
+     * @brief       Struct that represents the header placed at the beginning of each chunk.
+     */
+    struct chunk_header
+    {
+        /** The previous chunk. */
+        chunk_header* prev_;
+    };
+
+    /**
+     * @brief       Struct that represents the central free list of a size class, which is a stack
+     *              of batches. Pushing a batch is a single compare and swap, while popping takes
+     *              the whole stack at once, which can't suffer from the ABA problem.
+     */
+    struct alignas(CACHE_LINE_SIZE) central_list
+    {
+        /** The first batch. */
+        std::atomic<free_block*> btchs_;
+    };
+
+    /**
+     * @brief       Class that represents the cache of a thread.
+     */
+    class thread_cache
+    {
+    public:
+        /**
+         * @brief       Default constructor.
+         */
+        thread_cache() noexcept = default;
+
+        /** @cond */
+        thread_cache(const thread_cache& rhs) = delete;
+
+        thread_cache(thread_cache&& rhs) = delete;
+
+        thread_cache& operator =(const thread_cache& rhs) = delete;
+
+        thread_cache& operator =(thread_cache&& rhs) = delete;
+        /** @endcond */
+
+        /**
+         * @brief       Destructor. All the blocks are given back to the central free lists.
+         */
+        ~thread_cache()
+        {
+            dstryd_ = true;
+
+            for (std::size_t cls = 0; cls < N_CLASSES; ++cls)
+            {
+                flush(cls);
+            }
+        }
+
+        /**
+         * @brief       Allocate a block.
+         * @param       cls : The size class.
+         * @return      The address of the block.
+         */
+        [[nodiscard]] void* allocate(std::size_t cls)
+        {
+            class_list& lst = lsts_[cls];
+
+            if (lst.hd_ == nullptr)
+            {
+                refill(cls);
+            }
+
+            free_block* blk = lst.hd_;
+
+            lst.hd_ = blk->nxt_;
+            --lst.n_;
+
+            return blk;
+        }
+
+        /**
+         * @brief       Deallocate a block.
+         * @param       ptr : The address of the block.
+         * @param       cls : The size class.
+         */
+        void deallocate(void* ptr, std::size_t cls) noexcept
+        {
+            class_list& lst = lsts_[cls];
+
+            lst.hd_ = ::new (ptr) free_block{lst.hd_, nullptr};
+
+            if (++lst.n_ > 2 * BATCH_SIZE)
+            {
+                release_batch(cls);
+            }
+        }
+
+    private:
+        /**
+         * @brief       Struct that represents the blocks of a size class held by the cache.
+         */
+        struct class_list
+        {
+            /** The first free block. */
+            free_block* hd_ = nullptr;
+
+            /** The number of free blocks. */
+            std::size_t n_ = 0;
+
+            /** The first of the batches kept aside. */
+            free_block* spre_btchs_ = nullptr;
+        };
+
+        /**
+         * @brief       Take a batch for a size class, from the batches kept aside, or else from
+         *              the central free list, or else from a new chunk.
+         * @param       cls : The size class.
+         * @throw       std::bad_alloc : If a new chunk can't be obtained.
+         */
+        void refill(std::size_t cls)
+        {
+            class_list& lst = lsts_[cls];
+
+            if (lst.spre_btchs_ == nullptr)
+            {
+                free_block* btchs = pop_batches(cls);
+
+                lst.spre_btchs_ = keep_spare_batches(cls, btchs ? btchs : carve_chunk(cls));
+            }
+
+            lst.hd_ = lst.spre_btchs_;
+            lst.spre_btchs_ = lst.hd_->nxt_btch_;
+            lst.n_ = 0;
+
+            for (free_block* blk = lst.hd_; blk != nullptr; blk = blk->nxt_)
+            {
+                ++lst.n_;
+            }
+        }
+
+        /**
+         * @brief       Give a batch of the least recently deallocated blocks of a size class to
+         *              the central free list.
+         * @param       cls : The size class.
+         */
+        void release_batch(std::size_t cls) noexcept
+        {
+            class_list& lst = lsts_[cls];
+            free_block* lst_kept = lst.hd_;
+
+            for (std::size_t i = 1; i < lst.n_ - BATCH_SIZE; ++i)
+            {
+                lst_kept = lst_kept->nxt_;
+            }
+
+            free_block* btch = lst_kept->nxt_;
+
+            lst_kept->nxt_ = nullptr;
+            btch->nxt_btch_ = nullptr;
+            lst.n_ -= BATCH_SIZE;
+
+            push_batches(cls, btch);
+        }
+
+        /**
+         * @brief       Give all the blocks of a size class to the central free list.
+         * @param       cls : The size class.
+         */
+        void flush(std::size_t cls) noexcept
+        {
+            class_list& lst = lsts_[cls];
+            free_block* btchs = lst.spre_btchs_;
+
+            while (lst.hd_ != nullptr)
+            {
+                free_block* btch = lst.hd_;
+                free_block* lst_blk = btch;
+
+                for (std::size_t i = 1; i < BATCH_SIZE && lst_blk->nxt_ != nullptr; ++i)
+                {
+                    lst_blk = lst_blk->nxt_;
+                }
+
+                lst.hd_ = lst_blk->nxt_;
+                lst_blk->nxt_ = nullptr;
+                btch->nxt_btch_ = btchs;
+                btchs = btch;
+            }
+
+            lst = class_list();
+
+            if (btchs != nullptr)
+            {
+                push_batches(cls, btchs);
+            }
+        }
+
+        /** The blocks of each size class. */
+        class_list lsts_[N_CLASSES];
+    };
+
+    /**
+     * @brief       Get the cache of the calling thread.
+     * @return      The cache of the calling thread, or nullptr if it was already destroyed
+     *              because the thread is exiting.
+     */
+    [[nodiscard]] static thread_cache* get_thread_cache() noexcept
+    {
+        if (dstryd_)
+        {
+            return nullptr;
+        }
+
+        thread_local thread_cache cache;
+
+        return &cache;
+    }
+
+    /**
+     * @brief       Get the size class of a number of bytes.
+     * @param       sz : The number of bytes.
+     * @return      The size class.
+     */
+    [[nodiscard]] static constexpr std::size_t get_size_class(std::size_t sz) noexcept
+    {
+        return sz == 0 ? 0 : (sz - 1) / BLOCK_ALIGNMENT;
+    }
+
+    /**
+     * @brief       Get the size of the blocks of a size class.
+     * @param       cls : The size class.
+     * @return      The size of the blocks of the size class.
+     */
+    [[nodiscard]] static constexpr std::size_t get_block_size(std::size_t cls) noexcept
+    {
+        return (cls + 1) * BLOCK_ALIGNMENT;
+    }
+
+    /**
+     * @brief       Take all the batches of a central free list.
+     * @param       cls : The size class.
+     * @return      The first batch, or nullptr if there is none.
+     */
+    [[nodiscard]] static free_block* pop_batches(std::size_t cls) noexcept
+    {
+        return cntrl_lsts_[cls].btchs_.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    /**
+     * @brief       Push a chain of batches in a central free list. The last batch of the chain is
+     *              linked to the first batch of the list and the chain is swapped in with a single
+     *              compare-and-swap. The list is only ever emptied at once, so a batch can't be
+     *              popped and pushed back between the load and the swap.
+     * @param       cls : The size class.
+     * @param       btchs : The first batch of the chain, which is owned by the caller.
+     */
+    static void push_batches(std::size_t cls, free_block* btchs) noexcept
+    {
+        std::atomic<free_block*>& cntrl_btchs = cntrl_lsts_[cls].btchs_;
+        free_block* lst_btch = btchs;
+        free_block* cur = cntrl_btchs.load(std::memory_order_relaxed);
+
+        while (lst_btch->nxt_btch_ != nullptr)
+        {
+            lst_btch = lst_btch->nxt_btch_;
+        }
+
+        do
+        {
+            lst_btch->nxt_btch_ = cur;
+
+        } while (!cntrl_btchs.compare_exchange_weak(
+                cur, btchs, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief       Keep aside the first batches of a chain and give the rest back to the
+     *              central free list.
+     * @param       cls : The size class.
+     * @param       btchs : The first batch of the chain.
+     * @return      The first batch kept aside.
+     */
+    static free_block* keep_spare_batches(std::size_t cls, free_block* btchs) noexcept
+    {
+        free_block* lst_btch = btchs;
+
+        for (std::size_t i = 1; i < MAX_SPARE_BATCHES && lst_btch->nxt_btch_ != nullptr; ++i)
+        {
+            lst_btch = lst_btch->nxt_btch_;
+        }
+
+        if (lst_btch->nxt_btch_ != nullptr)
+        {
+            push_batches(cls, lst_btch->nxt_btch_);
+            lst_btch->nxt_btch_ = nullptr;
+        }
+
+        return btchs;
+    }
+
+    /**
+     * @brief       Request a new chunk and carve it in batches of blocks of a size class.
+     * @param       cls : The size class.
+     * @return      The first batch.
+     * @throw       std::bad_alloc : If the chunk can't be obtained.
+     */
+    static free_block* carve_chunk(std::size_t cls)
+    {
+        auto* chnk = static_cast<std::byte*>(allocate_bytes(CHUNK_SIZE, CACHE_LINE_SIZE));
+        auto* hdr = ::new (chnk) chunk_header{chnks_.load(std::memory_order_relaxed)};
+
+        while (!chnks_.compare_exchange_weak(
+                hdr->prev_, hdr, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+
+        n_chnks_.fetch_add(1, std::memory_order_relaxed);
+
+        const std::size_t blk_sz = get_block_size(cls);
+        const std::size_t n_blks = (CHUNK_SIZE - CACHE_LINE_SIZE) / blk_sz;
+        std::byte* blks = chnk + CACHE_LINE_SIZE;
+        free_block* btchs = nullptr;
+
+        // The batches are built from the end so that the first one holds the first blocks.
+        for (std::size_t i = n_blks; i-- > 0;)
+        {
+            const bool btch_end = (i + 1) % BATCH_SIZE == 0 || i + 1 == n_blks;
+            auto* nxt = btch_end ? nullptr : reinterpret_cast<free_block*>(blks + (i + 1) * blk_sz);
+            auto* blk = ::new (blks + i * blk_sz) free_block{nxt, nullptr};
+
+            if (i % BATCH_SIZE == 0)
+            {
+                blk->nxt_btch_ = btchs;
+                btchs = blk;
+            }
+        }
+
+        return btchs;
+    }
+
+    /** The central free lists. */
+    inline static central_list cntrl_lsts_[N_CLASSES];
+
+    /** The last chunk requested, which keeps all the chunks reachable. */
+    inline static std::atomic<chunk_header*> chnks_ = nullptr;
+
+    /** The number of chunks requested. */
+    inline static std::atomic<std::size_t> n_chnks_ = 0;
+
+    /** Whether the cache of each thread was destroyed. */
+    inline static thread_local bool dstryd_ = false;
+};
+
+/**
+ * @brief       Class that represents a standard allocator that gets the small values from the
+ *              thread caching heap, which suits the containers used from several threads, even
+ *              when the values are deallocated by other threads than the ones that allocated
+ *              them. The allocations that don't fit in a block use the global operator new. The
+ *              allocator is stateless, so all of its instances are interchangeable.
+ */
+template<typename ValueT>
+class thread_caching_allocator
+{
+public:
+    /** The value type. */
+    using value_type = ValueT;
+
+    /**
+     * @brief       Default constructor.
+     */
+    thread_caching_allocator() noexcept = default;
+
+    /**
+     * @brief       Copy constructor from an allocator of another type.
+     * @param       rhs : The allocator to copy.
+     */
+    template<typename ValueT_>
+    thread_caching_allocator([[maybe_unused]] const thread_caching_allocator<ValueT_>& rhs) noexcept
+    {
+    }
+
+    /**
+     * @brief       Allocate memory for a number of values.
+     * @param       n : The number of values.
+     * @return      The address of the allocated memory.
+     * @throw       std::bad_alloc : If the memory can't be obtained.
+     */
+    [[nodiscard]] value_type* allocate(std::size_t n)
+    {
+        if (n > SIZE_MAX / sizeof(value_type))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        if (thread_caching_heap::fits(n * sizeof(value_type), alignof(value_type)))
+        {
+            return static_cast<value_type*>(thread_caching_heap::allocate(n * sizeof(value_type)));
+        }
+
+        return static_cast<value_type*>(
+                allocate_bytes(n * sizeof(value_type), alignof(value_type)));
+    }
+
+    /**
+     * @brief       Deallocate memory.
+     * @param       ptr : The address of the memory.
+     * @param       n : The number of values.
+     */
+    void deallocate(value_type* ptr, std::size_t n) noexcept
+    {
+        if (thread_caching_heap::fits(n * sizeof(value_type), alignof(value_type)))
+        {
+            thread_caching_heap::deallocate(ptr, n * sizeof(value_type));
+        }
+        else
+        {
+            deallocate_bytes(ptr, n * sizeof(value_type), alignof(value_type));
+        }
+    }
+
+    /**
+     * @brief       Allows knowing whether two allocators are interchangeable, which is always
+     *              the case.
+     * @param       lhs : The first allocator.
+     * @param       rhs : The second allocator.
+     * @return      If function was successful true is returned, otherwise false is returned.
+     */
+    template<typename ValueT_>
+    friend bool operator ==(
+            [[maybe_unused]] const thread_caching_allocator& lhs,
+            [[maybe_unused]] const thread_caching_allocator<ValueT_>& rhs
+    ) noexcept
+    {
+        return true;
+    }
+};
+
+}
+
+#endif
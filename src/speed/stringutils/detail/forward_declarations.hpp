@@ -167,6 +167,9 @@ template<typename SourceStringT, typename PatternStringT>
         const PatternStringT& pattrn
 ) noexcept;
 
+template<typename StringT1, typename StringT2, typename ContainerT>
+void split(const StringT1& str, const StringT2& seps, ContainerT& vals);
+
 template<typename StringT1, typename StringT2>
 [[nodiscard]] auto split(const StringT1& str, const StringT2& seps);
 
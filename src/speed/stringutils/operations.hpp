@@ -1225,36 +1225,31 @@ constexpr TpString2& pick_by_char(TpString1& str1, TpString2& str2)
 }
 
 /**
- * @brief       Splits a string into substrings based on a set of separator characters.
+ * @brief       Splits a string into substrings based on a set of separator characters, appending
+ *              them to a caller-supplied container. Nothing is allocated besides what the
+ *              container itself allocates, so a small_vector of string views splits a short string
+ *              without touching the heap.
  * @param       str : The string to be split.
  * @param       seps : The string containing one or more separator characters.
- * @return      A vector of substrings resulting from the split operation.
+ * @param       vals : The container to which the substrings are appended. Its elements have to be
+ *              constructible from a string view of `str`.
  */
-template<typename StringT1, typename StringT2>
-[[nodiscard]] auto split(const StringT1& str, const StringT2& seps)
+template<typename StringT1, typename StringT2, typename ContainerT>
+void split(const StringT1& str, const StringT2& seps, ContainerT& vals)
 {
-    using character_type = type_traits::character_type_of_t<StringT1>;
-    using character_traits_type = type_traits::character_traits_of_t<StringT1>;
-    using allocator_type = type_traits::allocator_of_t<StringT1>;
-    using string_type = std::basic_string<character_type, character_traits_type, allocator_type>;
     using source_string_view_type = type_traits::string_view_of_t<StringT1>;
     using separators_string_view_type = type_traits::string_view_of_t<StringT2>;
-    using string_allocator_type =
-        typename std::allocator_traits<allocator_type>::template rebind_alloc<string_type>;
     
-    std::vector<string_type, string_allocator_type> vals;
     std::size_t start = 0;
     
     if (is_empty(str) || is_empty(seps))
     {
-        return vals;
+        return;
     }
     
     source_string_view_type strv = str;
     separators_string_view_type sepsv = seps;
     
-    vals.reserve(4);
-    
     for (std::size_t i = 0; i < strv.size(); ++i)
     {
         if (sepsv.find(strv[i]) != separators_string_view_type::npos)
@@ -1270,8 +1265,35 @@ template<typename StringT1, typename StringT2>
     }
     else
     {
-        vals.emplace_back(string_type());
+        vals.emplace_back();
+    }
+}
+
+/**
+ * @brief       Splits a string into substrings based on a set of separator characters.
+ * @param       str : The string to be split.
+ * @param       seps : The string containing one or more separator characters.
+ * @return      A vector of substrings resulting from the split operation.
+ */
+template<typename StringT1, typename StringT2>
+[[nodiscard]] auto split(const StringT1& str, const StringT2& seps)
+{
+    using character_type = type_traits::character_type_of_t<StringT1>;
+    using character_traits_type = type_traits::character_traits_of_t<StringT1>;
+    using allocator_type = type_traits::allocator_of_t<StringT1>;
+    using string_type = std::basic_string<character_type, character_traits_type, allocator_type>;
+    using string_allocator_type =
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<string_type>;
+    
+    std::vector<string_type, string_allocator_type> vals;
+    
+    if (is_empty(str) || is_empty(seps))
+    {
+        return vals;
     }
+    
+    vals.reserve(4);
+    split(str, seps, vals);
 
     return vals;
 }
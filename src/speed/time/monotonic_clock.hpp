@@ -0,0 +1,62 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file       monotonic_clock.hpp
+ * @brief      monotonic_clock class header.
+ * @author     Killian Valverde
+ * @date       2026/10/15
+ */
+
+#ifndef SPEED_TIME_MONOTONIC_CLOCK_HPP
+#define SPEED_TIME_MONOTONIC_CLOCK_HPP
+
+#include <cstdint>
+
+#include "../system/system.hpp"
+
+namespace speed::time {
+
+/**
+ * @brief       Class that represents a monotonic clock. Unlike the chronos it keeps no state,
+ *              it only reads the monotonic time as a single number of nanoseconds, which is
+ *              cheap to store and to compare.
+ */
+class monotonic_clock
+{
+public:
+    /** The number of nanoseconds in a second. */
+    static constexpr std::uint64_t NSECONDS_PER_SECOND = 1'000'000'000;
+
+    /**
+     * @brief       Get the number of nanoseconds elapsed since some unspecified starting point.
+     * @return      The number of nanoseconds elapsed since some unspecified starting point.
+     */
+    [[nodiscard]] static std::uint64_t get_nseconds() noexcept
+    {
+        system::time::time_specification time_spec;
+        system::time::get_monotonic_time(time_spec);
+
+        return time_spec.get_seconds() * NSECONDS_PER_SECOND + time_spec.get_nseconds();
+    }
+};
+
+}
+
+#endif
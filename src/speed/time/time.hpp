@@ -31,6 +31,7 @@
 #include "chrono_states.hpp"
 #include "cpu_chrono.hpp"
 #include "monotonic_chrono.hpp"
+#include "monotonic_clock.hpp"
 
 namespace speed {
 
@@ -27,6 +27,7 @@
 #include <gtest/gtest.h>
 
 #include "speed/argparse/argparse.hpp"
+#include "speed/memory/memory.hpp"
 
 class argparse_arg_parser : public ::testing::Test
 {
@@ -1387,3 +1388,43 @@ TEST_F(argparse_arg_parser, change_prefix)
 
     EXPECT_TRUE(ios_redirect.get_internal_string() == expected_res);
 }
+
+
+TEST(argparse_arg_parser_allocator, monotonic_arena)
+{
+    using arg_parser_type =
+            speed::argparse::basic_arg_parser<speed::memory::monotonic_allocator<char>>;
+    
+    speed::memory::monotonic_arena arna(1 << 12);
+    std::uint64_t secs = 0;
+    std::vector<std::string> vals;
+    
+    {
+        speed::memory::resource_scope<speed::memory::monotonic_arena> scp(arna);
+        arg_parser_type ap;
+        std::vector<const char*> argv = {"speed", "-s", "12", "-v", "dir1", "dir2"};
+        
+        ap.configure()
+                .print_errors(false)
+                .pkill_after_printing_errors(false);
+        ap.add_key_value_arg("-s", "--seconds")
+                .store_into(secs);
+        ap.add_key_arg("-v");
+        ap.add_positional_arg("DIRS")
+                .minmax_values(1, 4);
+        ap.add_help_arg("--help");
+        ap.parse_args(argv.size(), argv.data());
+        
+        EXPECT_TRUE(ap.was_found("-v"));
+        
+        auto dirs = ap.get_all_as<std::string>("DIRS");
+        vals.assign(dirs.begin(), dirs.end());
+    }
+    
+    EXPECT_EQ(secs, 12U);
+    EXPECT_EQ(vals, std::vector<std::string>({"dir1", "dir2"}));
+    EXPECT_GT(arna.get_block_count(), 0U);
+    
+    arna.release();
+    EXPECT_EQ(arna.get_block_count(), 0U);
+}
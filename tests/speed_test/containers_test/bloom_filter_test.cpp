@@ -0,0 +1,99 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        bloom_filter_test.cpp
+ * @brief       bloom_filter unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_bloom_filter, no_false_negatives)
+{
+    speed::containers::bloom_filter<std::uint64_t> fltr(10000, 0.01);
+    
+    for (std::uint64_t i = 0; i < 10000; ++i)
+    {
+        fltr.insert(i * 7);
+    }
+    
+    for (std::uint64_t i = 0; i < 10000; ++i)
+    {
+        EXPECT_TRUE(fltr.contains(i * 7));
+    }
+    
+    fltr.clear();
+    EXPECT_FALSE(fltr.contains(7));
+}
+
+TEST(containers_bloom_filter, false_positive_rate)
+{
+    for (double fpr : {0.05, 0.01, 0.001})
+    {
+        speed::containers::bloom_filter<std::uint64_t> fltr(100000, fpr);
+        std::uint64_t n_fps = 0;
+        
+        EXPECT_LE(fltr.estimate_false_positive_rate(100000), fpr);
+        EXPECT_GT(fltr.estimate_false_positive_rate(100000), fpr / 2);
+        
+        for (std::uint64_t i = 0; i < 100000; ++i)
+        {
+            fltr.insert(i);
+        }
+        
+        for (std::uint64_t i = 100000; i < 1100000; ++i)
+        {
+            n_fps += fltr.contains(i) ? 1 : 0;
+        }
+        
+        EXPECT_LT(static_cast<double>(n_fps) / 1000000, fpr * 1.5);
+    }
+}
+
+TEST(containers_bloom_filter, sizing)
+{
+    using bloom_filter_type = speed::containers::bloom_filter<std::uint64_t>;
+    
+    EXPECT_EQ(bloom_filter_type::get_block_count(0, 0.01), 1U);
+    EXPECT_LT(bloom_filter_type::get_block_count(1000, 0.01),
+              bloom_filter_type::get_block_count(1000, 0.001));
+    EXPECT_LT(bloom_filter_type::get_block_count(1000, 0.01),
+              bloom_filter_type::get_block_count(2000, 0.01));
+    EXPECT_THROW(bloom_filter_type(1000, 0.0), speed::containers::out_of_range_exception);
+    EXPECT_THROW(bloom_filter_type(0), speed::containers::out_of_range_exception);
+}
+
+TEST(containers_bloom_filter, strings)
+{
+    speed::containers::bloom_filter<std::string> fltr(100, 0.01);
+    
+    fltr.insert(std::string("alpha"));
+    fltr.insert(std::string_view("beta"));
+    
+    EXPECT_TRUE(fltr.contains("alpha"));
+    EXPECT_TRUE(fltr.contains(std::string("beta")));
+}
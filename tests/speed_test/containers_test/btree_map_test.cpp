@@ -0,0 +1,197 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        btree_map_test.cpp
+ * @brief       btree_map unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+template<typename MapT, typename ReferenceT>
+void expect_same_elements(MapT& mp, const ReferenceT& ref)
+{
+    ASSERT_EQ(mp.size(), ref.size());
+    
+    auto it = mp.begin();
+    
+    for (const auto& [ky, val] : ref)
+    {
+        ASSERT_FALSE(it.end());
+        EXPECT_EQ(it->first, ky);
+        EXPECT_EQ(it->second, val);
+        ++it;
+    }
+    
+    EXPECT_EQ(it, mp.end());
+    
+    for (auto ref_it = ref.rbegin(); ref_it != ref.rend(); ++ref_it)
+    {
+        --it;
+        EXPECT_EQ(it->first, ref_it->first);
+    }
+}
+
+}
+
+TEST(containers_btree_map, insert_and_find)
+{
+    speed::containers::btree_map<int, std::string> mp;
+    
+    EXPECT_TRUE(mp.empty());
+    EXPECT_EQ(mp.begin(), mp.end());
+    EXPECT_TRUE(mp.insert({3, "c"}).second);
+    EXPECT_TRUE(mp.try_emplace(1, "a").second);
+    EXPECT_TRUE(mp.emplace(2, "b").second);
+    EXPECT_FALSE(mp.insert({2, "x"}).second);
+    EXPECT_EQ(mp.size(), 3U);
+    EXPECT_EQ(mp.at(2), "b");
+    EXPECT_THROW(mp.at(4), speed::containers::out_of_range_exception);
+    EXPECT_TRUE(mp.contains(1));
+    EXPECT_EQ(mp.count(4), 0U);
+    EXPECT_EQ(mp.find(4), mp.end());
+    
+    mp[4] = "d";
+    mp.insert_or_assign(1, "z");
+    EXPECT_EQ(mp.at(1), "z");
+    EXPECT_EQ(mp.at(4), "d");
+    EXPECT_EQ(mp.erase(2), 1U);
+    EXPECT_EQ(mp.erase(2), 0U);
+    EXPECT_EQ(mp.erase(mp.begin())->first, 3);
+    EXPECT_EQ(mp.size(), 2U);
+    
+    mp.clear();
+    EXPECT_TRUE(mp.empty());
+    EXPECT_TRUE(mp.insert({7, "g"}).second);
+}
+
+TEST(containers_btree_map, grow_and_shrink)
+{
+    speed::containers::btree_map<int, int, std::less<int>, std::allocator<int>, 64> mp;
+    std::map<int, int> ref;
+    
+    for (int i = 0; i < 2000; ++i)
+    {
+        mp[i * 2] = i;
+        ref[i * 2] = i;
+    }
+    
+    EXPECT_GT(mp.get_height(), 2U);
+    expect_same_elements(mp, ref);
+    
+    EXPECT_EQ(mp.lower_bound(101)->first, 102);
+    EXPECT_EQ(mp.upper_bound(102)->first, 104);
+    EXPECT_EQ(mp.lower_bound(3998)->first, 3998);
+    EXPECT_EQ(mp.upper_bound(3998), mp.end());
+    
+    for (auto it = mp.begin(); !it.end();)
+    {
+        if (it->first % 3 == 0)
+        {
+            it = mp.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    
+    std::erase_if(ref, [](const auto& val) { return val.first % 3 == 0; });
+    expect_same_elements(mp, ref);
+    
+    for (int i = 0; i < 4000; ++i)
+    {
+        mp.erase(i);
+    }
+    
+    EXPECT_TRUE(mp.empty());
+    EXPECT_EQ(mp.get_height(), 0U);
+    EXPECT_EQ(mp.begin(), mp.end());
+}
+
+TEST(containers_btree_map, random_operations)
+{
+    speed::containers::btree_map<std::uint64_t, std::uint64_t> mp;
+    std::map<std::uint64_t, std::uint64_t> ref;
+    std::uint64_t x = 0x9E3779B97F4A7C15ull;
+    
+    for (int i = 0; i < 100000; ++i)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        
+        const std::uint64_t ky = x % 5000;
+        
+        if ((x >> 32) % 3 == 0)
+        {
+            EXPECT_EQ(mp.erase(ky), ref.erase(ky));
+        }
+        else
+        {
+            EXPECT_EQ(mp.try_emplace(ky, x).second, ref.try_emplace(ky, x).second);
+        }
+        
+        if (i % 997 == 0)
+        {
+            auto it = mp.lower_bound(ky);
+            auto ref_it = ref.lower_bound(ky);
+            
+            for (int j = 0; j < 16 && ref_it != ref.end(); ++j, ++it, ++ref_it)
+            {
+                ASSERT_FALSE(it.end());
+                EXPECT_EQ(it->first, ref_it->first);
+            }
+        }
+    }
+    
+    expect_same_elements(mp, ref);
+}
+
+TEST(containers_btree_map, move)
+{
+    speed::containers::btree_map<std::string, int> mp;
+    
+    for (int i = 0; i < 100; ++i)
+    {
+        mp[std::to_string(i)] = i;
+    }
+    
+    auto mp2 = std::move(mp);
+    
+    EXPECT_TRUE(mp.empty());
+    EXPECT_EQ(mp2.size(), 100U);
+    EXPECT_EQ(mp2.at("42"), 42);
+    
+    mp = std::move(mp2);
+    EXPECT_EQ(mp.size(), 100U);
+    EXPECT_EQ(mp.begin()->first, "0");
+}
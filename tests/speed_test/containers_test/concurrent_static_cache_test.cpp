@@ -0,0 +1,327 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        concurrent_static_cache_test.cpp
+ * @brief       concurrent_static_cache unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/15
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_concurrent_static_cache, insert)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::string, 64, 4> buf_cache;
+    std::string val;
+
+    buf_cache.insert(1, "good");
+    buf_cache.insert(2, "bye");
+
+    EXPECT_THROW(buf_cache.insert(1, "..."), speed::containers::insertion_exception);
+    EXPECT_TRUE(buf_cache.find(1, val) && val == "good");
+    EXPECT_TRUE(buf_cache.find(2, val) && val == "bye");
+    EXPECT_FALSE(buf_cache.find(3, val));
+}
+
+TEST(containers_concurrent_static_cache, visit)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::string, 64, 4> buf_cache;
+
+    buf_cache.insert(1, "good");
+
+    EXPECT_TRUE(buf_cache.visit(1, [](std::string& val) { val += " bye"; }));
+    EXPECT_TRUE(buf_cache.visit(1, [](const std::string& val) { EXPECT_EQ(val, "good bye"); }));
+    EXPECT_FALSE(buf_cache.visit(2, [](std::string&) { FAIL(); }));
+}
+
+TEST(containers_concurrent_static_cache, find_and_lock)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::uint32_t, 4, 1> buf_cache;
+    std::uint32_t val;
+
+    buf_cache.insert(1, 10);
+    buf_cache.insert(2, 20);
+    buf_cache.insert(3, 30);
+    buf_cache.insert(4, 40);
+
+    EXPECT_TRUE(buf_cache.find_and_lock(1, val) && val == 10);
+    EXPECT_FALSE(buf_cache.find_and_lock(5, val));
+
+    buf_cache.insert(5, 50);
+
+    EXPECT_TRUE(buf_cache.contains(1));
+    EXPECT_FALSE(buf_cache.contains(2));
+
+    buf_cache.unlock(1);
+    buf_cache.insert(6, 60);
+    buf_cache.insert(7, 70);
+    buf_cache.insert(8, 80);
+    buf_cache.insert(9, 90);
+
+    EXPECT_FALSE(buf_cache.contains(1));
+}
+
+TEST(containers_concurrent_static_cache, lock_absent_key)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::uint32_t, 16, 4> buf_cache;
+
+    buf_cache.lock(1);
+    buf_cache.unlock(1);
+
+    EXPECT_FALSE(buf_cache.contains(1));
+}
+
+TEST(containers_concurrent_static_cache, shard_distribution)
+{
+    using cache_type = speed::containers::concurrent_static_cache<std::uint32_t, int, 1024, 8>;
+    std::size_t shrd_cnt[8] = {};
+
+    for (std::uint32_t i = 0; i < 1024; ++i)
+    {
+        ++shrd_cnt[cache_type::get_shard_index(i)];
+    }
+
+    for (auto cnt : shrd_cnt)
+    {
+        EXPECT_GT(cnt, 64u);
+    }
+}
+
+TEST(containers_concurrent_static_cache, concurrent_access)
+{
+    constexpr std::uint32_t n_threads = 4;
+    constexpr std::uint32_t n_keys_per_thread = 256;
+    speed::containers::concurrent_static_cache<std::uint32_t, std::uint32_t, 4096, 8> buf_cache;
+    std::vector<std::thread> thrds;
+
+    for (std::uint32_t i = 0; i < n_threads; ++i)
+    {
+        thrds.emplace_back([&buf_cache, i]
+        {
+            for (std::uint32_t j = 0; j < n_keys_per_thread; ++j)
+            {
+                std::uint32_t ky = i * n_keys_per_thread + j;
+
+                buf_cache.insert(ky, ky * 2);
+            }
+        });
+    }
+
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+
+    for (std::uint32_t ky = 0; ky < n_threads * n_keys_per_thread; ++ky)
+    {
+        std::uint32_t val;
+
+        EXPECT_TRUE(buf_cache.find(ky, val) && val == ky * 2);
+    }
+}
+
+TEST(containers_concurrent_static_cache, clock_concurrent_access)
+{
+    constexpr std::uint32_t n_threads = 4;
+    constexpr std::uint32_t n_keys = 512;
+    speed::containers::concurrent_static_cache<
+            std::uint32_t,
+            std::uint32_t,
+            1024,
+            8,
+            std::hash<std::uint32_t>,
+            std::equal_to<std::uint32_t>,
+            speed::containers::clock_eviction_policy
+    > buf_cache;
+    std::vector<std::thread> thrds;
+
+    static_assert(decltype(buf_cache)::SHARED_LOOKUPS);
+
+    for (std::uint32_t ky = 0; ky < n_keys; ++ky)
+    {
+        buf_cache.insert(ky, ky * 2);
+    }
+
+    for (std::uint32_t i = 0; i < n_threads; ++i)
+    {
+        thrds.emplace_back([&buf_cache, i]
+        {
+            for (std::uint32_t j = 0; j < 64 * n_keys; ++j)
+            {
+                std::uint32_t ky = (j * 7 + i) % n_keys;
+                std::uint32_t val;
+
+                if (i == 0 && j % 16 == 0)
+                {
+                    buf_cache.visit(ky, [](std::uint32_t& cur_val) { cur_val += 0; });
+                }
+                else
+                {
+                    EXPECT_TRUE(buf_cache.find(ky, val) && val == ky * 2);
+                }
+            }
+        });
+    }
+
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+
+    EXPECT_TRUE(buf_cache.contains(0));
+}
+
+TEST(containers_concurrent_static_cache, get_or_compute)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::uint32_t, 64, 4> buf_cache;
+    std::atomic<std::uint32_t> n_calls = 0;
+    std::atomic<std::uint32_t> n_ready = 0;
+    std::vector<std::thread> thrds;
+    std::uint32_t vals[8] = {};
+    
+    auto ldr = [&](std::uint32_t ky)
+    {
+        ++n_calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        
+        return ky * 10;
+    };
+    
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        thrds.emplace_back([&, i]
+        {
+            ++n_ready;
+            
+            while (n_ready.load() < 8)
+            {
+            }
+            
+            vals[i] = buf_cache.get_or_compute(7, ldr);
+        });
+    }
+    
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+    
+    EXPECT_EQ(n_calls.load(), 1u);
+    
+    for (auto val : vals)
+    {
+        EXPECT_EQ(val, 70u);
+    }
+    
+    EXPECT_EQ(buf_cache.get_or_compute(7, ldr), 70u);
+    EXPECT_EQ(buf_cache.get_or_compute(8, ldr), 80u);
+    EXPECT_EQ(n_calls.load(), 2u);
+}
+
+TEST(containers_concurrent_static_cache, get_or_compute_exception)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::uint32_t, 64, 4> buf_cache;
+    std::atomic<std::uint32_t> n_ready = 0;
+    std::atomic<std::uint32_t> n_throws = 0;
+    std::vector<std::thread> thrds;
+    
+    auto failing_ldr = [](std::uint32_t) -> std::uint32_t
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        throw std::runtime_error("load failed");
+    };
+    
+    for (std::uint32_t i = 0; i < 4; ++i)
+    {
+        thrds.emplace_back([&]
+        {
+            ++n_ready;
+            
+            while (n_ready.load() < 4)
+            {
+            }
+            
+            try
+            {
+                buf_cache.get_or_compute(3, failing_ldr);
+            }
+            catch (const std::runtime_error&)
+            {
+                ++n_throws;
+            }
+        });
+    }
+    
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+    
+    EXPECT_EQ(n_throws.load(), 4u);
+    EXPECT_FALSE(buf_cache.contains(3));
+    EXPECT_EQ(buf_cache.get_or_compute(3, [](std::uint32_t ky) { return ky + 1; }), 4u);
+}
+
+TEST(containers_concurrent_static_cache, get_or_compute_and_lock)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::uint32_t, 4, 1> buf_cache;
+    auto ldr = [](std::uint32_t ky) { return ky * 10; };
+    
+    EXPECT_EQ(buf_cache.get_or_compute_and_lock(1, ldr), 10u);
+    
+    for (std::uint32_t i = 2; i < 10; ++i)
+    {
+        EXPECT_EQ(buf_cache.get_or_compute(i, ldr), i * 10);
+    }
+    
+    EXPECT_TRUE(buf_cache.contains(1));
+    EXPECT_FALSE(buf_cache.contains(2));
+}
+
+TEST(containers_concurrent_static_cache, get_or_compute_racing_insert)
+{
+    speed::containers::concurrent_static_cache<std::uint32_t, std::uint32_t, 4, 1> buf_cache;
+    
+    auto ldr = [&](std::uint32_t ky)
+    {
+        buf_cache.insert(ky, ky * 100);
+        
+        return ky * 10;
+    };
+    
+    EXPECT_EQ(buf_cache.get_or_compute(1, ldr), 100u);
+    EXPECT_EQ(buf_cache.get_or_compute_and_lock(2, ldr), 200u);
+    
+    for (std::uint32_t i = 3; i < 10; ++i)
+    {
+        EXPECT_EQ(buf_cache.get_or_compute(i, ldr), i * 100);
+    }
+    
+    EXPECT_TRUE(buf_cache.contains(2));
+}
@@ -0,0 +1,128 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        cuckoo_filter_test.cpp
+ * @brief       cuckoo_filter unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_cuckoo_filter, insert_and_erase)
+{
+    speed::containers::cuckoo_filter<std::uint64_t> fltr(10000);
+    
+    EXPECT_TRUE(fltr.empty());
+    
+    for (std::uint64_t i = 0; i < 10000; ++i)
+    {
+        EXPECT_TRUE(fltr.insert(i));
+    }
+    
+    EXPECT_EQ(fltr.size(), 10000U);
+    
+    for (std::uint64_t i = 0; i < 10000; ++i)
+    {
+        EXPECT_TRUE(fltr.contains(i));
+    }
+    
+    for (std::uint64_t i = 0; i < 10000; i += 2)
+    {
+        EXPECT_TRUE(fltr.erase(i));
+    }
+    
+    EXPECT_EQ(fltr.size(), 5000U);
+    
+    for (std::uint64_t i = 1; i < 10000; i += 2)
+    {
+        EXPECT_TRUE(fltr.contains(i));
+    }
+    
+    fltr.clear();
+    EXPECT_TRUE(fltr.empty());
+    EXPECT_FALSE(fltr.contains(1));
+}
+
+TEST(containers_cuckoo_filter, full)
+{
+    speed::containers::cuckoo_filter<std::uint64_t> fltr(64);
+    const std::size_t n_slts = fltr.get_bucket_count() * 4;
+    std::uint64_t n_ins = 0;
+    
+    while (n_ins < n_slts * 2 && fltr.insert(n_ins))
+    {
+        ++n_ins;
+    }
+    
+    EXPECT_GE(n_ins, n_slts * 9 / 10);
+    EXPECT_LE(n_ins, n_slts);
+    
+    for (std::uint64_t i = 0; i < n_ins; ++i)
+    {
+        EXPECT_TRUE(fltr.contains(i));
+    }
+    
+    EXPECT_TRUE(fltr.erase(0));
+    EXPECT_TRUE(fltr.insert(n_ins + 1));
+}
+
+TEST(containers_cuckoo_filter, false_positive_rate)
+{
+    speed::containers::cuckoo_filter<std::uint64_t, speed::containers::filter_hash<std::uint64_t>,
+                                     std::uint8_t> fltr(100000);
+    std::uint64_t n_fps = 0;
+    
+    for (std::uint64_t i = 0; i < 100000; ++i)
+    {
+        fltr.insert(i);
+    }
+    
+    for (std::uint64_t i = 100000; i < 1100000; ++i)
+    {
+        n_fps += fltr.contains(i) ? 1 : 0;
+    }
+    
+    EXPECT_LT(static_cast<double>(n_fps) / 1000000, fltr.estimate_false_positive_rate() * 1.5);
+    EXPECT_GT(static_cast<double>(n_fps) / 1000000, fltr.estimate_false_positive_rate() / 1.5);
+}
+
+TEST(containers_cuckoo_filter, sizing)
+{
+    using cuckoo_filter_type = speed::containers::cuckoo_filter<std::string>;
+    
+    EXPECT_EQ(cuckoo_filter_type::get_bucket_count(0), 1U);
+    EXPECT_EQ(cuckoo_filter_type::get_bucket_count(1000), 512U);
+    EXPECT_EQ(cuckoo_filter_type::get_fingerprint_bits(0.01), 10U);
+    EXPECT_NO_THROW(cuckoo_filter_type(1000, 0.0002));
+    EXPECT_THROW(cuckoo_filter_type(1000, 0.00001), speed::containers::out_of_range_exception);
+    
+    cuckoo_filter_type fltr(100, 0.01);
+    
+    EXPECT_TRUE(fltr.insert("alpha"));
+    EXPECT_TRUE(fltr.contains(std::string("alpha")));
+    EXPECT_TRUE(fltr.erase("alpha"));
+    EXPECT_FALSE(fltr.contains("alpha"));
+}
@@ -0,0 +1,377 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        dynamic_cache_test.cpp
+ * @brief       dynamic_cache unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/15
+ */
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+struct allocation_counters
+{
+    static inline std::size_t n_allocs = 0;
+    
+    static inline std::size_t n_deallocs = 0;
+};
+
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+    
+    counting_allocator() noexcept = default;
+    
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept
+    {
+    }
+    
+    T* allocate(std::size_t n)
+    {
+        ++allocation_counters::n_allocs;
+        
+        return std::allocator<T>().allocate(n);
+    }
+    
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        ++allocation_counters::n_deallocs;
+        std::allocator<T>().deallocate(ptr, n);
+    }
+    
+    template<typename U>
+    bool operator ==(const counting_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+};
+
+struct live_value
+{
+    static inline std::size_t n_lives = 0;
+    
+    explicit live_value(std::uint32_t val)
+            : val_(val)
+    {
+        ++n_lives;
+    }
+    
+    live_value(live_value&& rhs) noexcept
+            : val_(rhs.val_)
+    {
+        ++n_lives;
+    }
+    
+    ~live_value()
+    {
+        --n_lives;
+    }
+    
+    std::uint32_t val_;
+};
+
+struct throwing_value
+{
+    static inline bool thrw_on_move = false;
+    
+    static inline std::size_t n_lives = 0;
+    
+    explicit throwing_value(std::uint32_t val)
+            : val_(val)
+    {
+        ++n_lives;
+    }
+    
+    throwing_value(throwing_value&& rhs)
+            : val_(rhs.val_)
+    {
+        if (thrw_on_move)
+        {
+            throw std::runtime_error("move failed");
+        }
+        
+        ++n_lives;
+    }
+    
+    ~throwing_value()
+    {
+        --n_lives;
+    }
+    
+    std::uint32_t val_;
+};
+
+template<typename CacheT>
+std::size_t count_elements(CacheT& buf_cache)
+{
+    std::size_t n_elems = 0;
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        ++n_elems;
+    }
+    
+    return n_elems;
+}
+
+}
+
+TEST(containers_dynamic_cache, insert)
+{
+    speed::containers::dynamic_cache<std::uint32_t, std::string> buf_cache(4);
+    
+    EXPECT_EQ(buf_cache.get_size(), 4u);
+    EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+    
+    buf_cache.insert(1, "good");
+    buf_cache.insert(2, "bye");
+    buf_cache.insert(3, "hi");
+    buf_cache.insert(4, "hello");
+    
+    EXPECT_THROW(buf_cache.insert(1, "..."), speed::containers::insertion_exception);
+    EXPECT_FALSE(buf_cache.is_least_recently_used_free());
+    EXPECT_TRUE(*buf_cache.find(1) == "good");
+    
+    buf_cache.insert(5, "world");
+    
+    EXPECT_TRUE(buf_cache.find(2) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(5) == "world");
+}
+
+TEST(containers_dynamic_cache, lock)
+{
+    speed::containers::dynamic_cache<std::uint32_t, std::uint32_t> buf_cache(2);
+    
+    buf_cache.insert_and_lock(1, 10);
+    buf_cache.insert_and_lock(2, 20);
+    
+    EXPECT_THROW(buf_cache.insert(3, 30), speed::containers::exhausted_resources_exception);
+    
+    buf_cache.unlock(1);
+    buf_cache.insert(3, 30);
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(2) == 20);
+}
+
+TEST(containers_dynamic_cache, no_allocation_per_insert)
+{
+    allocation_counters::n_allocs = 0;
+    allocation_counters::n_deallocs = 0;
+    
+    {
+        speed::containers::dynamic_cache<
+                std::uint32_t,
+                std::uint32_t,
+                std::hash<std::uint32_t>,
+                std::equal_to<std::uint32_t>,
+                speed::containers::lru_eviction_policy,
+                counting_allocator<std::byte>
+        > buf_cache(64);
+        
+        for (std::uint32_t i = 0; i < 1000; ++i)
+        {
+            buf_cache.insert(i, i);
+        }
+        
+        EXPECT_EQ(allocation_counters::n_allocs, 1u);
+        
+        buf_cache.resize(128);
+        
+        EXPECT_EQ(allocation_counters::n_allocs, 2u);
+        EXPECT_EQ(allocation_counters::n_deallocs, 1u);
+    }
+    
+    EXPECT_EQ(allocation_counters::n_deallocs, 2u);
+}
+
+TEST(containers_dynamic_cache, grow)
+{
+    speed::containers::dynamic_cache<std::uint32_t, std::uint32_t> buf_cache(8);
+    
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    buf_cache.lock(3);
+    buf_cache.resize(1000);
+    
+    EXPECT_EQ(buf_cache.get_size(), 1000u);
+    EXPECT_EQ(count_elements(buf_cache), 8u);
+    
+    for (std::uint32_t i = 8; i < 1000; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(*buf_cache.find(i) == i * 10);
+    }
+    
+    buf_cache.insert(1000, 10000);
+    
+    EXPECT_TRUE(buf_cache.find(0) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(3) == 30);
+}
+
+TEST(containers_dynamic_cache, shrink)
+{
+    speed::containers::dynamic_cache<std::uint32_t, std::uint32_t> buf_cache(8);
+    
+    for (std::uint32_t i = 0; i < 8; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    buf_cache.lock(0);
+    buf_cache.find(1);
+    buf_cache.resize(3);
+    
+    EXPECT_EQ(count_elements(buf_cache), 3u);
+    EXPECT_TRUE(*buf_cache.find(0) == 0);
+    EXPECT_TRUE(*buf_cache.find(7) == 70);
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+    
+    buf_cache.insert(8, 80);
+    
+    EXPECT_TRUE(buf_cache.find(7) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(0) == 0);
+    
+    buf_cache.lock(1);
+    
+    EXPECT_THROW(buf_cache.resize(1), speed::containers::exhausted_resources_exception);
+    EXPECT_EQ(buf_cache.get_size(), 3u);
+    EXPECT_EQ(count_elements(buf_cache), 3u);
+    
+    buf_cache.resize(2);
+    
+    EXPECT_THROW(buf_cache.insert(9, 90), speed::containers::exhausted_resources_exception);
+    
+    buf_cache.unlock(0);
+    buf_cache.insert(9, 90);
+    
+    EXPECT_TRUE(buf_cache.find(0) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+}
+
+TEST(containers_dynamic_cache, eviction_policy)
+{
+    speed::containers::dynamic_cache<
+            std::uint32_t,
+            std::uint32_t,
+            std::hash<std::uint32_t>,
+            std::equal_to<std::uint32_t>,
+            speed::containers::s3_fifo_eviction_policy
+    > buf_cache(100);
+    
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        if (buf_cache.find(i % 150).end())
+        {
+            buf_cache.insert(i % 150, i % 150);
+        }
+    }
+    
+    buf_cache.resize(50);
+    
+    EXPECT_EQ(count_elements(buf_cache), 50u);
+    
+    buf_cache.resize(200);
+    
+    for (std::uint32_t i = 0; i < 150; ++i)
+    {
+        if (buf_cache.find(i).end())
+        {
+            buf_cache.insert(i, i);
+        }
+    }
+    
+    EXPECT_EQ(count_elements(buf_cache), 150u);
+}
+
+TEST(containers_dynamic_cache, value_lifetime)
+{
+    {
+        speed::containers::dynamic_cache<std::uint32_t, live_value> buf_cache(8);
+        
+        for (std::uint32_t i = 0; i < 20; ++i)
+        {
+            buf_cache.try_emplace(i, i);
+        }
+        
+        EXPECT_EQ(live_value::n_lives, 8u);
+        
+        buf_cache.resize(3);
+        
+        EXPECT_EQ(live_value::n_lives, 3u);
+        EXPECT_EQ(buf_cache.find(19)->val_, 19u);
+        
+        buf_cache.resize(16);
+        
+        EXPECT_EQ(live_value::n_lives, 3u);
+    }
+    
+    EXPECT_EQ(live_value::n_lives, 0u);
+}
+
+TEST(containers_dynamic_cache, resize_throwing_move)
+{
+    {
+        speed::containers::dynamic_cache<std::uint32_t, throwing_value> buf_cache(8);
+        
+        for (std::uint32_t i = 0; i < 8; ++i)
+        {
+            buf_cache.try_emplace(i, i);
+        }
+        
+        throwing_value::thrw_on_move = true;
+        
+        EXPECT_THROW(buf_cache.resize(16), std::runtime_error);
+        
+        throwing_value::thrw_on_move = false;
+        
+        EXPECT_EQ(buf_cache.get_size(), 16u);
+        EXPECT_EQ(count_elements(buf_cache), 0u);
+        EXPECT_EQ(throwing_value::n_lives, 0u);
+        
+        for (std::uint32_t i = 0; i < 20; ++i)
+        {
+            buf_cache.try_emplace(i, i);
+        }
+        
+        EXPECT_EQ(count_elements(buf_cache), 16u);
+        EXPECT_EQ(buf_cache.find(19)->val_, 19u);
+    }
+    
+    EXPECT_EQ(throwing_value::n_lives, 0u);
+}
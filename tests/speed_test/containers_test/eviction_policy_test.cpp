@@ -0,0 +1,264 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        eviction_policy_test.cpp
+ * @brief       eviction policies unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/15
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+template<std::size_t SIZE, template<typename> class EvictionPolicyT>
+using cache_type = speed::containers::static_cache<
+        std::uint32_t,
+        std::uint32_t,
+        SIZE,
+        std::hash<std::uint32_t>,
+        std::equal_to<std::uint32_t>,
+        EvictionPolicyT
+>;
+
+template<typename CacheT>
+std::size_t count_elements(CacheT& buf_cache)
+{
+    std::size_t n_elems = 0;
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        ++n_elems;
+    }
+    
+    return n_elems;
+}
+
+template<template<typename> class EvictionPolicyT>
+void expect_lock_unlock_works()
+{
+    cache_type<8, EvictionPolicyT> buf_cache;
+    
+    EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+    
+    for (std::uint32_t i = 1; i <= 8; ++i)
+    {
+        buf_cache.insert_and_lock(i, i * 10);
+    }
+    
+    EXPECT_THROW(buf_cache.insert(9, 90), speed::containers::exhausted_resources_exception);
+    
+    buf_cache.unlock(5);
+    buf_cache.unlock(5);
+    buf_cache.insert(9, 90);
+    
+    EXPECT_TRUE(buf_cache.find(5) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(9) == 90);
+    
+    for (std::uint32_t i = 1; i <= 4; ++i)
+    {
+        buf_cache.unlock(i);
+    }
+    
+    buf_cache.lock(9);
+    buf_cache.lock(9);
+    
+    for (std::uint32_t i = 10; i < 200; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+        buf_cache.find(i - i % 3);
+    }
+    
+    for (std::uint32_t i = 6; i <= 9; ++i)
+    {
+        EXPECT_TRUE(*buf_cache.find(i) == i * 10);
+    }
+    
+    EXPECT_EQ(count_elements(buf_cache), 8u);
+}
+
+template<template<typename> class EvictionPolicyT>
+void expect_consistent_under_random_operations()
+{
+    cache_type<64, EvictionPolicyT> buf_cache;
+    std::map<std::uint32_t, std::uint32_t> inserted;
+    std::set<std::uint32_t> locked;
+    std::uint64_t rnd = 0x9E3779B97F4A7C15ull;
+    
+    for (std::uint32_t i = 0; i < 20000; ++i)
+    {
+        rnd ^= rnd << 13;
+        rnd ^= rnd >> 7;
+        rnd ^= rnd << 17;
+        
+        const auto ky = static_cast<std::uint32_t>(rnd % 256);
+        const auto op = static_cast<std::uint32_t>((rnd >> 32) % 16);
+        auto it = buf_cache.find(ky);
+        
+        if (it != buf_cache.end())
+        {
+            ASSERT_EQ(*it, inserted[ky]);
+            
+            if (op == 0 && locked.size() < 16)
+            {
+                buf_cache.lock(ky);
+                locked.insert(ky);
+            }
+            else if (op == 1)
+            {
+                buf_cache.unlock(ky);
+                locked.erase(ky);
+            }
+        }
+        else
+        {
+            ASSERT_EQ(locked.count(ky), 0u);
+            
+            buf_cache.insert(ky, i);
+            inserted[ky] = i;
+        }
+        
+        for (auto lckd_ky : locked)
+        {
+            ASSERT_FALSE(buf_cache.find(lckd_ky) == buf_cache.end());
+        }
+    }
+    
+    EXPECT_EQ(count_elements(buf_cache), 64u);
+}
+
+template<template<typename> class EvictionPolicyT>
+std::size_t count_hot_keys_surviving_scan()
+{
+    cache_type<100, EvictionPolicyT> buf_cache;
+    std::size_t n_hot_kys = 0;
+    
+    for (std::uint32_t rnd = 0; rnd < 4; ++rnd)
+    {
+        for (std::uint32_t ky = 0; ky < 50; ++ky)
+        {
+            if (buf_cache.find(ky) == buf_cache.end())
+            {
+                buf_cache.insert(ky, ky);
+            }
+        }
+    }
+    
+    for (std::uint32_t ky = 1000; ky < 2000; ++ky)
+    {
+        if (buf_cache.find(ky) == buf_cache.end())
+        {
+            buf_cache.insert(ky, ky);
+        }
+    }
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        n_hot_kys += *it < 50;
+    }
+    
+    return n_hot_kys;
+}
+
+
+template<template<typename> class EvictionPolicyT>
+void expect_snapshot_keeps_policy_state()
+{
+    const std::filesystem::path snpsht_pth =
+            std::filesystem::temp_directory_path() / "speed_eviction_policy_snapshot.bin";
+    cache_type<32, EvictionPolicyT> saved_cache;
+    cache_type<32, EvictionPolicyT> buf_cache;
+    std::uint64_t rnd = 0x9E3779B97F4A7C15ull;
+    
+    for (std::uint32_t i = 0; i < 4000; ++i)
+    {
+        rnd ^= rnd << 13;
+        rnd ^= rnd >> 7;
+        rnd ^= rnd << 17;
+        
+        const auto ky = static_cast<std::uint32_t>(rnd % 64);
+        
+        if (i == 2000)
+        {
+            ASSERT_TRUE(saved_cache.save_snapshot(snpsht_pth));
+        }
+        
+        if (saved_cache.find(ky) == saved_cache.end())
+        {
+            saved_cache.insert(ky, i);
+        }
+        
+        if (buf_cache.find(ky) == buf_cache.end())
+        {
+            buf_cache.insert(ky, i);
+        }
+        
+        for (std::uint32_t j = 0; j < 64; ++j)
+        {
+            ASSERT_EQ(saved_cache.find(j) == saved_cache.end(),
+                      buf_cache.find(j) == buf_cache.end());
+        }
+    }
+    
+    std::filesystem::remove(snpsht_pth);
+}
+}
+
+TEST(containers_eviction_policy, lock_unlock)
+{
+    expect_lock_unlock_works<speed::containers::lru_eviction_policy>();
+    expect_lock_unlock_works<speed::containers::clock_eviction_policy>();
+    expect_lock_unlock_works<speed::containers::w_tinylfu_eviction_policy>();
+    expect_lock_unlock_works<speed::containers::arc_eviction_policy>();
+    expect_lock_unlock_works<speed::containers::s3_fifo_eviction_policy>();
+}
+
+TEST(containers_eviction_policy, random_operations)
+{
+    expect_consistent_under_random_operations<speed::containers::lru_eviction_policy>();
+    expect_consistent_under_random_operations<speed::containers::clock_eviction_policy>();
+    expect_consistent_under_random_operations<speed::containers::w_tinylfu_eviction_policy>();
+    expect_consistent_under_random_operations<speed::containers::arc_eviction_policy>();
+    expect_consistent_under_random_operations<speed::containers::s3_fifo_eviction_policy>();
+}
+
+TEST(containers_eviction_policy, scan_resistance)
+{
+    EXPECT_EQ(count_hot_keys_surviving_scan<speed::containers::lru_eviction_policy>(), 0u);
+    EXPECT_GE(count_hot_keys_surviving_scan<speed::containers::w_tinylfu_eviction_policy>(), 45u);
+    EXPECT_GE(count_hot_keys_surviving_scan<speed::containers::arc_eviction_policy>(), 45u);
+    EXPECT_GE(count_hot_keys_surviving_scan<speed::containers::s3_fifo_eviction_policy>(), 45u);
+}
+
+TEST(containers_eviction_policy, snapshot_keeps_policy_state)
+{
+    expect_snapshot_keeps_policy_state<speed::containers::lru_eviction_policy>();
+    expect_snapshot_keeps_policy_state<speed::containers::clock_eviction_policy>();
+    expect_snapshot_keeps_policy_state<speed::containers::w_tinylfu_eviction_policy>();
+    expect_snapshot_keeps_policy_state<speed::containers::arc_eviction_policy>();
+    expect_snapshot_keeps_policy_state<speed::containers::s3_fifo_eviction_policy>();
+}
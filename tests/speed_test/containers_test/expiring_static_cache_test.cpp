@@ -0,0 +1,282 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        expiring_static_cache_test.cpp
+ * @brief       expiring_static_cache unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+struct fake_clock
+{
+    static inline std::uint64_t now = 0;
+    
+    static std::uint64_t get_nseconds() noexcept
+    {
+        return now;
+    }
+};
+
+constexpr std::uint64_t MILLISECOND = 1'000'000;
+
+constexpr std::uint64_t HOUR = 3'600'000 * MILLISECOND;
+
+template<
+        std::size_t SIZE,
+        template<typename> class EvictionPolicyT = speed::containers::lru_eviction_policy
+>
+using cache_type = speed::containers::expiring_static_cache<
+        std::uint32_t,
+        std::uint32_t,
+        SIZE,
+        std::hash<std::uint32_t>,
+        std::equal_to<std::uint32_t>,
+        EvictionPolicyT,
+        fake_clock
+>;
+
+template<typename CacheT>
+std::size_t count_elements(CacheT& buf_cache)
+{
+    std::size_t n_elems = 0;
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        ++n_elems;
+    }
+    
+    return n_elems;
+}
+
+}
+
+TEST(containers_expiring_static_cache, lazy_expiry)
+{
+    fake_clock::now = 1000 * HOUR;
+    
+    cache_type<4> buf_cache;
+    
+    buf_cache.insert(1, 10, 5 * MILLISECOND);
+    buf_cache.insert(2, 20);
+    buf_cache.insert(3, 30, 20 * MILLISECOND);
+    
+    EXPECT_THROW(buf_cache.insert(1, 11, MILLISECOND), speed::containers::insertion_exception);
+    
+    fake_clock::now += 5 * MILLISECOND;
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(2) == 20);
+    EXPECT_TRUE(*buf_cache.find(3) == 30);
+    EXPECT_EQ(count_elements(buf_cache), 2u);
+    
+    fake_clock::now += 20 * MILLISECOND;
+    
+    buf_cache.insert(3, 31, MILLISECOND);
+    
+    EXPECT_TRUE(*buf_cache.find(3) == 31);
+    EXPECT_EQ(count_elements(buf_cache), 2u);
+}
+
+TEST(containers_expiring_static_cache, expired_reused_first)
+{
+    fake_clock::now = 0;
+    
+    cache_type<4> buf_cache;
+    
+    buf_cache.insert(1, 10);
+    buf_cache.insert(2, 20, MILLISECOND);
+    buf_cache.insert(3, 30);
+    buf_cache.insert(4, 40);
+    
+    EXPECT_FALSE(buf_cache.is_least_recently_used_free());
+    
+    fake_clock::now += 2 * MILLISECOND;
+    
+    EXPECT_TRUE(buf_cache.find(2) == buf_cache.end());
+    EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+    
+    buf_cache.insert(5, 50);
+    
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+    EXPECT_TRUE(*buf_cache.find(3) == 30);
+    EXPECT_TRUE(*buf_cache.find(4) == 40);
+    EXPECT_TRUE(*buf_cache.find(5) == 50);
+}
+
+TEST(containers_expiring_static_cache, purge_expired)
+{
+    fake_clock::now = 7 * HOUR;
+    
+    cache_type<64> buf_cache;
+    
+    for (std::uint32_t i = 0; i < 64; ++i)
+    {
+        if (i % 4 == 0)
+        {
+            buf_cache.insert(i, i);
+        }
+        else
+        {
+            buf_cache.insert(i, i, (i % 4) * 100 * MILLISECOND);
+        }
+    }
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 0u);
+    
+    fake_clock::now += 150 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 16u);
+    EXPECT_EQ(count_elements(buf_cache), 48u);
+    EXPECT_EQ(buf_cache.purge_expired(), 0u);
+    
+    fake_clock::now += HOUR;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 32u);
+    EXPECT_EQ(count_elements(buf_cache), 16u);
+    
+    for (std::uint32_t i = 0; i < 64; ++i)
+    {
+        EXPECT_EQ(buf_cache.find(i) != buf_cache.end(), i % 4 == 0);
+    }
+}
+
+TEST(containers_expiring_static_cache, long_time_to_live)
+{
+    fake_clock::now = 0;
+    
+    cache_type<8> buf_cache;
+    
+    buf_cache.insert(1, 10, 3 * HOUR);
+    buf_cache.insert(2, 20, 100 * 24 * HOUR);
+    buf_cache.insert(3, 30, 5 * 365 * 24 * HOUR);
+    
+    fake_clock::now = 2 * HOUR;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 0u);
+    
+    fake_clock::now = 3 * HOUR + 10 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 1u);
+    
+    fake_clock::now = 100 * 24 * HOUR - 10 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 0u);
+    
+    fake_clock::now = 100 * 24 * HOUR + 10 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 1u);
+    
+    fake_clock::now = 5 * 365 * 24 * HOUR - 10 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 0u);
+    EXPECT_TRUE(*buf_cache.find(3) == 30);
+    
+    fake_clock::now = 5 * 365 * 24 * HOUR + 10 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 1u);
+    EXPECT_EQ(count_elements(buf_cache), 0u);
+}
+
+TEST(containers_expiring_static_cache, lock)
+{
+    fake_clock::now = HOUR;
+    
+    cache_type<2> buf_cache;
+    
+    buf_cache.insert_and_lock(1, 10, MILLISECOND);
+    buf_cache.insert(2, 20, MILLISECOND);
+    
+    fake_clock::now += 10 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 1u);
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+    
+    buf_cache.insert(3, 30);
+    buf_cache.insert(4, 40);
+    
+    EXPECT_TRUE(buf_cache.find(3) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+    
+    buf_cache.unlock(1);
+    fake_clock::now += 10 * MILLISECOND;
+    
+    EXPECT_EQ(buf_cache.purge_expired(), 1u);
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(4) == 40);
+}
+
+TEST(containers_expiring_static_cache, eviction_policies)
+{
+    auto expect_consistent = []<template<typename> class EvictionPolicyT>()
+    {
+        fake_clock::now = 0;
+        
+        cache_type<32, EvictionPolicyT> buf_cache;
+        std::uint64_t ddlns[256] = {};
+        std::uint32_t seed = 12345;
+        
+        for (std::uint32_t i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1664525 + 1013904223;
+            
+            const std::uint32_t ky = (seed >> 8) % 256;
+            auto it = buf_cache.find(ky);
+            
+            if (it != buf_cache.end())
+            {
+                EXPECT_LT(fake_clock::now, ddlns[ky]);
+            }
+            else
+            {
+                const std::uint64_t ttl = ((seed >> 20) % 64) * MILLISECOND;
+                
+                buf_cache.insert(ky, ky, ttl);
+                ddlns[ky] = fake_clock::now + ttl;
+            }
+            
+            if (i % 100 == 0)
+            {
+                buf_cache.purge_expired();
+                
+                for (auto it2 = buf_cache.begin(); it2 != buf_cache.end(); ++it2)
+                {
+                    EXPECT_GT(ddlns[*it2] + MILLISECOND * 2, fake_clock::now);
+                }
+            }
+            
+            fake_clock::now += 100'000;
+        }
+    };
+    
+    expect_consistent.operator()<speed::containers::lru_eviction_policy>();
+    expect_consistent.operator()<speed::containers::clock_eviction_policy>();
+    expect_consistent.operator()<speed::containers::w_tinylfu_eviction_policy>();
+    expect_consistent.operator()<speed::containers::arc_eviction_policy>();
+    expect_consistent.operator()<speed::containers::s3_fifo_eviction_policy>();
+}
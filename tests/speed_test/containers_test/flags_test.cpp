@@ -97,6 +97,23 @@ TEST(containers_flags, cend)
     EXPECT_TRUE(i == 3);
 }
 
+TEST(containers_flags, iterator_operators)
+{
+    speed::containers::flags<colors> clrs;
+    
+    clrs.set(colors::BLUE);
+    clrs.set(colors::RED);
+    clrs.set(colors::GREEN);
+    
+    auto it = clrs.cbegin();
+    
+    EXPECT_TRUE(it++ == clrs.cbegin());
+    EXPECT_TRUE(*it == colors::RED);
+    EXPECT_TRUE(clrs.cbegin()[2] == colors::GREEN);
+    EXPECT_TRUE(clrs.begin()[1] == colors::RED);
+    EXPECT_TRUE(clrs.cbegin() + 3 == clrs.cend());
+}
+
 TEST(containers_flags, get_value)
 {
     speed::containers::flags<colors> clrs = colors::BLUE;
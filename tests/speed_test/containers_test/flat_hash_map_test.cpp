@@ -0,0 +1,340 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        flat_hash_map_test.cpp
+ * @brief       flat_hash_map unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+struct throwing_copy_value
+{
+    static inline std::size_t n_copies_lft = SIZE_MAX;
+    
+    explicit throwing_copy_value(std::uint32_t val)
+            : val_(val)
+    {
+    }
+    
+    throwing_copy_value(const throwing_copy_value& rhs)
+            : val_(rhs.val_)
+    {
+        if (n_copies_lft == 0)
+        {
+            throw std::runtime_error("copy failed");
+        }
+        
+        --n_copies_lft;
+    }
+    
+    throwing_copy_value(throwing_copy_value&& rhs)
+            : val_(rhs.val_)
+    {
+    }
+    
+    std::uint32_t val_;
+};
+
+}
+
+TEST(containers_flat_hash_map, insert)
+{
+    speed::containers::flat_hash_map<std::uint32_t, std::string> map;
+    
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.insert({1, "good"}).second);
+    EXPECT_TRUE(map.emplace(2u, "bye").second);
+    EXPECT_TRUE(map.try_emplace(3u, "sad").second);
+    EXPECT_FALSE(map.insert({1, "..."}).second);
+    EXPECT_FALSE(map.emplace(2u, "...").second);
+    EXPECT_FALSE(map.try_emplace(3u, "...").second);
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.find(1)->second, "good");
+    EXPECT_EQ(map.find(2)->second, "bye");
+    EXPECT_EQ(map.find(3)->second, "sad");
+    EXPECT_TRUE(map.find(4) == map.end());
+    
+    map[4] = "world";
+    map[1] = "hello";
+    
+    EXPECT_EQ(map.at(4), "world");
+    EXPECT_EQ(map.at(1), "hello");
+    EXPECT_THROW(map.at(5), speed::containers::out_of_range_exception);
+    EXPECT_FALSE(map.insert_or_assign(4u, "everyone").second);
+    EXPECT_EQ(map.at(4), "everyone");
+}
+
+TEST(containers_flat_hash_map, erase)
+{
+    speed::containers::flat_hash_map<std::uint32_t, std::uint32_t> map;
+    
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        map.emplace(i, i * 10);
+    }
+    
+    for (std::uint32_t i = 0; i < 1000; i += 2)
+    {
+        EXPECT_EQ(map.erase(i), 1u);
+    }
+    
+    EXPECT_EQ(map.erase(0u), 0u);
+    EXPECT_EQ(map.size(), 500u);
+    
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(map.contains(i), i % 2 == 1);
+    }
+    
+    map.erase(map.find(1));
+    
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(map.size(), 499u);
+}
+
+TEST(containers_flat_hash_map, erase_while_iterating)
+{
+    speed::containers::flat_hash_map<std::uint32_t, std::uint32_t> map;
+    
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        map.emplace(i, i * 10);
+    }
+    
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (it->first % 3 == 0)
+        {
+            it = map.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    
+    EXPECT_EQ(map.size(), 666u);
+    
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(map.contains(i), i % 3 != 0);
+    }
+}
+
+TEST(containers_flat_hash_map, deleted_slots_are_reused)
+{
+    speed::containers::flat_hash_map<std::uint64_t, std::uint64_t> map(100);
+    const std::size_t cap = map.capacity();
+    
+    for (std::uint64_t i = 0; i < 100000; ++i)
+    {
+        map.emplace(i, i);
+        
+        if (i >= 50)
+        {
+            map.erase(i - 50);
+        }
+    }
+    
+    EXPECT_EQ(map.size(), 50u);
+    EXPECT_EQ(map.capacity(), cap);
+    
+    for (std::uint64_t i = 100000 - 50; i < 100000; ++i)
+    {
+        EXPECT_EQ(map.at(i), i);
+    }
+}
+
+TEST(containers_flat_hash_map, iteration)
+{
+    speed::containers::flat_hash_map<std::uint32_t, std::uint32_t> map;
+    std::uint64_t sum = 0;
+    std::size_t n_elems = 0;
+    
+    EXPECT_TRUE(map.begin() == map.end());
+    
+    for (std::uint32_t i = 1; i <= 100; ++i)
+    {
+        map.emplace(i, i);
+    }
+    
+    for (auto& x : map)
+    {
+        sum += x.second;
+        ++n_elems;
+        x.second = 0;
+    }
+    
+    EXPECT_EQ(n_elems, 100u);
+    EXPECT_EQ(sum, 5050u);
+    
+    for (const auto& x : std::as_const(map))
+    {
+        EXPECT_EQ(x.second, 0u);
+    }
+}
+
+TEST(containers_flat_hash_map, heterogeneous_lookup)
+{
+    speed::containers::flat_hash_map<std::string, int> map;
+    const std::string_view ky = "gamma";
+    
+    map.emplace(std::string("alpha"), 1);
+    map.emplace(std::string("beta"), 2);
+    map[std::string(ky)] = 3;
+    
+    EXPECT_EQ(map.find("alpha")->second, 1);
+    EXPECT_EQ(map.find(std::string_view("beta"))->second, 2);
+    EXPECT_EQ(map.at(ky), 3);
+    EXPECT_TRUE(map.contains("gamma"));
+    EXPECT_FALSE(map.contains("delta"));
+    EXPECT_EQ(map.erase("beta"), 1u);
+    EXPECT_FALSE(map.contains(std::string("beta")));
+}
+
+TEST(containers_flat_hash_map, copy_and_move)
+{
+    speed::containers::flat_hash_map<std::string, std::string> map = {
+            {"one", "1"}, {"two", "2"}, {"three", "3"}};
+    auto cpy = map;
+    
+    EXPECT_EQ(cpy.size(), 3u);
+    EXPECT_EQ(cpy.at("two"), "2");
+    
+    cpy["four"] = "4";
+    
+    EXPECT_FALSE(map.contains("four"));
+    
+    auto mvd = std::move(cpy);
+    
+    EXPECT_TRUE(cpy.empty());
+    EXPECT_EQ(mvd.size(), 4u);
+    EXPECT_EQ(mvd.at("four"), "4");
+    
+    map = mvd;
+    
+    EXPECT_EQ(map.size(), 4u);
+    
+    map.clear();
+    
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains("one"));
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST(containers_flat_hash_map, move_only_values)
+{
+    speed::containers::flat_hash_map<std::uint32_t, std::unique_ptr<std::uint32_t>> map;
+    
+    for (std::uint32_t i = 0; i < 200; ++i)
+    {
+        map.try_emplace(i, std::make_unique<std::uint32_t>(i));
+    }
+    
+    for (std::uint32_t i = 0; i < 200; ++i)
+    {
+        EXPECT_EQ(*map.at(i), i);
+    }
+}
+
+TEST(containers_flat_hash_map, throwing_copy_on_resize)
+{
+    speed::containers::flat_hash_map<std::uint32_t, throwing_copy_value> map;
+    std::uint32_t n_elems = 0;
+    
+    throwing_copy_value::n_copies_lft = 10;
+    
+    try
+    {
+        for (; n_elems < 1000; ++n_elems)
+        {
+            map.try_emplace(n_elems, n_elems * 10);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+    
+    throwing_copy_value::n_copies_lft = SIZE_MAX;
+    
+    EXPECT_LT(n_elems, 1000u);
+    EXPECT_EQ(map.size(), n_elems);
+    
+    for (std::uint32_t i = 0; i < n_elems; ++i)
+    {
+        EXPECT_EQ(map.at(i).val_, i * 10);
+    }
+    
+    for (std::uint32_t i = n_elems; i < 1000; ++i)
+    {
+        map.try_emplace(i, i * 10);
+    }
+    
+    EXPECT_EQ(map.size(), 1000u);
+}
+
+TEST(containers_flat_hash_map, matches_unordered_map)
+{
+    speed::containers::flat_hash_map<std::uint32_t, std::uint32_t> map;
+    std::unordered_map<std::uint32_t, std::uint32_t> ref;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::uint32_t> dist(0, 4095);
+    
+    for (std::uint32_t i = 0; i < 100000; ++i)
+    {
+        const std::uint32_t ky = dist(gen);
+        
+        switch (gen() % 3)
+        {
+            case 0:
+                EXPECT_EQ(map.emplace(ky, i).second, ref.emplace(ky, i).second);
+                break;
+            
+            case 1:
+                EXPECT_EQ(map.erase(ky), ref.erase(ky));
+                break;
+            
+            default:
+                EXPECT_EQ(map.contains(ky), ref.contains(ky));
+                break;
+        }
+    }
+    
+    EXPECT_EQ(map.size(), ref.size());
+    
+    for (const auto& x : ref)
+    {
+        EXPECT_EQ(map.at(x.first), x.second);
+    }
+}
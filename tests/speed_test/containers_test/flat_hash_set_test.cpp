@@ -0,0 +1,86 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        flat_hash_set_test.cpp
+ * @brief       flat_hash_set unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_flat_hash_set, insert)
+{
+    speed::containers::flat_hash_set<std::uint32_t> set;
+    
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(set.insert(i * 7).second);
+    }
+    
+    EXPECT_FALSE(set.insert(7).second);
+    EXPECT_FALSE(set.emplace(14u).second);
+    EXPECT_EQ(set.size(), 1000u);
+    
+    for (std::uint32_t i = 0; i < 7000; ++i)
+    {
+        EXPECT_EQ(set.contains(i), i % 7 == 0);
+    }
+}
+
+TEST(containers_flat_hash_set, erase)
+{
+    speed::containers::flat_hash_set<std::string> set = {"red", "green", "blue"};
+    
+    EXPECT_EQ(set.erase("green"), 1u);
+    EXPECT_EQ(set.erase(std::string_view("green")), 0u);
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_TRUE(set.contains("red"));
+    EXPECT_FALSE(set.contains("green"));
+    
+    set.erase(set.find(std::string("red")));
+    
+    EXPECT_EQ(set.size(), 1u);
+    EXPECT_EQ(*set.begin(), "blue");
+}
+
+TEST(containers_flat_hash_set, iteration)
+{
+    speed::containers::flat_hash_set<std::uint32_t> set;
+    std::uint64_t sum = 0;
+    
+    for (std::uint32_t i = 1; i <= 100; ++i)
+    {
+        set.insert(i);
+    }
+    
+    for (auto it = set.cbegin(); it != set.cend(); ++it)
+    {
+        sum += *it;
+    }
+    
+    EXPECT_EQ(sum, 5050u);
+}
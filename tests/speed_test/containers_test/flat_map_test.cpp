@@ -0,0 +1,110 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        flat_map_test.cpp
+ * @brief       flat_map unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_flat_map, insert_and_find)
+{
+    speed::containers::flat_map<int, std::string> mp;
+    
+    EXPECT_TRUE(mp.empty());
+    EXPECT_TRUE(mp.insert({3, "c"}).second);
+    EXPECT_TRUE(mp.try_emplace(1, "a").second);
+    EXPECT_TRUE(mp.emplace(2, "b").second);
+    EXPECT_FALSE(mp.insert({2, "x"}).second);
+    EXPECT_EQ(mp.size(), 3U);
+    EXPECT_EQ(mp.at(2), "b");
+    EXPECT_THROW(mp.at(4), speed::containers::out_of_range_exception);
+    EXPECT_TRUE(mp.contains(1));
+    EXPECT_EQ(mp.count(4), 0U);
+    EXPECT_EQ(mp.find(4), mp.end());
+    
+    mp[4] = "d";
+    mp.insert_or_assign(1, "z");
+    EXPECT_EQ(mp.at(1), "z");
+    EXPECT_EQ(mp.at(4), "d");
+    
+    std::vector<int> kys;
+    
+    for (const auto& [ky, val] : mp)
+    {
+        kys.push_back(ky);
+    }
+    
+    EXPECT_EQ(kys, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(mp.rbegin()->first, 4);
+    
+    EXPECT_EQ(mp.erase(2), 1U);
+    EXPECT_EQ(mp.erase(2), 0U);
+    EXPECT_EQ(mp.erase(mp.begin())->first, 3);
+    EXPECT_EQ(mp.size(), 2U);
+}
+
+TEST(containers_flat_map, bounds)
+{
+    speed::containers::flat_map<int, int> mp = {{10, 1}, {20, 2}, {30, 3}};
+    
+    EXPECT_EQ(mp.lower_bound(20)->first, 20);
+    EXPECT_EQ(mp.lower_bound(15)->first, 20);
+    EXPECT_EQ(mp.upper_bound(20)->first, 30);
+    EXPECT_EQ(mp.lower_bound(5), mp.begin());
+    EXPECT_EQ(mp.lower_bound(31), mp.end());
+    EXPECT_EQ(mp.upper_bound(30), mp.end());
+}
+
+TEST(containers_flat_map, insert_range)
+{
+    speed::containers::flat_map<int, int> mp = {{5, 50}, {1, 10}};
+    std::vector<std::pair<int, int>> vals = {{4, 40}, {1, 11}, {3, 30}, {4, 41}, {2, 20}};
+    
+    mp.insert_range(vals);
+    
+    std::vector<std::pair<int, int>> res(mp.begin(), mp.end());
+    
+    EXPECT_EQ(res, (std::vector<std::pair<int, int>>{
+            {1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}}));
+    
+    speed::containers::flat_map<int, int> dup = {{2, 1}, {1, 1}, {2, 2}};
+    
+    EXPECT_EQ(dup.size(), 2U);
+    EXPECT_EQ(dup.at(2), 1);
+}
+
+TEST(containers_flat_map, transparent_lookup)
+{
+    speed::containers::flat_map<std::string, int, std::less<>> mp = {{"b", 2}, {"a", 1}};
+    
+    EXPECT_EQ(mp.at(std::string_view("b")), 2);
+    EXPECT_TRUE(mp.contains("a"));
+    EXPECT_EQ(mp.lower_bound(std::string_view("aa"))->first, "b");
+}
@@ -0,0 +1,235 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        flat_static_cache_test.cpp
+ * @brief       flat_static_cache unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/15
+ */
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_flat_static_cache, insert)
+{
+    speed::containers::flat_static_cache<std::uint32_t, std::string, 4> buf_cache;
+    
+    buf_cache.insert(1, "good");
+    buf_cache.insert(2, "bye");
+    buf_cache.insert(3, "sad");
+    buf_cache.insert(4, "world");
+    
+    EXPECT_THROW(buf_cache.insert(1, "..."), speed::containers::insertion_exception);
+    EXPECT_TRUE(*buf_cache.find(1) == "good");
+    EXPECT_TRUE(*buf_cache.find(2) == "bye");
+    EXPECT_TRUE(*buf_cache.find(3) == "sad");
+    EXPECT_TRUE(*buf_cache.find(4) == "world");
+    
+    buf_cache.insert(32874, "next");
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(32874) == "next");
+}
+
+struct throwing_assignment_value
+{
+    static inline bool thrw_on_assign = false;
+    
+    throwing_assignment_value() = default;
+    
+    throwing_assignment_value(std::uint32_t val)
+            : val_(val)
+    {
+    }
+    
+    throwing_assignment_value& operator =(throwing_assignment_value&& rhs)
+    {
+        if (thrw_on_assign)
+        {
+            throw std::runtime_error("assignment failed");
+        }
+        
+        val_ = rhs.val_;
+        
+        return *this;
+    }
+    
+    std::uint32_t val_ = 0;
+};
+
+TEST(containers_flat_static_cache, insert_throwing_assignment)
+{
+    speed::containers::flat_static_cache<std::uint32_t, throwing_assignment_value, 1> buf_cache;
+    
+    buf_cache.insert(1, throwing_assignment_value(111));
+    
+    throwing_assignment_value::thrw_on_assign = true;
+    EXPECT_THROW(buf_cache.insert(2, throwing_assignment_value(222)), std::runtime_error);
+    throwing_assignment_value::thrw_on_assign = false;
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(buf_cache.find(2) == buf_cache.end());
+    EXPECT_TRUE(buf_cache.begin() == buf_cache.end());
+    EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+    
+    buf_cache.insert(3, throwing_assignment_value(333));
+    
+    EXPECT_TRUE(buf_cache.find(2) == buf_cache.end());
+    EXPECT_EQ(buf_cache.find(3)->val_, 333u);
+}
+
+TEST(containers_flat_static_cache, find)
+{
+    speed::containers::flat_static_cache<std::uint32_t, std::string, 16> buf_cache;
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(buf_cache.begin() == buf_cache.end());
+}
+
+TEST(containers_flat_static_cache, find_and_lock)
+{
+    speed::containers::flat_static_cache<std::uint32_t, std::string, 4> buf_cache;
+    
+    buf_cache.insert(1, "good");
+    buf_cache.insert(2, "bye");
+    buf_cache.insert(3, "sad");
+    buf_cache.insert(4, "world");
+    
+    EXPECT_TRUE(*buf_cache.find_and_lock(1) == "good");
+    EXPECT_TRUE(buf_cache.find_and_lock(5) == buf_cache.end());
+    
+    buf_cache.insert(32874, "next");
+    
+    EXPECT_TRUE(buf_cache.find(1) != buf_cache.end());
+    EXPECT_TRUE(buf_cache.find(2) == buf_cache.end());
+}
+
+TEST(containers_flat_static_cache, unlock)
+{
+    speed::containers::flat_static_cache<std::uint32_t, std::string, 4> buf_cache;
+    
+    buf_cache.insert_and_lock(1, "good");
+    buf_cache.insert(2, "bye");
+    buf_cache.insert(3, "sad");
+    buf_cache.insert(4, "world");
+    buf_cache.insert(5, "next");
+    
+    EXPECT_TRUE(buf_cache.find(1) != buf_cache.end());
+    
+    buf_cache.unlock(1);
+    buf_cache.insert(6, "bye");
+    buf_cache.insert(7, "sad");
+    buf_cache.insert(8, "world");
+    buf_cache.insert(9, "next");
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    
+    buf_cache.lock(9);
+    buf_cache.lock(10);
+    buf_cache.lock(6);
+    buf_cache.lock(7);
+    buf_cache.lock(8);
+    
+    EXPECT_THROW(buf_cache.insert(11, "full"), speed::containers::exhausted_resources_exception);
+}
+
+TEST(containers_flat_static_cache, iteration)
+{
+    speed::containers::flat_static_cache<std::uint32_t, std::uint32_t, 8> buf_cache;
+    std::uint32_t sum = 0;
+    std::size_t cnt = 0;
+    
+    for (std::uint32_t i = 1; i <= 12; ++i)
+    {
+        buf_cache.insert(i, i);
+    }
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        sum += *it;
+        ++cnt;
+    }
+    
+    EXPECT_EQ(cnt, 8u);
+    EXPECT_EQ(sum, 5u + 6 + 7 + 8 + 9 + 10 + 11 + 12);
+}
+
+TEST(containers_flat_static_cache, least_recently_used)
+{
+    speed::containers::flat_static_cache<std::uint32_t, std::uint32_t, 2> buf_cache;
+    
+    EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+    
+    buf_cache.insert(1, 10);
+    buf_cache.insert(2, 20);
+    
+    EXPECT_FALSE(buf_cache.is_least_recently_used_free());
+    EXPECT_EQ(buf_cache.get_least_recently_used(), 10u);
+    
+    buf_cache.find(1);
+    
+    EXPECT_EQ(buf_cache.get_least_recently_used(), 20u);
+}
+
+template<std::size_t SIZE>
+void expect_same_behavior_as_static_cache(std::uint32_t max_ky)
+{
+    using flat_cache_type = speed::containers::flat_static_cache<
+            std::uint32_t, std::uint32_t, SIZE>;
+    using cache_type = speed::containers::static_cache<std::uint32_t, std::uint32_t, SIZE>;
+    
+    auto flat_cache = std::make_unique<flat_cache_type>();
+    auto cache = std::make_unique<cache_type>();
+    std::mt19937 rnd_gen(42);
+    std::uniform_int_distribution<std::uint32_t> ky_dist(0, max_ky);
+    
+    for (std::uint32_t i = 0; i < 20000; ++i)
+    {
+        std::uint32_t ky = ky_dist(rnd_gen);
+        auto flat_it = flat_cache->find(ky);
+        auto it = cache->find(ky);
+        
+        ASSERT_EQ(flat_it.end(), it.end());
+        
+        if (it.end())
+        {
+            flat_cache->insert(ky, i);
+            cache->insert(ky, i);
+        }
+        else
+        {
+            ASSERT_EQ(*flat_it, *it);
+        }
+    }
+}
+
+TEST(containers_flat_static_cache, matches_static_cache)
+{
+    expect_same_behavior_as_static_cache<1>(4);
+    expect_same_behavior_as_static_cache<3>(8);
+    expect_same_behavior_as_static_cache<64>(255);
+    expect_same_behavior_as_static_cache<1000>(3000);
+}
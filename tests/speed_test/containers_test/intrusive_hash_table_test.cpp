@@ -0,0 +1,226 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        intrusive_hash_table_test.cpp
+ * @brief       intrusive_hash_table unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+struct entry
+{
+    std::string ky_;
+    
+    int val_ = 0;
+    
+    speed::containers::intrusive_hash_hook<entry> hsh_hk_;
+    
+    speed::containers::intrusive_list_hook<entry> lru_hk_;
+};
+
+struct key_of_entry
+{
+    const std::string& operator()(const entry& ent) const noexcept
+    {
+        return ent.ky_;
+    }
+};
+
+using table_type = speed::containers::intrusive_hash_table<entry, &entry::hsh_hk_, key_of_entry>;
+
+using lru_list_type = speed::containers::intrusive_list<entry, &entry::lru_hk_>;
+
+}
+
+TEST(containers_intrusive_hash_table, insert_find_and_erase)
+{
+    std::array<entry, 40> ents;
+    std::array<table_type::bucket_type, 20> bkts;
+    table_type tbl(bkts);
+    
+    EXPECT_EQ(tbl.bucket_count(), 16u);
+    
+    for (std::size_t i = 0; i < ents.size(); ++i)
+    {
+        ents[i].ky_ = "key" + std::to_string(i);
+        ents[i].val_ = static_cast<int>(i);
+        
+        EXPECT_TRUE(tbl.insert(ents[i]).second);
+    }
+    
+    entry dup;
+    
+    dup.ky_ = "key7";
+    auto [it, insrtd] = tbl.insert(dup);
+    
+    EXPECT_FALSE(insrtd);
+    EXPECT_EQ(&*it, &ents[7]);
+    EXPECT_FALSE(dup.hsh_hk_.is_linked());
+    EXPECT_EQ(tbl.size(), 40u);
+    
+    for (std::size_t i = 0; i < ents.size(); ++i)
+    {
+        ASSERT_NE(tbl.find("key" + std::to_string(i)), tbl.end());
+        EXPECT_EQ(tbl.find("key" + std::to_string(i))->val_, static_cast<int>(i));
+    }
+    
+    EXPECT_EQ(tbl.find("key40"), tbl.end());
+    EXPECT_EQ(tbl.erase("key3"), 1u);
+    EXPECT_EQ(tbl.erase("key3"), 0u);
+    EXPECT_FALSE(ents[3].hsh_hk_.is_linked());
+    
+    tbl.erase(ents[4]);
+    
+    EXPECT_FALSE(tbl.contains("key4"));
+    EXPECT_TRUE(tbl.contains("key5"));
+    EXPECT_EQ(tbl.size(), 38u);
+    
+    tbl.clear();
+    
+    EXPECT_TRUE(tbl.empty());
+    EXPECT_TRUE(std::none_of(ents.begin(), ents.end(), [](const entry& ent) {
+        return ent.hsh_hk_.is_linked();
+    }));
+}
+
+TEST(containers_intrusive_hash_table, iterate_and_rehash)
+{
+    std::array<entry, 30> ents;
+    std::array<table_type::bucket_type, 4> bkts;
+    std::array<table_type::bucket_type, 64> big_bkts;
+    table_type tbl(bkts);
+    std::vector<int> vals;
+    std::vector<int> rvals;
+    
+    for (std::size_t i = 0; i < ents.size(); ++i)
+    {
+        ents[i].ky_ = std::to_string(i);
+        ents[i].val_ = static_cast<int>(i);
+        tbl.insert(ents[i]);
+    }
+    
+    tbl.rehash(big_bkts);
+    
+    EXPECT_EQ(tbl.bucket_count(), 64u);
+    EXPECT_EQ(tbl.size(), 30u);
+    
+    for (const auto& ent : tbl)
+    {
+        vals.push_back(ent.val_);
+    }
+    
+    for (auto it = tbl.end(); it != tbl.begin();)
+    {
+        --it;
+        rvals.push_back(it->val_);
+    }
+    
+    std::reverse(rvals.begin(), rvals.end());
+    
+    EXPECT_EQ(vals, rvals);
+    std::sort(vals.begin(), vals.end());
+    EXPECT_EQ(vals.size(), 30u);
+    EXPECT_EQ(vals.front(), 0);
+    EXPECT_EQ(vals.back(), 29);
+    
+    for (auto it = tbl.begin(); it != tbl.end();)
+    {
+        it = it->val_ % 2 == 0 ? tbl.erase(it) : it + 1;
+    }
+    
+    EXPECT_EQ(tbl.size(), 15u);
+    EXPECT_FALSE(tbl.contains("4"));
+    EXPECT_TRUE(tbl.contains("5"));
+}
+
+TEST(containers_intrusive_hash_table, lru_over_pool)
+{
+    std::array<entry, 4> pool;
+    std::array<table_type::bucket_type, 8> bkts;
+    table_type tbl(bkts);
+    lru_list_type lru;
+    
+    for (auto& ent : pool)
+    {
+        lru.push_back(ent);
+    }
+    
+    auto access = [&](const std::string& ky)
+    {
+        auto it = tbl.find(ky);
+        
+        if (it != tbl.end())
+        {
+            lru.move_to_back(*it);
+            return true;
+        }
+        
+        entry& vctm = lru.front();
+        
+        if (vctm.hsh_hk_.is_linked())
+        {
+            tbl.erase(vctm);
+        }
+        
+        vctm.ky_ = ky;
+        tbl.insert(vctm);
+        lru.move_to_back(vctm);
+        
+        return false;
+    };
+    
+    EXPECT_FALSE(access("a"));
+    EXPECT_FALSE(access("b"));
+    EXPECT_FALSE(access("c"));
+    EXPECT_FALSE(access("d"));
+    EXPECT_TRUE(access("a"));
+    EXPECT_FALSE(access("e"));
+    EXPECT_FALSE(tbl.contains("b"));
+    EXPECT_TRUE(access("a"));
+    EXPECT_TRUE(access("c"));
+    EXPECT_EQ(tbl.size(), 4u);
+}
+
+TEST(containers_intrusive_hash_table, no_buckets)
+{
+    entry ent;
+    table_type tbl({});
+    
+    ent.ky_ = "key";
+    
+    EXPECT_EQ(tbl.bucket_count(), 0u);
+    EXPECT_THROW(tbl.insert(ent), speed::containers::exhausted_resources_exception);
+    EXPECT_FALSE(ent.hsh_hk_.is_linked());
+    EXPECT_TRUE(tbl.find("key") == tbl.end());
+    EXPECT_FALSE(tbl.contains("key"));
+    EXPECT_EQ(tbl.erase("key"), 0u);
+    EXPECT_TRUE(tbl.empty());
+}
@@ -0,0 +1,186 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        intrusive_list_test.cpp
+ * @brief       intrusive_list unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+struct node
+{
+    int val_ = 0;
+    
+    speed::containers::intrusive_list_hook<node> hk1_;
+    
+    speed::containers::intrusive_list_hook<node> hk2_;
+};
+
+using list1_type = speed::containers::intrusive_list<node, &node::hk1_>;
+
+using list2_type = speed::containers::intrusive_list<node, &node::hk2_>;
+
+template<typename ListT>
+std::vector<int> get_values(const ListT& lst)
+{
+    std::vector<int> vals;
+    
+    for (const auto& nd : lst)
+    {
+        vals.push_back(nd.val_);
+    }
+    
+    return vals;
+}
+
+}
+
+TEST(containers_intrusive_list, push_and_erase)
+{
+    std::array<node, 5> nds;
+    list1_type lst;
+    
+    for (int i = 0; i < 5; ++i)
+    {
+        nds[i].val_ = i;
+    }
+    
+    EXPECT_TRUE(lst.empty());
+    
+    lst.push_back(nds[1]);
+    lst.push_back(nds[2]);
+    lst.push_front(nds[0]);
+    lst.insert(lst.iterator_to(nds[2]), nds[3]);
+    lst.insert(lst.end(), nds[4]);
+    
+    EXPECT_EQ(lst.size(), 5u);
+    EXPECT_EQ(get_values(lst), std::vector<int>({0, 1, 3, 2, 4}));
+    EXPECT_EQ(lst.front().val_, 0);
+    EXPECT_EQ(lst.back().val_, 4);
+    EXPECT_TRUE(nds[3].hk1_.is_linked());
+    
+    lst.erase(nds[3]);
+    
+    EXPECT_FALSE(nds[3].hk1_.is_linked());
+    EXPECT_EQ(lst.erase(lst.iterator_to(nds[1]))->val_, 2);
+    
+    lst.pop_front();
+    lst.pop_back();
+    
+    EXPECT_EQ(get_values(lst), std::vector<int>({2}));
+    
+    lst.pop_back();
+    
+    EXPECT_TRUE(lst.empty());
+    EXPECT_EQ(lst.begin(), lst.end());
+}
+
+TEST(containers_intrusive_list, move_and_splice)
+{
+    std::array<node, 6> nds;
+    list1_type lst1;
+    list1_type lst2;
+    
+    for (int i = 0; i < 6; ++i)
+    {
+        nds[i].val_ = i;
+        (i < 3 ? lst1 : lst2).push_back(nds[i]);
+    }
+    
+    lst1.move_to_back(nds[0]);
+    lst1.move_to_front(nds[2]);
+    lst1.move_to_back(nds[1]);
+    
+    EXPECT_EQ(get_values(lst1), std::vector<int>({2, 0, 1}));
+    
+    lst1.splice_back(lst2);
+    
+    EXPECT_TRUE(lst2.empty());
+    EXPECT_EQ(lst1.size(), 6u);
+    EXPECT_EQ(get_values(lst1), std::vector<int>({2, 0, 1, 3, 4, 5}));
+    
+    list1_type lst3(std::move(lst1));
+    
+    EXPECT_TRUE(lst1.empty());
+    EXPECT_EQ(get_values(lst3), std::vector<int>({2, 0, 1, 3, 4, 5}));
+    
+    lst3.clear();
+    
+    for (auto& nd : nds)
+    {
+        EXPECT_FALSE(nd.hk1_.is_linked());
+    }
+}
+
+TEST(containers_intrusive_list, iterators)
+{
+    std::array<node, 4> nds;
+    list1_type lst;
+    
+    for (int i = 0; i < 4; ++i)
+    {
+        nds[i].val_ = i;
+        lst.push_back(nds[i]);
+    }
+    
+    auto it = lst.end();
+    
+    --it;
+    EXPECT_EQ(it->val_, 3);
+    EXPECT_EQ((it - 3)->val_, 0);
+    EXPECT_EQ(lst.begin()[2].val_, 2);
+    EXPECT_TRUE(lst.begin() < it);
+    
+    for (auto& nd : lst)
+    {
+        nd.val_ *= 10;
+    }
+    
+    EXPECT_EQ(get_values(lst), std::vector<int>({0, 10, 20, 30}));
+}
+
+TEST(containers_intrusive_list, several_lists)
+{
+    std::array<node, 4> nds;
+    list1_type lst1;
+    list2_type lst2;
+    
+    for (int i = 0; i < 4; ++i)
+    {
+        nds[i].val_ = i;
+        lst1.push_back(nds[i]);
+        lst2.push_front(nds[i]);
+    }
+    
+    lst1.erase(nds[1]);
+    lst2.erase(nds[2]);
+    
+    EXPECT_EQ(get_values(lst1), std::vector<int>({0, 2, 3}));
+    EXPECT_EQ(get_values(lst2), std::vector<int>({3, 1, 0}));
+}
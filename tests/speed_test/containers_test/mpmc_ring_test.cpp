@@ -0,0 +1,184 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        mpmc_ring_test.cpp
+ * @brief       mpmc_ring unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_mpmc_ring, push_and_pop)
+{
+    speed::containers::mpmc_ring<std::string> ring(4);
+    std::string val;
+    
+    EXPECT_TRUE(ring.is_empty());
+    EXPECT_FALSE(ring.try_pop(val));
+    
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(ring.try_push(std::to_string(i)));
+        }
+        
+        EXPECT_FALSE(ring.try_push("full"));
+        EXPECT_EQ(ring.get_count(), 4u);
+        
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(ring.try_pop(val));
+            EXPECT_EQ(val, std::to_string(i));
+        }
+        
+        EXPECT_FALSE(ring.try_pop(val));
+    }
+}
+
+TEST(containers_mpmc_ring, bulk)
+{
+    speed::containers::mpmc_ring<std::uint32_t> ring(8);
+    std::array<std::uint32_t, 6> in_vals = {1, 2, 3, 4, 5, 6};
+    std::array<std::uint32_t, 6> out_vals = {};
+    std::uint32_t val;
+    
+    EXPECT_EQ(ring.try_push_bulk(std::span(in_vals)), 6u);
+    EXPECT_EQ(ring.try_push_bulk(std::span(std::as_const(in_vals))), 2u);
+    EXPECT_EQ(ring.try_push_bulk(std::span(in_vals)), 0u);
+    EXPECT_EQ(ring.try_pop_bulk(std::span(out_vals)), 6u);
+    EXPECT_EQ(out_vals, in_vals);
+    EXPECT_TRUE(ring.try_pop(val));
+    EXPECT_EQ(val, 1u);
+    EXPECT_EQ(ring.try_pop_bulk(std::span(out_vals)), 1u);
+    EXPECT_EQ(out_vals[0], 2u);
+    EXPECT_EQ(ring.try_pop_bulk(std::span(out_vals)), 0u);
+}
+
+TEST(containers_mpmc_ring, destroys_left_elements)
+{
+    auto val = std::make_shared<int>(0);
+    
+    {
+        speed::containers::mpmc_ring<std::shared_ptr<int>> ring(4);
+        
+        ring.try_push(val);
+        ring.try_push(val);
+        
+        EXPECT_EQ(val.use_count(), 3);
+    }
+    
+    EXPECT_EQ(val.use_count(), 1);
+}
+
+TEST(containers_mpmc_ring, threads)
+{
+    constexpr std::uint64_t n_prods = 3;
+    constexpr std::uint64_t n_conss = 3;
+    constexpr std::uint64_t n_vals_per_prod = 50000;
+    constexpr std::uint64_t n_vals = n_prods * n_vals_per_prod;
+    speed::containers::mpmc_ring<std::uint64_t> ring(64);
+    std::atomic<std::uint64_t> n_popped = 0;
+    std::atomic<std::uint64_t> sum = 0;
+    std::vector<std::thread> thrds;
+    
+    for (std::uint64_t i = 0; i < n_prods; ++i)
+    {
+        thrds.emplace_back([&, i]
+        {
+            std::array<std::uint64_t, 4> vals;
+            std::uint64_t nxt_val = i * n_vals_per_prod;
+            const std::uint64_t lst_val = nxt_val + n_vals_per_prod;
+            
+            while (nxt_val < lst_val)
+            {
+                if (nxt_val % 2 == 0 && nxt_val + vals.size() <= lst_val)
+                {
+                    for (std::size_t j = 0; j < vals.size(); ++j)
+                    {
+                        vals[j] = nxt_val + j;
+                    }
+                    
+                    nxt_val += ring.try_push_bulk(std::span(vals));
+                }
+                else if (ring.try_push(nxt_val))
+                {
+                    ++nxt_val;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    
+    for (std::uint64_t i = 0; i < n_conss; ++i)
+    {
+        thrds.emplace_back([&, i]
+        {
+            std::array<std::uint64_t, 4> vals;
+            std::uint64_t loc_sum = 0;
+            std::size_t n_vals_popped;
+            
+            while (n_popped.load() < n_vals)
+            {
+                n_vals_popped = i % 2 == 0 ? ring.try_pop_bulk(std::span(vals))
+                                           : ring.try_pop(vals[0]);
+                
+                if (n_vals_popped == 0)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                
+                for (std::size_t j = 0; j < n_vals_popped; ++j)
+                {
+                    loc_sum += vals[j];
+                }
+                
+                n_popped += n_vals_popped;
+            }
+            
+            sum += loc_sum;
+        });
+    }
+    
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+    
+    EXPECT_EQ(n_popped.load(), n_vals);
+    EXPECT_EQ(sum.load(), n_vals * (n_vals - 1) / 2);
+    EXPECT_TRUE(ring.is_empty());
+}
@@ -0,0 +1,193 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        small_vector_test.cpp
+ * @brief       small_vector unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+std::size_t n_allocs = 0;
+
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+    
+    counting_allocator() = default;
+    
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept
+    {
+    }
+    
+    T* allocate(std::size_t n)
+    {
+        ++n_allocs;
+        return std::allocator<T>().allocate(n);
+    }
+    
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        std::allocator<T>().deallocate(p, n);
+    }
+    
+    template<typename U>
+    bool operator ==(const counting_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+};
+
+using string_small_vector_type =
+        speed::containers::small_vector<std::string, 4, counting_allocator<std::string>>;
+
+}
+
+TEST(containers_small_vector, inline_storage)
+{
+    n_allocs = 0;
+    string_small_vector_type vec;
+    
+    EXPECT_TRUE(vec.empty());
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(vec.capacity(), 4u);
+    
+    vec.push_back("a");
+    vec.emplace_back(2, 'b');
+    vec.push_back(std::string("c"));
+    vec.emplace_back("d");
+    
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(n_allocs, 0u);
+    EXPECT_EQ(vec, string_small_vector_type({"a", "bb", "c", "d"}));
+    
+    vec.push_back("e");
+    
+    EXPECT_FALSE(vec.is_inline());
+    EXPECT_EQ(n_allocs, 1u);
+    EXPECT_EQ(vec.size(), 5u);
+    EXPECT_EQ(vec.front(), "a");
+    EXPECT_EQ(vec.back(), "e");
+    
+    vec.pop_back();
+    vec.shrink_to_fit();
+    
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(vec, string_small_vector_type({"a", "bb", "c", "d"}));
+}
+
+TEST(containers_small_vector, self_references)
+{
+    string_small_vector_type vec = {"a", "b", "c", "d"};
+    
+    vec.push_back(vec[0]);
+    vec.insert(vec.begin(), 3, vec.back());
+    vec.emplace_back(vec.front());
+    
+    EXPECT_EQ(vec, string_small_vector_type({"a", "a", "a", "a", "b", "c", "d", "a", "a"}));
+}
+
+TEST(containers_small_vector, insert_and_erase)
+{
+    std::vector<int> src = {7, 8, 9};
+    speed::containers::small_vector<int, 3> vec = {1, 2, 3};
+    
+    EXPECT_EQ(*vec.insert(vec.begin() + 1, 10), 10);
+    EXPECT_EQ(*vec.insert(vec.end(), src.begin(), src.end()), 7);
+    EXPECT_EQ(*vec.emplace(vec.begin(), 0), 0);
+    EXPECT_EQ(vec, (speed::containers::small_vector<int, 3>({0, 1, 10, 2, 3, 7, 8, 9})));
+    
+    EXPECT_EQ(*vec.erase(vec.begin() + 2), 2);
+    auto it = vec.erase(vec.begin() + 4, vec.end());
+    
+    EXPECT_EQ(it, vec.end());
+    EXPECT_EQ(vec, (speed::containers::small_vector<int, 3>({0, 1, 2, 3})));
+    
+    vec.resize(6, 5);
+    EXPECT_EQ(vec, (speed::containers::small_vector<int, 3>({0, 1, 2, 3, 5, 5})));
+    vec.resize(2);
+    EXPECT_EQ(vec, (speed::containers::small_vector<int, 3>({0, 1})));
+    EXPECT_TRUE(vec < (speed::containers::small_vector<int, 3>({0, 2})));
+    
+    EXPECT_EQ(vec.at(1), 1);
+    EXPECT_THROW(static_cast<void>(vec.at(2)), speed::containers::out_of_range_exception);
+}
+
+TEST(containers_small_vector, copy_and_move)
+{
+    string_small_vector_type inln = {"a", "b"};
+    string_small_vector_type hp = {"a", "b", "c", "d", "e"};
+    const std::string* hp_dat = hp.data();
+    string_small_vector_type cpy(hp);
+    
+    EXPECT_EQ(cpy, hp);
+    
+    string_small_vector_type mved(std::move(hp));
+    
+    EXPECT_EQ(mved.data(), hp_dat);
+    EXPECT_TRUE(hp.empty());
+    EXPECT_TRUE(hp.is_inline());
+    
+    hp = std::move(inln);
+    
+    EXPECT_EQ(hp, string_small_vector_type({"a", "b"}));
+    EXPECT_TRUE(inln.empty());
+    
+    cpy = hp;
+    
+    EXPECT_EQ(cpy, hp);
+    
+    hp.swap(mved);
+    
+    EXPECT_EQ(hp.size(), 5u);
+    EXPECT_EQ(mved.size(), 2u);
+    
+    mved.assign(3, "x");
+    
+    EXPECT_EQ(mved, string_small_vector_type({"x", "x", "x"}));
+}
+
+TEST(containers_small_vector, move_only_elements)
+{
+    speed::containers::small_vector<std::unique_ptr<int>, 2> vec;
+    
+    for (int i = 0; i < 5; ++i)
+    {
+        vec.push_back(std::make_unique<int>(i));
+    }
+    
+    vec.erase(vec.begin());
+    auto mved = std::move(vec);
+    
+    ASSERT_EQ(mved.size(), 4u);
+    EXPECT_EQ(*mved[0], 1);
+    EXPECT_EQ(*mved[3], 4);
+}
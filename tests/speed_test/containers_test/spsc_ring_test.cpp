@@ -0,0 +1,136 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        spsc_ring_test.cpp
+ * @brief       spsc_ring unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+TEST(containers_spsc_ring, push_and_pop)
+{
+    speed::containers::spsc_ring<std::string> ring(3);
+    std::string val;
+    
+    EXPECT_EQ(ring.get_capacity(), 4u);
+    EXPECT_TRUE(ring.is_empty());
+    EXPECT_FALSE(ring.try_pop(val));
+    
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.try_push(std::to_string(i)));
+    }
+    
+    EXPECT_FALSE(ring.try_push("full"));
+    EXPECT_EQ(ring.get_count(), 4u);
+    
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.try_pop(val));
+        EXPECT_EQ(val, std::to_string(i));
+    }
+    
+    EXPECT_FALSE(ring.try_pop(val));
+    EXPECT_TRUE(ring.try_emplace(3, 'x'));
+    EXPECT_TRUE(ring.try_pop(val));
+    EXPECT_EQ(val, "xxx");
+}
+
+TEST(containers_spsc_ring, bulk)
+{
+    speed::containers::spsc_ring<std::uint32_t> ring(8);
+    const std::array<std::uint32_t, 6> in_vals = {1, 2, 3, 4, 5, 6};
+    std::array<std::uint32_t, 6> out_vals = {};
+    
+    EXPECT_EQ(ring.try_push_bulk(std::span(in_vals)), 6u);
+    EXPECT_EQ(ring.try_push_bulk(std::span(in_vals)), 2u);
+    EXPECT_EQ(ring.try_pop_bulk(std::span(out_vals)), 6u);
+    EXPECT_EQ(out_vals, in_vals);
+    EXPECT_EQ(ring.try_pop_bulk(std::span(out_vals)), 2u);
+    EXPECT_EQ(out_vals[0], 1u);
+    EXPECT_EQ(out_vals[1], 2u);
+    EXPECT_EQ(ring.try_pop_bulk(std::span(out_vals)), 0u);
+}
+
+TEST(containers_spsc_ring, destroys_left_elements)
+{
+    auto val = std::make_shared<int>(0);
+    
+    {
+        speed::containers::spsc_ring<std::shared_ptr<int>> ring(4);
+        
+        ring.try_push(val);
+        ring.try_push(val);
+        
+        EXPECT_EQ(val.use_count(), 3);
+    }
+    
+    EXPECT_EQ(val.use_count(), 1);
+}
+
+TEST(containers_spsc_ring, threads)
+{
+    constexpr std::uint64_t n_vals = 200000;
+    speed::containers::spsc_ring<std::uint64_t> ring(64);
+    std::uint64_t sum = 0;
+    std::uint64_t nxt_val = 0;
+    bool in_order = true;
+    
+    std::thread prod([&]
+    {
+        for (std::uint64_t i = 0; i < n_vals; ++i)
+        {
+            while (!ring.try_push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+    
+    for (std::uint64_t val; nxt_val < n_vals;)
+    {
+        if (ring.try_pop(val))
+        {
+            in_order = in_order && val == nxt_val;
+            sum += val;
+            ++nxt_val;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    
+    prod.join();
+    
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(sum, n_vals * (n_vals - 1) / 2);
+}
@@ -24,6 +24,16 @@
  * @date        2018/01/12
  */
 
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+
 #include <gtest/gtest.h>
 
 #include "speed/containers/containers.hpp"
@@ -109,3 +119,549 @@ TEST(cotainers_static_cache, unlock)
     
     EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
 }
+
+struct counting_hash
+{
+    inline static std::size_t n_calls = 0;
+    
+    std::size_t operator ()(std::uint32_t ky) const noexcept
+    {
+        ++n_calls;
+        return std::hash<std::uint32_t>()(ky);
+    }
+};
+
+struct colliding_hash
+{
+    std::size_t operator ()(std::uint32_t ky) const noexcept
+    {
+        return (ky % 3) << 8;
+    }
+};
+
+TEST(cotainers_static_cache, hash_once)
+{
+    speed::containers::static_cache<std::uint32_t, std::string, 2, counting_hash> buf_cache;
+    
+    counting_hash::n_calls = 0;
+    buf_cache.insert(1, "good");
+    buf_cache.insert(2, "bye");
+    buf_cache.insert(3, "sad");
+    
+    EXPECT_EQ(counting_hash::n_calls, 3u);
+    
+    counting_hash::n_calls = 0;
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(3) == "sad");
+    EXPECT_EQ(counting_hash::n_calls, 2u);
+}
+
+TEST(cotainers_static_cache, colliding_hashes)
+{
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 8, colliding_hash> buf_cache;
+    
+    for (std::uint32_t i = 0; i < 12; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    for (std::uint32_t i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(buf_cache.find(i) == buf_cache.end());
+    }
+    
+    for (std::uint32_t i = 4; i < 12; ++i)
+    {
+        EXPECT_TRUE(*buf_cache.find(i) == i * 10);
+    }
+}
+
+TEST(cotainers_static_cache, iteration)
+{
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 8> buf_cache;
+    std::uint32_t sum = 0;
+    
+    EXPECT_TRUE(buf_cache.begin() == buf_cache.end());
+    
+    for (std::uint32_t i = 1; i <= 12; ++i)
+    {
+        buf_cache.insert(i, i);
+    }
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        sum += *it;
+    }
+    
+    EXPECT_EQ(sum, 5u + 6 + 7 + 8 + 9 + 10 + 11 + 12);
+}
+
+TEST(cotainers_static_cache, iterator_operators)
+{
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 8> buf_cache;
+    
+    for (std::uint32_t i = 1; i <= 4; ++i)
+    {
+        buf_cache.insert(i, i);
+    }
+    
+    auto it = buf_cache.begin();
+    auto old_it = it++;
+    
+    EXPECT_TRUE(old_it == buf_cache.begin());
+    EXPECT_TRUE(old_it != it);
+    EXPECT_TRUE(old_it < it);
+    EXPECT_TRUE(old_it <= it);
+    EXPECT_EQ(old_it[1], *it);
+    EXPECT_TRUE(old_it + 1 == it);
+    EXPECT_TRUE(it - 1 == old_it);
+    EXPECT_TRUE(it-- == old_it + 1);
+    EXPECT_TRUE(it == old_it);
+    
+    it += 4;
+    EXPECT_TRUE(it == buf_cache.end());
+    
+    decltype(buf_cache)::const_iterator cit = buf_cache.cbegin();
+    
+    EXPECT_EQ(cit[3], *(cit + 3));
+    EXPECT_TRUE(cit + 4 == buf_cache.cend());
+}
+
+TEST(cotainers_static_cache, clock_second_chance)
+{
+    speed::containers::static_cache<
+            std::uint32_t,
+            std::uint32_t,
+            4,
+            std::hash<std::uint32_t>,
+            std::equal_to<std::uint32_t>,
+            speed::containers::clock_eviction_policy
+    > buf_cache;
+    
+    for (std::uint32_t i = 1; i <= 4; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+    EXPECT_TRUE(buf_cache.get_least_recently_used() == 20);
+    
+    buf_cache.insert(5, 50);
+    buf_cache.insert(6, 60);
+    
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+    EXPECT_TRUE(buf_cache.find(2) == buf_cache.end());
+    EXPECT_TRUE(buf_cache.find(3) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(4) == 40);
+}
+
+TEST(cotainers_static_cache, clock_lock)
+{
+    speed::containers::static_cache<
+            std::uint32_t,
+            std::uint32_t,
+            4,
+            std::hash<std::uint32_t>,
+            std::equal_to<std::uint32_t>,
+            speed::containers::clock_eviction_policy
+    > buf_cache;
+    std::uint32_t sum = 0;
+    
+    for (std::uint32_t i = 1; i <= 4; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    buf_cache.lock(1);
+    
+    for (std::uint32_t i = 5; i <= 8; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    EXPECT_TRUE(*buf_cache.find(1) == 10);
+    EXPECT_TRUE(buf_cache.find(5) == buf_cache.end());
+    
+    buf_cache.unlock(1);
+    buf_cache.insert(9, 90);
+    buf_cache.insert(10, 100);
+    buf_cache.insert(11, 110);
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        sum += *it;
+    }
+    
+    EXPECT_EQ(sum, 10u + 90 + 100 + 110);
+    
+    buf_cache.insert(12, 120);
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    
+    for (std::uint32_t i = 9; i <= 12; ++i)
+    {
+        buf_cache.lock(i);
+    }
+    
+    EXPECT_THROW(buf_cache.insert(13, 130), speed::containers::exhausted_resources_exception);
+    EXPECT_THROW(buf_cache.get_least_recently_used(),
+                 speed::containers::exhausted_resources_exception);
+}
+
+template<typename T>
+struct counting_string_allocator
+{
+    using value_type = T;
+    
+    inline static std::size_t n_allocs = 0;
+    
+    counting_string_allocator() noexcept = default;
+    
+    template<typename U>
+    counting_string_allocator(const counting_string_allocator<U>&) noexcept
+    {
+    }
+    
+    T* allocate(std::size_t n)
+    {
+        ++n_allocs;
+        return std::allocator<T>().allocate(n);
+    }
+    
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        std::allocator<T>().deallocate(ptr, n);
+    }
+    
+    template<typename U>
+    bool operator ==(const counting_string_allocator<U>&) const noexcept
+    {
+        return true;
+    }
+};
+
+using counted_string = std::basic_string<
+        char, std::char_traits<char>, counting_string_allocator<char>>;
+
+struct transparent_string_hash
+{
+    using is_transparent = void;
+    
+    std::size_t operator ()(std::string_view ky) const noexcept
+    {
+        return std::hash<std::string_view>()(ky);
+    }
+};
+
+TEST(cotainers_static_cache, transparent_lookup)
+{
+    speed::containers::static_cache<
+            counted_string,
+            std::uint32_t,
+            4,
+            transparent_string_hash,
+            std::equal_to<>
+    > buf_cache;
+    
+    buf_cache.insert(counted_string("a key too long for the small buffer 1"), 1);
+    buf_cache.insert(counted_string("a key too long for the small buffer 2"), 2);
+    buf_cache.insert(std::string_view("a key too long for the small buffer 3"), 3);
+    buf_cache.insert("a key too long for the small buffer 4", 4);
+    
+    EXPECT_THROW(buf_cache.insert("a key too long for the small buffer 1", 5),
+                 speed::containers::insertion_exception);
+    
+    counting_string_allocator<char>::n_allocs = 0;
+    
+    EXPECT_TRUE(*buf_cache.find("a key too long for the small buffer 1") == 1);
+    EXPECT_TRUE(*buf_cache.find(std::string_view("a key too long for the small buffer 2")) == 2);
+    EXPECT_TRUE(buf_cache.find("a key too long for the small buffer 9") == buf_cache.end());
+    EXPECT_TRUE(buf_cache.find(std::string_view("a missing key that is long enough")) ==
+                buf_cache.end());
+    
+    buf_cache.lock(std::string_view("a key too long for the small buffer 3"));
+    EXPECT_TRUE(*buf_cache.find_and_lock("a key too long for the small buffer 4") == 4);
+    
+    EXPECT_EQ(counting_string_allocator<char>::n_allocs, 0u);
+    
+    buf_cache.insert_and_lock(counted_string("a key too long for the small buffer 5"), 5);
+    buf_cache.insert_and_lock(counted_string("a key too long for the small buffer 6"), 6);
+    
+    EXPECT_THROW(buf_cache.insert(counted_string("a key too long for the small buffer 7"), 7),
+                 speed::containers::exhausted_resources_exception);
+    
+    buf_cache.unlock("a key too long for the small buffer 3");
+    buf_cache.insert(counted_string("a key too long for the small buffer 7"), 7);
+    
+    EXPECT_TRUE(buf_cache.find("a key too long for the small buffer 3") == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find("a key too long for the small buffer 4") == 4);
+}
+
+TEST(cotainers_static_cache, opaque_lookup)
+{
+    speed::containers::static_cache<std::string, std::uint32_t, 4> buf_cache;
+    
+    buf_cache.insert("one", 1);
+    buf_cache.insert(std::string("two"), 2);
+    
+    EXPECT_TRUE(*buf_cache.find("one") == 1);
+    EXPECT_TRUE(*buf_cache.find(std::string("two")) == 2);
+    EXPECT_TRUE(buf_cache.find("three") == buf_cache.end());
+    
+    auto it = buf_cache.find("one");
+    buf_cache.lock(it);
+    buf_cache.unlock(it);
+}
+
+TEST(cotainers_static_cache, find_batch)
+{
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 64> buf_cache;
+    std::array<std::uint32_t, 40> kys;
+    std::array<decltype(buf_cache)::iterator, 40> its;
+    
+    for (std::uint32_t i = 0; i < 32; ++i)
+    {
+        buf_cache.insert(i * 3, i);
+    }
+    
+    for (std::uint32_t i = 0; i < kys.size(); ++i)
+    {
+        kys[i] = i * 2;
+    }
+    
+    buf_cache.find_batch(kys, its);
+    
+    for (std::uint32_t i = 0; i < kys.size(); ++i)
+    {
+        EXPECT_TRUE(its[i] == buf_cache.find(kys[i]));
+    }
+    
+    EXPECT_TRUE(*its[3] == 2);
+    EXPECT_TRUE(its[1] == buf_cache.end());
+}
+
+TEST(cotainers_static_cache, insert_batch)
+{
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 32> buf_cache;
+    std::array<std::uint32_t, 20> kys;
+    std::array<std::uint32_t, 20> vals;
+    
+    for (std::uint32_t i = 0; i < kys.size(); ++i)
+    {
+        kys[i] = i;
+        vals[i] = i * 10;
+    }
+    
+    buf_cache.insert_batch(kys, vals);
+    
+    for (std::uint32_t i = 0; i < kys.size(); ++i)
+    {
+        EXPECT_TRUE(*buf_cache.find(i) == i * 10);
+    }
+    
+    kys[0] = 100;
+    kys[1] = 5;
+    
+    EXPECT_THROW(buf_cache.insert_batch(std::span(kys).first(2), std::span(vals).first(2)),
+                 speed::containers::insertion_exception);
+    EXPECT_TRUE(*buf_cache.find(100) == 0);
+    EXPECT_TRUE(*buf_cache.find(5) == 50);
+}
+
+namespace {
+
+struct live_value
+{
+    static inline std::size_t n_lives = 0;
+    
+    live_value(std::uint32_t val, bool thrw)
+            : val_(val)
+    {
+        if (thrw)
+        {
+            throw std::runtime_error("construction failed");
+        }
+        
+        ++n_lives;
+    }
+    
+    live_value(const live_value& rhs)
+            : val_(rhs.val_)
+    {
+        ++n_lives;
+    }
+    
+    ~live_value()
+    {
+        --n_lives;
+    }
+    
+    std::uint32_t val_;
+};
+
+}
+
+TEST(cotainers_static_cache, try_emplace)
+{
+    speed::containers::static_cache<std::uint32_t, live_value, 4> buf_cache;
+    
+    auto [it, insrtd] = buf_cache.try_emplace(1, 10, false);
+    
+    EXPECT_TRUE(insrtd);
+    EXPECT_EQ(it->val_, 10u);
+    EXPECT_EQ(live_value::n_lives, 1u);
+    
+    std::tie(it, insrtd) = buf_cache.try_emplace(1, 20, true);
+    
+    EXPECT_FALSE(insrtd);
+    EXPECT_EQ(it->val_, 10u);
+    EXPECT_EQ(live_value::n_lives, 1u);
+    
+    buf_cache.insert(2, live_value(20, false));
+    
+    EXPECT_EQ(live_value::n_lives, 2u);
+    EXPECT_THROW(buf_cache.insert(2, live_value(30, false)),
+                 speed::containers::insertion_exception);
+    EXPECT_EQ(live_value::n_lives, 2u);
+}
+
+TEST(cotainers_static_cache, value_lifetime)
+{
+    {
+        speed::containers::static_cache<std::uint32_t, live_value, 4> buf_cache;
+        
+        for (std::uint32_t i = 0; i < 100; ++i)
+        {
+            buf_cache.try_emplace(i, i, false);
+            
+            EXPECT_EQ(live_value::n_lives, std::min<std::size_t>(i + 1, 4));
+        }
+        
+        EXPECT_THROW(buf_cache.try_emplace(100, 100, true), std::runtime_error);
+        EXPECT_EQ(live_value::n_lives, 3u);
+        EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+        EXPECT_THROW(buf_cache.get_least_recently_used(),
+                     speed::containers::empty_container_exception);
+        EXPECT_TRUE(buf_cache.find(96) == buf_cache.end());
+        EXPECT_EQ(buf_cache.find(99)->val_, 99u);
+        
+        buf_cache.try_emplace(100, 100, false);
+        buf_cache.try_emplace(101, 101, false);
+        
+        EXPECT_EQ(live_value::n_lives, 4u);
+        EXPECT_TRUE(buf_cache.find(97) == buf_cache.end());
+        EXPECT_EQ(buf_cache.find(98)->val_, 98u);
+    }
+    
+    EXPECT_EQ(live_value::n_lives, 0u);
+}
+
+TEST(cotainers_static_cache, snapshot)
+{
+    const std::filesystem::path snpsht_pth =
+            std::filesystem::temp_directory_path() / "speed_static_cache_snapshot.bin";
+    speed::containers::static_cache<std::uint32_t, std::uint64_t, 4> src_cache;
+    speed::containers::static_cache<std::uint32_t, std::uint64_t, 4> dest_cache;
+    
+    for (std::uint32_t i = 1; i <= 4; ++i)
+    {
+        src_cache.insert(i, i * 10);
+    }
+    
+    src_cache.find(1);
+    src_cache.lock(2);
+    
+    ASSERT_TRUE(src_cache.save_snapshot(snpsht_pth));
+    EXPECT_EQ(src_cache.get_least_recently_used(), 30u);
+    ASSERT_TRUE(dest_cache.load_snapshot(snpsht_pth));
+    EXPECT_EQ(dest_cache.get_least_recently_used(), 30u);
+    
+    dest_cache.insert(11, 0);
+    
+    EXPECT_EQ(dest_cache.get_least_recently_used(), 40u);
+    
+    dest_cache.insert(12, 0);
+    
+    EXPECT_EQ(dest_cache.get_least_recently_used(), 10u);
+    EXPECT_TRUE(*dest_cache.find(1) == 10);
+    EXPECT_TRUE(*dest_cache.find(2) == 20);
+    EXPECT_TRUE(dest_cache.find(3) == dest_cache.end());
+    
+    std::filesystem::remove(snpsht_pth);
+}
+
+TEST(cotainers_static_cache, snapshot_order)
+{
+    const std::filesystem::path snpsht_pth =
+            std::filesystem::temp_directory_path() / "speed_static_cache_snapshot_order.bin";
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 8> src_cache;
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 8> dest_cache;
+    
+    for (std::uint32_t i = 0; i < 6; ++i)
+    {
+        src_cache.insert(i, i);
+    }
+    
+    src_cache.find(0);
+    src_cache.find(2);
+    
+    ASSERT_TRUE(src_cache.save_snapshot(snpsht_pth));
+    ASSERT_TRUE(dest_cache.load_snapshot(snpsht_pth));
+    
+    for (std::uint32_t i = 100; i < 102; ++i)
+    {
+        src_cache.insert(i, i);
+        dest_cache.insert(i, i);
+    }
+    
+    for (std::uint32_t i = 102; i < 106; ++i)
+    {
+        src_cache.insert(i, i);
+        dest_cache.insert(i, i);
+        
+        for (std::uint32_t j = 0; j < 6; ++j)
+        {
+            EXPECT_EQ(src_cache.find(j) == src_cache.end(), dest_cache.find(j) == dest_cache.end());
+        }
+    }
+    
+    std::filesystem::remove(snpsht_pth);
+}
+
+TEST(cotainers_static_cache, snapshot_validation)
+{
+    const std::filesystem::path snpsht_pth =
+            std::filesystem::temp_directory_path() / "speed_static_cache_snapshot_invalid.bin";
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 4> src_cache;
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 4> dest_cache;
+    speed::containers::static_cache<std::uint32_t, float, 4> float_cache;
+    speed::containers::static_cache<std::uint32_t, std::uint64_t, 4> wide_cache;
+    
+    src_cache.insert(1, 10);
+    src_cache.insert(2, 20);
+    
+    EXPECT_FALSE(dest_cache.load_snapshot(snpsht_pth));
+    ASSERT_TRUE(src_cache.save_snapshot(snpsht_pth));
+    EXPECT_FALSE(float_cache.load_snapshot(snpsht_pth));
+    EXPECT_FALSE(wide_cache.load_snapshot(snpsht_pth));
+    
+    const auto fl_sz = std::filesystem::file_size(snpsht_pth);
+    
+    {
+        std::fstream fs(snpsht_pth, std::ios::binary | std::ios::in | std::ios::out);
+        
+        fs.seekp(static_cast<std::streamoff>(fl_sz - 1));
+        fs.put('\x7F');
+    }
+    
+    EXPECT_FALSE(dest_cache.load_snapshot(snpsht_pth));
+    
+    std::filesystem::resize_file(snpsht_pth, fl_sz - 4);
+    
+    EXPECT_FALSE(dest_cache.load_snapshot(snpsht_pth));
+    EXPECT_TRUE(dest_cache.begin() == dest_cache.end());
+    EXPECT_TRUE(dest_cache.is_least_recently_used_free());
+    
+    std::filesystem::remove(snpsht_pth);
+}
@@ -0,0 +1,225 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        statistics_policy_test.cpp
+ * @brief       statistics policies unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+struct constant_hash
+{
+    std::size_t operator ()(std::uint32_t ky) const noexcept
+    {
+        (void)ky;
+        return 0;
+    }
+};
+
+struct size_weigher
+{
+    std::size_t operator ()(std::uint32_t ky, const std::string& val) const noexcept
+    {
+        (void)ky;
+        return val.size();
+    }
+};
+
+template<std::size_t SIZE, typename HashT = std::hash<std::uint32_t>>
+using cache_type = speed::containers::static_cache<
+        std::uint32_t,
+        std::uint32_t,
+        SIZE,
+        HashT,
+        std::equal_to<std::uint32_t>,
+        speed::containers::lru_eviction_policy,
+        speed::containers::sharded_statistics_policy
+>;
+
+std::uint64_t count_probes(const speed::containers::cache_statistics& stats)
+{
+    return std::accumulate(stats.prb_lens_.begin(), stats.prb_lens_.end(), std::uint64_t(0));
+}
+
+}
+
+TEST(containers_statistics_policy, disabled)
+{
+    speed::containers::static_cache<std::uint32_t, std::uint32_t, 4> buf_cache;
+    
+    EXPECT_TRUE(std::is_empty_v<speed::containers::no_statistics_policy>);
+    
+    buf_cache.insert(1, 10);
+    buf_cache.find(1);
+    buf_cache.find(2);
+    
+    auto stats = buf_cache.get_statistics();
+    
+    EXPECT_EQ(stats.n_hits_, 0u);
+    EXPECT_EQ(stats.n_misses_, 0u);
+    EXPECT_EQ(stats.n_inserts_, 0u);
+    EXPECT_EQ(count_probes(stats), 0u);
+}
+
+TEST(containers_statistics_policy, counters)
+{
+    cache_type<4> buf_cache;
+    
+    for (std::uint32_t i = 0; i < 6; ++i)
+    {
+        buf_cache.insert(i, i * 10);
+    }
+    
+    buf_cache.find(5);
+    buf_cache.find(4);
+    buf_cache.find(0);
+    buf_cache.lock(2);
+    buf_cache.lock(3);
+    buf_cache.unlock(3);
+    
+    auto stats = buf_cache.get_statistics();
+    
+    EXPECT_EQ(stats.n_hits_, 5u);
+    EXPECT_EQ(stats.n_misses_, 1u);
+    EXPECT_EQ(stats.n_inserts_, 6u);
+    EXPECT_EQ(stats.n_evictions_, 2u);
+    EXPECT_EQ(stats.n_locks_, 2u);
+    EXPECT_EQ(stats.n_unlocks_, 1u);
+    EXPECT_EQ(stats.n_exhausted_, 0u);
+    EXPECT_EQ(count_probes(stats), 12u);
+    
+    buf_cache.lock(3);
+    buf_cache.lock(4);
+    buf_cache.lock(5);
+    
+    EXPECT_THROW(buf_cache.insert(6, 60), speed::containers::exhausted_resources_exception);
+    EXPECT_EQ(buf_cache.get_statistics().n_exhausted_, 1u);
+}
+
+TEST(containers_statistics_policy, probe_lengths)
+{
+    cache_type<8, constant_hash> buf_cache;
+    
+    for (std::uint32_t i = 0; i < 4; ++i)
+    {
+        buf_cache.insert(i, i);
+    }
+    
+    auto stats = buf_cache.get_statistics();
+    
+    EXPECT_EQ(stats.prb_lens_[0], 1u);
+    EXPECT_EQ(stats.prb_lens_[1], 1u);
+    EXPECT_EQ(stats.prb_lens_[2], 1u);
+    EXPECT_EQ(stats.prb_lens_[3], 1u);
+    
+    buf_cache.find(2);
+    buf_cache.find(100);
+    
+    stats = buf_cache.get_statistics();
+    
+    EXPECT_EQ(stats.prb_lens_[3], 2u);
+    EXPECT_EQ(stats.prb_lens_[4], 1u);
+}
+
+TEST(containers_statistics_policy, weighted_evictions)
+{
+    speed::containers::weighted_static_cache<
+            std::uint32_t,
+            std::string,
+            8,
+            size_weigher,
+            std::hash<std::uint32_t>,
+            std::equal_to<std::uint32_t>,
+            speed::containers::lru_eviction_policy,
+            speed::containers::sharded_statistics_policy
+    > buf_cache(10);
+    
+    buf_cache.insert(1, "aaaa");
+    buf_cache.insert(2, "bbbb");
+    buf_cache.insert(3, "cccccccc");
+    
+    EXPECT_THROW(buf_cache.insert(4, "ddddddddddd"),
+                 speed::containers::exhausted_resources_exception);
+    
+    auto stats = buf_cache.get_statistics();
+    
+    EXPECT_EQ(stats.n_inserts_, 3u);
+    EXPECT_EQ(stats.n_evictions_, 2u);
+    EXPECT_EQ(stats.n_exhausted_, 1u);
+}
+
+TEST(containers_statistics_policy, concurrent)
+{
+    constexpr std::size_t N_THREADS = 4;
+    constexpr std::uint32_t N_LOOKUPS = 10000;
+    
+    speed::containers::concurrent_static_cache<
+            std::uint32_t,
+            std::uint32_t,
+            256,
+            16,
+            std::hash<std::uint32_t>,
+            std::equal_to<std::uint32_t>,
+            speed::containers::clock_eviction_policy,
+            speed::containers::sharded_statistics_policy
+    > buf_cache;
+    std::vector<std::thread> thrds;
+    
+    for (std::uint32_t i = 0; i < 64; ++i)
+    {
+        buf_cache.insert(i, i);
+    }
+    
+    for (std::size_t i = 0; i < N_THREADS; ++i)
+    {
+        thrds.emplace_back([&buf_cache]()
+        {
+            std::uint32_t val;
+            
+            for (std::uint32_t j = 0; j < N_LOOKUPS; ++j)
+            {
+                buf_cache.find(j % 128, val);
+            }
+        });
+    }
+    
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+    
+    auto stats = buf_cache.get_statistics();
+    
+    EXPECT_EQ(stats.n_hits_ + stats.n_misses_, N_THREADS * N_LOOKUPS);
+    EXPECT_EQ(stats.n_inserts_, 64u);
+}
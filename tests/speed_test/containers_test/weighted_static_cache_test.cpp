@@ -0,0 +1,277 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        weighted_static_cache_test.cpp
+ * @brief       weighted_static_cache unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/containers/containers.hpp"
+
+namespace {
+
+struct size_weigher
+{
+    std::size_t operator ()(std::uint32_t ky, const std::string& val) const noexcept
+    {
+        (void)ky;
+        return val.size();
+    }
+};
+
+template<
+        std::size_t SIZE,
+        template<typename> class EvictionPolicyT = speed::containers::lru_eviction_policy
+>
+using cache_type = speed::containers::weighted_static_cache<
+        std::uint32_t,
+        std::string,
+        SIZE,
+        size_weigher,
+        std::hash<std::uint32_t>,
+        std::equal_to<std::uint32_t>,
+        EvictionPolicyT
+>;
+
+struct throwing_value
+{
+    static inline bool thrw_on_move = false;
+    
+    static inline std::size_t n_lives = 0;
+    
+    explicit throwing_value(std::size_t wght)
+            : wght_(wght)
+    {
+        ++n_lives;
+    }
+    
+    throwing_value(throwing_value&& rhs)
+            : wght_(rhs.wght_)
+    {
+        if (thrw_on_move)
+        {
+            throw std::runtime_error("move failed");
+        }
+        
+        ++n_lives;
+    }
+    
+    ~throwing_value()
+    {
+        --n_lives;
+    }
+    
+    std::size_t wght_;
+};
+
+struct value_weigher
+{
+    std::size_t operator ()(std::uint32_t ky, const throwing_value& val) const noexcept
+    {
+        (void)ky;
+        return val.wght_;
+    }
+};
+
+template<typename CacheT>
+std::size_t sum_weights(CacheT& buf_cache)
+{
+    std::size_t wght = 0;
+    
+    for (auto it = buf_cache.begin(); it != buf_cache.end(); ++it)
+    {
+        wght += it->size();
+    }
+    
+    return wght;
+}
+
+}
+
+TEST(containers_weighted_static_cache, insert)
+{
+    cache_type<16> buf_cache(100);
+    
+    EXPECT_EQ(buf_cache.get_max_weight(), 100u);
+    EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+    EXPECT_THROW(buf_cache.get_least_recently_used(),
+                 speed::containers::exhausted_resources_exception);
+    
+    buf_cache.insert(1, std::string(40, 'a'));
+    buf_cache.insert(2, std::string(40, 'b'));
+    
+    EXPECT_EQ(buf_cache.get_total_weight(), 80u);
+    EXPECT_TRUE(buf_cache.get_least_recently_used() == std::string(40, 'a'));
+    EXPECT_THROW(buf_cache.insert(2, "c"), speed::containers::insertion_exception);
+    
+    buf_cache.insert(3, std::string(30, 'c'));
+    
+    EXPECT_EQ(buf_cache.get_total_weight(), 70u);
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(2) == std::string(40, 'b'));
+    
+    buf_cache.insert(4, std::string(100, 'd'));
+    
+    EXPECT_EQ(buf_cache.get_total_weight(), 100u);
+    EXPECT_EQ(sum_weights(buf_cache), 100u);
+    EXPECT_TRUE(buf_cache.is_least_recently_used_free());
+    EXPECT_THROW(buf_cache.insert(5, std::string(101, 'e')),
+                 speed::containers::exhausted_resources_exception);
+    EXPECT_TRUE(*buf_cache.find(4) == std::string(100, 'd'));
+}
+
+TEST(containers_weighted_static_cache, size_bound)
+{
+    cache_type<4> buf_cache(1000);
+    
+    for (std::uint32_t i = 0; i < 4; ++i)
+    {
+        buf_cache.insert(i, "x");
+    }
+    
+    EXPECT_FALSE(buf_cache.is_least_recently_used_free());
+    
+    buf_cache.insert(4, "y");
+    
+    EXPECT_TRUE(buf_cache.find(0) == buf_cache.end());
+    EXPECT_EQ(buf_cache.get_total_weight(), 4u);
+}
+
+TEST(containers_weighted_static_cache, lock)
+{
+    cache_type<8> buf_cache(100);
+    
+    buf_cache.insert_and_lock(1, std::string(60, 'a'));
+    buf_cache.insert(2, std::string(30, 'b'));
+    
+    EXPECT_THROW(buf_cache.insert(3, std::string(50, 'c')),
+                 speed::containers::exhausted_resources_exception);
+    EXPECT_EQ(buf_cache.get_total_weight(), 60u);
+    EXPECT_TRUE(buf_cache.find(2) == buf_cache.end());
+    
+    buf_cache.insert(3, std::string(40, 'c'));
+    buf_cache.unlock(1);
+    buf_cache.insert(4, std::string(50, 'd'));
+    
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(buf_cache.find(3) == buf_cache.end());
+    EXPECT_EQ(buf_cache.get_total_weight(), 50u);
+}
+
+TEST(containers_weighted_static_cache, eviction_policies)
+{
+    auto expect_consistent = []<template<typename> class EvictionPolicyT>()
+    {
+        cache_type<64, EvictionPolicyT> buf_cache(1000);
+        std::uint32_t seed = 2463534242;
+        
+        for (std::uint32_t i = 0; i < 20000; ++i)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            
+            const std::uint32_t ky = seed % 200;
+            
+            if (buf_cache.find(ky).end())
+            {
+                buf_cache.insert(ky, std::string((seed >> 8) % 120, 'x'));
+            }
+            
+            EXPECT_LE(buf_cache.get_total_weight(), 1000u);
+        }
+        
+        EXPECT_EQ(buf_cache.get_total_weight(), sum_weights(buf_cache));
+        EXPECT_GT(buf_cache.get_total_weight(), 800u);
+    };
+    
+    expect_consistent.operator()<speed::containers::lru_eviction_policy>();
+    expect_consistent.operator()<speed::containers::clock_eviction_policy>();
+    expect_consistent.operator()<speed::containers::w_tinylfu_eviction_policy>();
+    expect_consistent.operator()<speed::containers::arc_eviction_policy>();
+    expect_consistent.operator()<speed::containers::s3_fifo_eviction_policy>();
+}
+
+TEST(containers_weighted_static_cache, insert_batch)
+{
+    cache_type<16> buf_cache(30);
+    std::vector<std::uint32_t> kys = {1, 2, 3, 4};
+    std::vector<std::string> vals = {"0123456789", "0123456789", "0123456789", "0123456789"};
+    
+    buf_cache.insert_batch(kys, vals);
+    
+    EXPECT_EQ(buf_cache.get_total_weight(), 30u);
+    EXPECT_EQ(sum_weights(buf_cache), 30u);
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(4) == "0123456789");
+}
+
+TEST(containers_weighted_static_cache, try_emplace)
+{
+    cache_type<16> buf_cache(30);
+    
+    EXPECT_TRUE(buf_cache.try_emplace(1, 20, 'a').second);
+    EXPECT_FALSE(buf_cache.try_emplace(1, 5, 'b').second);
+    EXPECT_TRUE(buf_cache.try_emplace(2, 15, 'c').second);
+    
+    EXPECT_EQ(buf_cache.get_total_weight(), 15u);
+    EXPECT_TRUE(buf_cache.find(1) == buf_cache.end());
+    EXPECT_TRUE(*buf_cache.find(2) == std::string(15, 'c'));
+}
+
+TEST(containers_weighted_static_cache, throwing_value)
+{
+    {
+        speed::containers::weighted_static_cache<
+                std::uint32_t, throwing_value, 4, value_weigher> buf_cache(6);
+        
+        buf_cache.try_emplace(1, 3);
+        buf_cache.try_emplace(2, 3);
+        
+        throwing_value::thrw_on_move = true;
+        
+        EXPECT_THROW(buf_cache.try_emplace(3, 3), std::runtime_error);
+        
+        throwing_value::thrw_on_move = false;
+        
+        EXPECT_EQ(buf_cache.get_total_weight(), 3u);
+        EXPECT_EQ(buf_cache.find(3), buf_cache.end());
+        EXPECT_EQ(throwing_value::n_lives, 1u);
+        
+        for (std::uint32_t i = 4; i < 20; ++i)
+        {
+            buf_cache.try_emplace(i, 5);
+            
+            EXPECT_EQ(buf_cache.get_total_weight(), 5u);
+            EXPECT_NE(buf_cache.find(i), buf_cache.end());
+            EXPECT_EQ(throwing_value::n_lives, 1u);
+        }
+    }
+    
+    EXPECT_EQ(throwing_value::n_lives, 0u);
+}
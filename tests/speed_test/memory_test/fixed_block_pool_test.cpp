@@ -0,0 +1,93 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        fixed_block_pool_test.cpp
+ * @brief       fixed_block_pool unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <list>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/memory/memory.hpp"
+
+TEST(memory_fixed_block_pool, allocate)
+{
+    speed::memory::fixed_block_pool pool(24, 4, 32);
+    std::vector<void*> ptrs;
+    
+    EXPECT_EQ(pool.get_block_size(), 32U);
+    
+    for (int i = 0; i < 10; ++i)
+    {
+        ptrs.push_back(pool.allocate());
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptrs.back()) % 32, 0U);
+    }
+    
+    EXPECT_EQ(pool.get_chunk_count(), 3U);
+    EXPECT_EQ(static_cast<char*>(ptrs[1]) - static_cast<char*>(ptrs[0]), 32);
+    
+    void* lst = ptrs.back();
+    
+    pool.deallocate(lst);
+    EXPECT_EQ(pool.allocate(), lst);
+    
+    pool.release();
+    EXPECT_EQ(pool.get_chunk_count(), 0U);
+}
+
+TEST(memory_fixed_block_pool, allocator)
+{
+    speed::memory::fixed_block_pool pool(64, 128);
+    
+    {
+        speed::memory::resource_scope<speed::memory::fixed_block_pool> scp(pool);
+        std::list<int, speed::memory::pool_allocator<int>> lst;
+        std::set<int, std::less<>, speed::memory::pool_allocator<int>> st;
+        std::vector<int, speed::memory::pool_allocator<int>> vec(1000, 1);
+        
+        for (int i = 0; i < 200; ++i)
+        {
+            lst.push_back(i);
+            st.insert(i);
+        }
+        
+        EXPECT_EQ(lst.get_allocator().get_pool(), &pool);
+        EXPECT_EQ(pool.get_chunk_count(), 4U);
+        
+        lst.clear();
+        
+        for (int i = 0; i < 200; ++i)
+        {
+            lst.push_back(i);
+        }
+        
+        EXPECT_EQ(pool.get_chunk_count(), 4U);
+        EXPECT_EQ(st.size(), 200U);
+        EXPECT_EQ(vec[999], 1);
+    }
+    
+    EXPECT_EQ(speed::memory::pool_allocator<int>().get_pool(), nullptr);
+}
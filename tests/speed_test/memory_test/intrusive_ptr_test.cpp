@@ -0,0 +1,125 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        intrusive_ptr_test.cpp
+ * @brief       intrusive_ptr unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/memory/memory.hpp"
+
+namespace {
+
+int n_destroyed = 0;
+
+struct node : speed::memory::ref_counted<node, speed::memory::pool_allocator<node>>
+{
+    explicit node(int val)
+            : val_(val)
+    {
+    }
+    
+    ~node()
+    {
+        ++n_destroyed;
+    }
+    
+    int val_;
+};
+
+struct shared_node : speed::memory::ref_counted<shared_node>
+{
+    int val_ = 0;
+};
+
+}
+
+TEST(memory_intrusive_ptr, make_intrusive)
+{
+    speed::memory::fixed_block_pool pool(sizeof(node), 8);
+    speed::memory::pool_allocator<node> alloc(pool);
+    
+    n_destroyed = 0;
+    
+    {
+        auto ptr1 = speed::memory::make_intrusive<node>(alloc, 4);
+        
+        EXPECT_EQ(sizeof(ptr1), sizeof(node*));
+        EXPECT_EQ(ptr1->get_reference_count(), 1U);
+        EXPECT_EQ(pool.get_chunk_count(), 1U);
+        
+        auto ptr2 = ptr1;
+        EXPECT_EQ(ptr1->get_reference_count(), 2U);
+        EXPECT_TRUE(ptr1 == ptr2);
+        
+        auto ptr3 = std::move(ptr2);
+        EXPECT_FALSE(ptr2);
+        EXPECT_EQ(ptr3->val_, 4);
+        EXPECT_EQ(ptr1->get_reference_count(), 2U);
+        
+        ptr3.reset();
+        EXPECT_EQ(ptr1->get_reference_count(), 1U);
+        EXPECT_EQ(n_destroyed, 0);
+    }
+    
+    EXPECT_EQ(n_destroyed, 1);
+}
+
+TEST(memory_intrusive_ptr, detach)
+{
+    auto ptr1 = speed::memory::make_intrusive<shared_node>(std::allocator<int>());
+    shared_node* raw = ptr1.detach();
+    
+    EXPECT_FALSE(ptr1);
+    EXPECT_EQ(raw->get_reference_count(), 1U);
+    
+    speed::memory::intrusive_ptr<shared_node> ptr2(raw, false);
+    
+    EXPECT_EQ(ptr2->get_reference_count(), 1U);
+}
+
+TEST(memory_intrusive_ptr, threads)
+{
+    auto ptr = speed::memory::make_intrusive<shared_node>(std::allocator<int>());
+    std::vector<std::thread> thrds;
+    
+    for (int i = 0; i < 4; ++i)
+    {
+        thrds.emplace_back([ptr]() {
+            for (int j = 0; j < 10000; ++j)
+            {
+                speed::memory::intrusive_ptr<shared_node> cpy = ptr;
+            }
+        });
+    }
+    
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+    
+    EXPECT_EQ(ptr->get_reference_count(), 1U);
+}
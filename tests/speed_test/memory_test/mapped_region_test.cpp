@@ -0,0 +1,101 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        mapped_region_test.cpp
+ * @brief       mapped_region unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/memory/memory.hpp"
+
+TEST(memory_mapped_region, map)
+{
+    using speed::memory::mf_t;
+    
+    const std::size_t pg_sz = speed::memory::mapped_region::get_base_page_size();
+    const std::size_t hpg_sz = speed::memory::mapped_region::get_huge_page_size();
+    speed::memory::mapped_region reg(100, mf_t::NIL);
+    
+    EXPECT_NE(reg.get_data(), nullptr);
+    EXPECT_EQ(reg.get_size(), pg_sz);
+    EXPECT_EQ(reg.get_page_size(), pg_sz);
+    EXPECT_FALSE(reg.has_transparent_huge_pages());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(reg.get_data()) % pg_sz, 0U);
+    EXPECT_GE(hpg_sz, pg_sz);
+    
+    std::memset(reg.get_data(), 0xFF, reg.get_size());
+}
+
+TEST(memory_mapped_region, transparent_huge_pages)
+{
+    using speed::memory::mf_t;
+    
+    const std::size_t hpg_sz = speed::memory::mapped_region::get_huge_page_size();
+    speed::memory::mapped_region reg(hpg_sz + 1, mf_t::TRANSPARENT_HUGE_PAGES | mf_t::POPULATE);
+    
+    EXPECT_EQ(reg.get_size(), 2 * hpg_sz);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(reg.get_data()) % hpg_sz, 0U);
+    
+    static_cast<char*>(reg.get_data())[reg.get_size() - 1] = 1;
+    
+    speed::memory::mapped_region moved_reg = std::move(reg);
+    
+    EXPECT_EQ(reg.get_data(), nullptr);
+    EXPECT_EQ(reg.get_size(), 0U);
+    EXPECT_EQ(static_cast<char*>(moved_reg.get_data())[moved_reg.get_size() - 1], 1);
+}
+
+TEST(memory_mapped_region, explicit_huge_pages)
+{
+    using speed::memory::mf_t;
+    
+    const std::size_t pg_sz = speed::memory::mapped_region::get_base_page_size();
+    const std::size_t hpg_sz = speed::memory::mapped_region::get_huge_page_size();
+    speed::memory::mapped_region reg(pg_sz, mf_t::EXPLICIT_HUGE_PAGES);
+    
+    EXPECT_EQ(reg.get_size(), hpg_sz);
+    EXPECT_TRUE(reg.get_page_size() == hpg_sz || reg.get_page_size() == pg_sz);
+    
+    std::memset(reg.get_data(), 0, reg.get_size());
+}
+
+TEST(memory_mapped_region, large_allocator)
+{
+    using speed::memory::mf_t;
+    
+    std::vector<std::uint64_t, speed::memory::large_allocator<std::uint64_t>> vec;
+    
+    for (std::uint64_t i = 0; i < 1 << 20; ++i)
+    {
+        vec.push_back(i);
+    }
+    
+    EXPECT_EQ(vec[(1 << 20) - 1], (1U << 20) - 1);
+    EXPECT_EQ(vec.get_allocator().get_flags(), mf_t::DEFAULT_MAPPING_FLAGS);
+    EXPECT_FALSE(speed::memory::large_allocator<int>(mf_t::POPULATE) ==
+                 speed::memory::large_allocator<int>());
+}
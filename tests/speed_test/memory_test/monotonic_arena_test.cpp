@@ -0,0 +1,155 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        monotonic_arena_test.cpp
+ * @brief       monotonic_arena unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/memory/memory.hpp"
+
+TEST(memory_monotonic_arena, allocate)
+{
+    speed::memory::monotonic_arena arna(256);
+    
+    auto* ptr1 = static_cast<std::byte*>(arna.allocate(10, 1));
+    auto* ptr2 = static_cast<std::byte*>(arna.allocate(8, 64));
+    
+    EXPECT_EQ(arna.get_block_count(), 1U);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr2) % 64, 0U);
+    EXPECT_GE(ptr2, ptr1 + 10);
+    
+    EXPECT_NE(arna.allocate(1000, 8), nullptr);
+    EXPECT_EQ(arna.get_block_count(), 2U);
+    
+    arna.release();
+    EXPECT_EQ(arna.get_block_count(), 0U);
+    EXPECT_EQ(arna.get_remaining_size(), 0U);
+}
+
+TEST(memory_monotonic_arena, stack_buffer)
+{
+    alignas(std::max_align_t) std::array<std::byte, 512> buf;
+    speed::memory::monotonic_arena arna(buf.data(), buf.size());
+    
+    void* ptr = arna.allocate(100);
+    
+    EXPECT_EQ(ptr, buf.data());
+    EXPECT_EQ(arna.get_block_count(), 0U);
+    
+    arna.deallocate(ptr, 100);
+    EXPECT_EQ(arna.get_remaining_size(), buf.size());
+    EXPECT_EQ(arna.allocate(100), ptr);
+    
+    EXPECT_NE(arna.allocate(1000), nullptr);
+    EXPECT_EQ(arna.get_block_count(), 1U);
+    
+    arna.release();
+    EXPECT_EQ(arna.get_remaining_size(), buf.size());
+}
+
+TEST(memory_monotonic_arena, padding_past_the_end)
+{
+    alignas(16) std::array<std::byte, 16> buf;
+    speed::memory::monotonic_arena arna(buf.data(), 13);
+    
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(arna.allocate(1, 1), buf.data() + i);
+    }
+    
+    auto* ptr = static_cast<std::byte*>(arna.allocate(4, 8));
+    
+    EXPECT_EQ(arna.get_block_count(), 1U);
+    EXPECT_TRUE(ptr < buf.data() || ptr >= buf.data() + buf.size());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 8, 0U);
+    EXPECT_LT(arna.get_remaining_size(), speed::memory::monotonic_arena::DEFAULT_BLOCK_SIZE);
+    
+    for (std::size_t sz = 1; sz < 200; sz += 7)
+    {
+        auto* cur = static_cast<std::byte*>(arna.allocate(sz, 1));
+        auto* algnd = static_cast<std::byte*>(arna.allocate(8, 16));
+        
+        EXPECT_NE(cur, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(algnd) % 16, 0U);
+        EXPECT_LT(arna.get_remaining_size(), SIZE_MAX / 2);
+    }
+}
+
+TEST(memory_monotonic_arena, allocator)
+{
+    using string_type = std::basic_string<char, std::char_traits<char>,
+                                          speed::memory::monotonic_allocator<char>>;
+    
+    alignas(std::max_align_t) std::array<std::byte, 4096> buf;
+    speed::memory::monotonic_arena arna(buf.data(), buf.size());
+    speed::memory::monotonic_allocator<int> alloc(arna);
+    std::vector<int, speed::memory::monotonic_allocator<int>> vec(alloc);
+    
+    for (int i = 0; i < 100; ++i)
+    {
+        vec.push_back(i);
+    }
+    
+    EXPECT_EQ(vec[99], 99);
+    EXPECT_EQ(vec.get_allocator(), alloc);
+    EXPECT_LT(arna.get_remaining_size(), buf.size());
+    
+    {
+        speed::memory::resource_scope<speed::memory::monotonic_arena> scp(arna);
+        std::map<int, string_type, std::less<>,
+                 speed::memory::monotonic_allocator<std::pair<const int, string_type>>> mp;
+        
+        EXPECT_EQ(mp.get_allocator().get_arena(), &arna);
+        
+        for (int i = 0; i < 50; ++i)
+        {
+            mp.emplace(i, string_type("a string too long for the small string buffer"));
+        }
+        
+        EXPECT_EQ(mp.at(10).size(), 45U);
+    }
+    
+    EXPECT_EQ(speed::memory::monotonic_allocator<int>().get_arena(), nullptr);
+    EXPECT_NE(speed::memory::monotonic_allocator<int>(), alloc);
+}
+
+TEST(memory_monotonic_arena, without_arena)
+{
+    std::vector<std::uint64_t, speed::memory::monotonic_allocator<std::uint64_t>> vec;
+    
+    for (std::uint64_t i = 0; i < 1000; ++i)
+    {
+        vec.push_back(i);
+    }
+    
+    EXPECT_EQ(vec.get_allocator().get_arena(), nullptr);
+    EXPECT_EQ(vec[999], 999U);
+}
@@ -0,0 +1,109 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        operations_test.cpp
+ * @brief       memory operations unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "speed/memory/memory.hpp"
+
+namespace {
+
+struct base
+{
+    virtual ~base() = default;
+    
+    int val_ = 0;
+};
+
+struct derived : base
+{
+    explicit derived(int val)
+    {
+        val_ = val;
+    }
+    
+    char pad_[200] = {};
+};
+
+}
+
+TEST(memory_operations, allocate_unique)
+{
+    using deleter_type = speed::memory::allocator_delete<int, std::allocator<int>>;
+    
+    auto ptr = speed::memory::allocate_unique<int>(std::allocator<char>(), 7);
+    
+    EXPECT_EQ(*ptr, 7);
+    EXPECT_TRUE((std::is_same_v<decltype(ptr)::deleter_type, deleter_type>));
+    EXPECT_EQ(sizeof(deleter_type), sizeof(void*));
+}
+
+TEST(memory_operations, allocate_unique_derived)
+{
+    speed::memory::fixed_block_pool pool(sizeof(derived), 4);
+    speed::memory::pool_allocator<base> alloc(pool);
+    using deleter_type = speed::memory::allocator_delete<base, decltype(alloc)>;
+    
+    std::unique_ptr<base, deleter_type> ptr = speed::memory::allocate_unique<derived>(alloc, 3);
+    
+    EXPECT_EQ(ptr->val_, 3);
+    EXPECT_EQ(pool.get_chunk_count(), 1U);
+    
+    base* raw = ptr.get();
+    
+    ptr.reset();
+    EXPECT_EQ(speed::memory::allocate_unique<derived>(alloc, 4).get(), raw);
+}
+
+TEST(memory_operations, allocate_unique_arena)
+{
+    speed::memory::monotonic_arena arna(256);
+    speed::memory::monotonic_allocator<int> alloc(arna);
+    
+    {
+        auto ptr = speed::memory::allocate_unique<derived>(alloc, 5);
+        
+        EXPECT_EQ(ptr->val_, 5);
+        EXPECT_EQ(ptr.get_deleter().get_allocator().get_arena(), &arna);
+    }
+    
+    EXPECT_EQ(arna.get_block_count(), 1U);
+}
+
+TEST(memory_operations, allocate_shared)
+{
+    speed::memory::monotonic_arena arna(1024);
+    speed::memory::monotonic_allocator<int> alloc(arna);
+    
+    auto ptr = speed::memory::allocate_shared<derived>(alloc, 9);
+    std::shared_ptr<base> cpy = ptr;
+    
+    EXPECT_EQ(cpy->val_, 9);
+    EXPECT_EQ(ptr.use_count(), 2);
+    EXPECT_EQ(arna.get_block_count(), 1U);
+    EXPECT_GT(arna.get_remaining_size(), 0U);
+}
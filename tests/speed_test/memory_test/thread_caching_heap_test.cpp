@@ -0,0 +1,139 @@
+/* speed - Generic C++ library.
+ * Copyright (C) 2015-2025 Killian Valverde.
+ *
+ * This file is part of speed.
+ *
+ * speed is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * speed is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with speed. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file        thread_caching_heap_test.cpp
+ * @brief       thread_caching_heap unit test.
+ * @author      Killian Valverde
+ * @date        2026/10/16
+ */
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "speed/memory/memory.hpp"
+
+TEST(memory_thread_caching_heap, allocate)
+{
+    using heap_type = speed::memory::thread_caching_heap;
+    
+    void* ptr1 = heap_type::allocate(24);
+    void* ptr2 = heap_type::allocate(24);
+    
+    EXPECT_NE(ptr1, ptr2);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr1) % heap_type::BLOCK_ALIGNMENT, 0U);
+    EXPECT_GT(heap_type::get_chunk_count(), 0U);
+    
+    heap_type::deallocate(ptr2, 24);
+    EXPECT_EQ(heap_type::allocate(32), ptr2);
+    
+    heap_type::deallocate(ptr1, 24);
+    heap_type::deallocate(ptr2, 32);
+    
+    EXPECT_TRUE(heap_type::fits(256, 16));
+    EXPECT_FALSE(heap_type::fits(257, 16));
+    EXPECT_FALSE(heap_type::fits(64, 32));
+}
+
+TEST(memory_thread_caching_heap, allocator)
+{
+    std::list<int, speed::memory::thread_caching_allocator<int>> lst;
+    std::vector<std::uint64_t, speed::memory::thread_caching_allocator<std::uint64_t>> vec;
+    
+    for (int i = 0; i < 1000; ++i)
+    {
+        lst.push_back(i);
+        vec.push_back(static_cast<std::uint64_t>(i));
+    }
+    
+    EXPECT_EQ(lst.back(), 999);
+    EXPECT_EQ(vec[999], 999U);
+    EXPECT_TRUE(speed::memory::thread_caching_allocator<int>() ==
+                speed::memory::thread_caching_allocator<char>());
+}
+
+TEST(memory_thread_caching_heap, allocate_and_construct)
+{
+    speed::memory::thread_caching_allocator<char> alloc;
+    std::map<int, int>* mp;
+    
+    speed::memory::allocate_and_construct(alloc, mp);
+    (*mp)[1] = 2;
+    
+    EXPECT_EQ(mp->at(1), 2);
+    
+    speed::memory::destroy_and_deallocate(alloc, mp);
+}
+
+TEST(memory_thread_caching_heap, cross_thread_deallocation)
+{
+    constexpr std::size_t n_thrds = 4;
+    constexpr std::size_t n_ptrs = 5000;
+    std::vector<std::vector<std::uint64_t*>> ptrs(n_thrds);
+    std::vector<std::thread> thrds;
+    
+    for (std::size_t i = 0; i < n_thrds; ++i)
+    {
+        thrds.emplace_back([&ptrs, i]() {
+            speed::memory::thread_caching_allocator<std::uint64_t> alloc;
+            
+            for (std::size_t j = 0; j < n_ptrs; ++j)
+            {
+                ptrs[i].push_back(alloc.allocate(1 + j % 4));
+                *ptrs[i].back() = i;
+            }
+        });
+    }
+    
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+    
+    thrds.clear();
+    
+    for (std::size_t i = 0; i < n_thrds; ++i)
+    {
+        thrds.emplace_back([&ptrs, i]() {
+            speed::memory::thread_caching_allocator<std::uint64_t> alloc;
+            const auto& othr_ptrs = ptrs[(i + 1) % n_thrds];
+            
+            for (std::size_t j = 0; j < n_ptrs; ++j)
+            {
+                EXPECT_EQ(*othr_ptrs[j], (i + 1) % n_thrds);
+                alloc.deallocate(othr_ptrs[j], 1 + j % 4);
+            }
+            
+            for (std::size_t j = 0; j < n_ptrs; ++j)
+            {
+                alloc.deallocate(alloc.allocate(1 + j % 4), 1 + j % 4);
+            }
+        });
+    }
+    
+    for (auto& thrd : thrds)
+    {
+        thrd.join();
+    }
+}
@@ -24,10 +24,47 @@
  * @date        2017/12/24
  */
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
 #include <gtest/gtest.h>
 
+#include "speed/containers/small_vector.hpp"
 #include "speed/stringutils/stringutils.hpp"
 
+namespace {
+
+std::atomic<std::size_t> n_allocs = 0;
+
+}
+
+void* operator new(std::size_t sz)
+{
+    void* ptr = std::malloc(sz > 0 ? sz : 1);
+    
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    
+    n_allocs.fetch_add(1, std::memory_order_relaxed);
+    
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t sz) noexcept
+{
+    (void)sz;
+    std::free(ptr);
+}
+
 TEST(stringutils_operations, cstr_copy)
 {
     char dest[32] = "hello";
@@ -270,6 +307,33 @@ TEST(stringutils_operations, split)
     }
 }
 
+TEST(stringutils_operations, split_into_container)
+{
+    speed::containers::small_vector<std::string_view, 8> vals;
+    
+    const std::size_t n_allocs_before = n_allocs.load(std::memory_order_relaxed);
+    speed::stringutils::split("a,b,c,d", ",", vals);
+    const std::size_t n_allocs_after = n_allocs.load(std::memory_order_relaxed);
+    
+    EXPECT_EQ(n_allocs_after - n_allocs_before, 0u);
+    ASSERT_EQ(vals.size(), 4u);
+    EXPECT_EQ(vals[0], "a");
+    EXPECT_EQ(vals[1], "b");
+    EXPECT_EQ(vals[2], "c");
+    EXPECT_EQ(vals[3], "d");
+    
+    speed::stringutils::split(",e", ",", vals);
+    
+    ASSERT_EQ(vals.size(), 6u);
+    EXPECT_EQ(vals[4], "");
+    EXPECT_EQ(vals[5], "e");
+    
+    vals.clear();
+    speed::stringutils::split("", ",", vals);
+    
+    EXPECT_TRUE(vals.empty());
+}
+
 TEST(stringutils_operations, to_lower)
 {
     EXPECT_TRUE(speed::stringutils::to_lower('I') == 'i');